@@ -0,0 +1,86 @@
+#include "Arduino.h"
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+HostSerial Serial;
+
+static uint64_t monotonicMicros() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + ts.tv_nsec / 1000;
+}
+
+static uint64_t bootMicros() {
+  static const uint64_t boot_micros = monotonicMicros();   // first use, so static constructors can call millis() safely
+  return boot_micros;
+}
+
+static HostMillisSource millis_source = NULL;
+
+void setHostMillisSource(HostMillisSource src) {
+  millis_source = src;
+}
+
+unsigned long millis() {
+  if (millis_source) return millis_source();
+  return (unsigned long)((monotonicMicros() - bootMicros()) / 1000);
+}
+
+unsigned long micros() {
+  if (millis_source) return millis_source() * 1000;
+  return (unsigned long)(monotonicMicros() - bootMicros());
+}
+
+void delay(unsigned long ms) {
+  usleep(ms * 1000);
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return ::random() % howbig;
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) srandom(seed);
+}
+
+char* ltoa(long value, char* dest, int radix) {
+  char tmp[34];
+  char* tp = tmp;
+  bool neg = radix == 10 && value < 0;
+  unsigned long v = neg ? -value : value;
+  do {
+    int d = v % radix;
+    *tp++ = d < 10 ? '0' + d : 'a' + d - 10;
+    v /= radix;
+  } while (v);
+
+  char* dp = dest;
+  if (neg) *dp++ = '-';
+  while (tp > tmp) *dp++ = *--tp;
+  *dp = 0;
+  return dest;
+}
+
+size_t Print::print(int n) { return printf("%d", n); }
+size_t Print::print(unsigned int n) { return printf("%u", n); }
+size_t Print::print(long n) { return printf("%ld", n); }
+size_t Print::print(unsigned long n) { return printf("%lu", n); }
+size_t Print::print(double d, int digits) { return printf("%.*f", digits, d); }
+
+size_t Print::printf(const char *format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if (len >= (int)sizeof(buf)) len = sizeof(buf) - 1;
+  return write((const uint8_t *) buf, len);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+// Minimal Arduino core stand-in, for building the mesh stack on a Linux host (HOST_PLATFORM)
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "Stream.h"
+
+// as per ArduinoCore-API, these allow mixed argument types
+template<class T, class L>
+auto min(const T& a, const L& b) -> decltype((b < a) ? b : a) { return (b < a) ? b : a; }
+
+template<class T, class L>
+auto max(const T& a, const L& b) -> decltype((b < a) ? b : a) { return (a < b) ? b : a; }
+
+#define constrain(amt, low, high)  ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+inline void yield() { }
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+char* ltoa(long value, char* dest, int radix);
+
+/**
+ * \brief  Host only: substitute the time source behind millis()/micros(), eg. with a simulation's virtual clock.
+ *         Pass NULL to revert to the monotonic system clock.
+*/
+typedef unsigned long (*HostMillisSource)();
+void setHostMillisSource(HostMillisSource src);
+
+/**
+ * \brief  Serial console, writes to stdout. (input is never available)
+*/
+class HostSerial : public Stream {
+public:
+  void begin(unsigned long baud) { }
+  size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+  size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+  void flush() override { fflush(stdout); }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
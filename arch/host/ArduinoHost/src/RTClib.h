@@ -0,0 +1,25 @@
+#pragma once
+
+// Host stand-in for the parts of Adafruit RTClib used by the mesh stack (DateTime only, no RTC chips)
+
+#include <stdint.h>
+#include <time.h>
+
+class DateTime {
+  uint32_t _unixtime;
+  struct tm _tm;
+public:
+  DateTime(uint32_t t = 0) : _unixtime(t) {
+    time_t tt = (time_t)t;
+    gmtime_r(&tt, &_tm);
+  }
+
+  uint16_t year() const { return _tm.tm_year + 1900; }
+  uint8_t month() const { return _tm.tm_mon + 1; }
+  uint8_t day() const { return _tm.tm_mday; }
+  uint8_t hour() const { return _tm.tm_hour; }
+  uint8_t minute() const { return _tm.tm_min; }
+  uint8_t second() const { return _tm.tm_sec; }
+  uint8_t dayOfTheWeek() const { return _tm.tm_wday; }
+  uint32_t unixtime() const { return _unixtime; }
+};
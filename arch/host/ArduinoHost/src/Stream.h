@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/**
+ * \brief  Host stand-in for the Arduino Print class. Sub-classes only need to implement write(uint8_t).
+*/
+class Print {
+public:
+  virtual ~Print() { }
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (n < size && write(buffer[n])) n++;
+    return n;
+  }
+  size_t write(const char *str) { return str ? write((const uint8_t *) str, strlen(str)) : 0; }
+  virtual void flush() { }
+
+  size_t print(const char *str) { return write(str); }
+  size_t print(char c) { return write((uint8_t) c); }
+  size_t print(int n);
+  size_t print(unsigned int n);
+  size_t print(long n);
+  size_t print(unsigned long n);
+  size_t print(double d, int digits = 2);
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+
+  size_t printf(const char *format, ...) __attribute__ ((format (printf, 2, 3)));
+};
+
+/**
+ * \brief  Host stand-in for the Arduino Stream class.
+*/
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    size_t n = 0;
+    while (n < length) {
+      int c = read();
+      if (c < 0) break;
+      buffer[n++] = (uint8_t) c;
+    }
+    return n;
+  }
+  size_t readBytes(char *buffer, size_t length) { return readBytes((uint8_t *) buffer, length); }
+};
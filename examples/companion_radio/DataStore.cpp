@@ -1,11 +1,6 @@
 #include <Arduino.h>
 #include "DataStore.h"
-
-#if defined(EXTRAFS) || defined(QSPIFLASH)
-  #define MAX_BLOBRECS 100
-#else
-  #define MAX_BLOBRECS 20
-#endif
+#include <helpers/RecordReader.h>
 
 // Atomic writes require ~2x storage for contacts file
 // Only enable on platforms with sufficient flash
@@ -15,25 +10,35 @@
 
 DataStore::DataStore(FILESYSTEM& fs, mesh::RTCClock& clock) : _fs(&fs), _fsExtra(nullptr), _clock(&clock),
 #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
-    identity_store(fs, "")
+    identity_store(fs, ""), blob_index(blob_keys[0], BLOB_KEY_SIZE)
 #elif defined(RP2040_PLATFORM)
     identity_store(fs, "/identity")
 #else
     identity_store(fs, "/identity")
 #endif
 {
+  num_contact_recs = 0;
+  offline_read_pos = 0;
+#if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+  resetBlobIndex();
+#endif
 }
 
 #if defined(EXTRAFS) || defined(QSPIFLASH)
 DataStore::DataStore(FILESYSTEM& fs, FILESYSTEM& fsExtra, mesh::RTCClock& clock) : _fs(&fs), _fsExtra(&fsExtra), _clock(&clock),
 #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
-    identity_store(fs, "")
+    identity_store(fs, ""), blob_index(blob_keys[0], BLOB_KEY_SIZE)
 #elif defined(RP2040_PLATFORM)
     identity_store(fs, "/identity")
 #else
     identity_store(fs, "/identity")
 #endif
 {
+  num_contact_recs = 0;
+  offline_read_pos = 0;
+#if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+  resetBlobIndex();
+#endif
 }
 #endif
 
@@ -48,6 +53,17 @@ static File openWrite(FILESYSTEM* fs, const char* filename) {
 #endif
 }
 
+// open for seek() and read/write, without truncating
+static File openUpdate(FILESYSTEM* fs, const char* filename) {
+#if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+  return fs->open(filename, FILE_O_WRITE);
+#elif defined(RP2040_PLATFORM)
+  return fs->open(filename, "r+");
+#else
+  return fs->open(filename, "r+", false);
+#endif
+}
+
 #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
   static uint32_t _ContactsChannelsTotalBlocks = 0;
 #endif
@@ -63,10 +79,19 @@ void DataStore::begin() {
   #if defined(EXTRAFS) || defined(QSPIFLASH)
   migrateToSecondaryFS();
   #endif
+  loadBlobIndex();
 #else
   // init 'blob store' support
   _fs->mkdir("/bl");
 #endif
+
+  session_store.begin(_getContactsChannelsFS(), "/sess_log", "/sess_keys");
+  nonce_log.begin(_getContactsChannelsFS(), "/nonce_log", NONCE_REC_SIZE);
+  contacts_jnl.begin(_getContactsChannelsFS(), "/contacts3.jnl", CONTACTS_JNL_REC_SIZE);
+
+  // the frames queued in RAM ahead of these were lost in the reset, and the position reached is unknown
+  offline_log.begin(_getContactsChannelsFS(), "/offline_q", OFFLINE_FRAME_REC_SIZE);
+  clearOfflineFrames();
 }
 
 #if defined(ESP32)
@@ -274,9 +299,95 @@ void DataStore::savePrefs(const NodePrefs& _prefs, double node_lat, double node_
   }
 }
 
+// /contacts3 record: [pub_key:32][name:32][type:1][flags:1][unused:1][sync_since:4][out_path_len:1]
+//                   [last_advert_timestamp:4][out_path:64][lastmod:4][gps_lat:4][gps_lon:4]
+static void packContact(const ContactInfo& c, uint8_t* rec) {
+  memcpy(&rec[0], c.id.pub_key, 32);
+  memcpy(&rec[32], c.name, 32);
+  rec[64] = c.type;
+  rec[65] = c.flags;
+  rec[66] = 0;  // unused
+  memcpy(&rec[67], &c.sync_since, 4);
+  memcpy(&rec[71], &c.out_path_len, 1);
+  memcpy(&rec[72], &c.last_advert_timestamp, 4);
+  memcpy(&rec[76], c.out_path, 64);
+  memcpy(&rec[140], &c.lastmod, 4);
+  memcpy(&rec[144], &c.gps_lat, 4);
+  memcpy(&rec[148], &c.gps_lon, 4);
+}
+
+static void unpackContact(const uint8_t* rec, ContactInfo& c) {
+  c.id = mesh::Identity(&rec[0]);
+  memcpy(c.name, &rec[32], 32);
+  c.type = rec[64];
+  c.flags = rec[65];
+  memcpy(&c.sync_since, &rec[67], 4);
+  memcpy(&c.out_path_len, &rec[71], 1);
+  memcpy(&c.last_advert_timestamp, &rec[72], 4);
+  memcpy(c.out_path, &rec[76], 64);
+  memcpy(&c.lastmod, &rec[140], 4);
+  memcpy(&c.gps_lat, &rec[144], 4);
+  memcpy(&c.gps_lon, &rec[148], 4);
+}
+
+// FNV-1a
+static uint32_t recordHash(const uint8_t* rec, int len) {
+  uint32_t h = 2166136261UL;
+  for (int i = 0; i < len; i++) {
+    h = (h ^ rec[i]) * 16777619UL;
+  }
+  return h;
+}
+
+#define JNL_COMMIT   0xFFFFFFFF   // journal's last record: [JNL_COMMIT:4][num_records:4]
+
+static_assert(CONTACTS_JNL_REC_SIZE <= RECORD_LOG_MAX_RECORD, "RECORD_LOG_MAX_RECORD too small");
+
+// applies a complete journal of slot writes to /contacts3 (an incomplete one is discarded), then removes it
+bool DataStore::applyContactsJournal() {
+  if (!contacts_jnl.exists()) return true;
+
+  FILESYSTEM* fs = _getContactsChannelsFS();
+  uint8_t rec[CONTACTS_JNL_REC_SIZE];
+  uint32_t idx;
+  bool committed = false;
+  File jnl = contacts_jnl.openRead();
+  if (jnl) {
+    while (contacts_jnl.read(jnl, rec)) {
+      memcpy(&idx, rec, 4);
+      committed = idx == JNL_COMMIT;
+    }
+    jnl.close();
+  }
+
+  bool success = true;
+  if (committed && fs->exists("/contacts3")) {
+    File file = openUpdate(fs, "/contacts3");
+    jnl = contacts_jnl.openRead();
+    success = file && jnl;
+    while (success && contacts_jnl.read(jnl, rec)) {
+      memcpy(&idx, rec, 4);
+      if (idx == JNL_COMMIT) break;
+      success = file.seek(idx * CONTACT_REC_SIZE) && file.write(&rec[4], CONTACT_REC_SIZE) == CONTACT_REC_SIZE;
+    }
+    if (jnl) jnl.close();
+    if (file) file.close();
+  }
+  if (success) {
+    contacts_jnl.clear();
+  } else {
+    MESH_DEBUG_PRINTLN("ERROR: unable to apply contacts journal");
+  }
+  return success;
+}
+
 void DataStore::loadContacts(DataStoreHost* host) {
   FILESYSTEM* fs = _getContactsChannelsFS();
+  applyContactsJournal();   // finish an interrupted saveContacts()
+  num_contact_recs = 0;
+
   File file = openRead(fs, "/contacts3");
+  if (file) num_contact_recs = file.size() / CONTACT_REC_SIZE;
 
 #ifdef HAS_ATOMIC_WRITE_SUPPORT
   // If main file doesn't exist or is empty, try backup
@@ -290,35 +401,21 @@ void DataStore::loadContacts(DataStoreHost* host) {
 #endif
 
   if (file) {
-    bool full = false;
-    while (!full) {
+    RecordReader in(file);
+    uint32_t idx = 0;
+    uint8_t rec[CONTACT_REC_SIZE];
+    while (idx < MAX_CONTACTS && in.read(rec, CONTACT_REC_SIZE) == CONTACT_REC_SIZE) {
       ContactInfo c;
-      uint8_t pub_key[32];
-      uint8_t unused;
-
-      bool success = (file.read(pub_key, 32) == 32);
-      success = success && (file.read((uint8_t *)&c.name, 32) == 32);
-      success = success && (file.read(&c.type, 1) == 1);
-      success = success && (file.read(&c.flags, 1) == 1);
-      success = success && (file.read(&unused, 1) == 1);
-      success = success && (file.read((uint8_t *)&c.sync_since, 4) == 4); // was 'reserved'
-      success = success && (file.read((uint8_t *)&c.out_path_len, 1) == 1);
-      success = success && (file.read((uint8_t *)&c.last_advert_timestamp, 4) == 4);
-      success = success && (file.read(c.out_path, 64) == 64);
-      success = success && (file.read((uint8_t *)&c.lastmod, 4) == 4);
-      success = success && (file.read((uint8_t *)&c.gps_lat, 4) == 4);
-      success = success && (file.read((uint8_t *)&c.gps_lon, 4) == 4);
-
-      if (!success) break; // EOF
-
-      c.id = mesh::Identity(pub_key);
-      if (!host->onContactLoaded(c)) full = true;
+      unpackContact(rec, c);
+      if (!host->onContactLoaded(c)) break;  // full
+      contact_hashes[idx++] = recordHash(rec, CONTACT_REC_SIZE);
     }
     file.close();
   }
 }
 
-void DataStore::saveContacts(DataStoreHost* host) {
+// rewrites the whole file
+void DataStore::writeAllContacts(DataStoreHost* host) {
   FILESYSTEM* fs = _getContactsChannelsFS();
 
 #ifdef HAS_ATOMIC_WRITE_SUPPORT
@@ -330,32 +427,21 @@ void DataStore::saveContacts(DataStoreHost* host) {
   if (file) {
     uint32_t idx = 0;
     ContactInfo c;
-    uint8_t unused = 0;
+    uint8_t rec[CONTACT_REC_SIZE];
     bool write_success = true;
 
     while (host->getContactForSave(idx, c)) {
-      bool success = (file.write(c.id.pub_key, 32) == 32);
-      success = success && (file.write((uint8_t *)&c.name, 32) == 32);
-      success = success && (file.write(&c.type, 1) == 1);
-      success = success && (file.write(&c.flags, 1) == 1);
-      success = success && (file.write(&unused, 1) == 1);
-      success = success && (file.write((uint8_t *)&c.sync_since, 4) == 4);
-      success = success && (file.write((uint8_t *)&c.out_path_len, 1) == 1);
-      success = success && (file.write((uint8_t *)&c.last_advert_timestamp, 4) == 4);
-      success = success && (file.write(c.out_path, 64) == 64);
-      success = success && (file.write((uint8_t *)&c.lastmod, 4) == 4);
-      success = success && (file.write((uint8_t *)&c.gps_lat, 4) == 4);
-      success = success && (file.write((uint8_t *)&c.gps_lon, 4) == 4);
-
-      if (!success) {
+      packContact(c, rec);
+      if (file.write(rec, CONTACT_REC_SIZE) != CONTACT_REC_SIZE) {
         write_success = false;
         break; // write failed
       }
-
+      if (idx < MAX_CONTACTS) contact_hashes[idx] = recordHash(rec, CONTACT_REC_SIZE);
       idx++;  // advance to next contact
     }
     file.flush();
     file.close();
+    num_contact_recs = write_success ? idx : 0;   // if unknown, the next save is a full rewrite
 
 #ifdef HAS_ATOMIC_WRITE_SUPPORT
     if (write_success) {
@@ -370,18 +456,74 @@ void DataStore::saveContacts(DataStoreHost* host) {
   }
 }
 
+void DataStore::saveContacts(DataStoreHost* host) {
+  FILESYSTEM* fs = _getContactsChannelsFS();
+  ContactInfo c;
+  uint8_t rec[CONTACTS_JNL_REC_SIZE];   // [idx:4][contact record]
+
+  // which records have changed since last read or written
+  uint32_t num = 0, num_changed = 0;
+  while (host->getContactForSave(num, c)) {
+    packContact(c, &rec[4]);
+    if (num >= num_contact_recs || num >= MAX_CONTACTS || recordHash(&rec[4], CONTACT_REC_SIZE) != contact_hashes[num]) {
+      num_changed++;
+    }
+    num++;
+  }
+  if (num_changed == 0 && num == num_contact_recs) return;
+
+  // removals shift the following records anyway, and past half the file a rewrite costs less than journal + update
+  if (num < num_contact_recs || num > MAX_CONTACTS || num_changed*2 > num || !fs->exists("/contacts3")) {
+    writeAllContacts(host);
+    return;
+  }
+
+  // 1. journal the changed records
+  contacts_jnl.clear();
+  File jnl = contacts_jnl.openAppend();
+  bool success = jnl;
+  for (uint32_t idx = 0; success && idx < num && host->getContactForSave(idx, c); idx++) {
+    packContact(c, &rec[4]);
+    if (idx < num_contact_recs && recordHash(&rec[4], CONTACT_REC_SIZE) == contact_hashes[idx]) continue;
+    memcpy(rec, &idx, 4);
+    success = contacts_jnl.append(jnl, rec) >= 0;
+  }
+  if (success) {
+    uint32_t commit = JNL_COMMIT;
+    memset(rec, 0, sizeof(rec));
+    memcpy(rec, &commit, 4);
+    memcpy(&rec[4], &num, 4);
+    success = contacts_jnl.append(jnl, rec) >= 0;
+  }
+  if (jnl) jnl.close();
+
+  // 2. write them in place
+  if (success && applyContactsJournal()) {
+    for (uint32_t idx = 0; idx < num && host->getContactForSave(idx, c); idx++) {
+      packContact(c, rec);
+      contact_hashes[idx] = recordHash(rec, CONTACT_REC_SIZE);
+    }
+    num_contact_recs = num;
+  } else {
+    MESH_DEBUG_PRINTLN("ERROR: saveContacts journal failed");
+    contacts_jnl.clear();
+    writeAllContacts(host);
+  }
+}
+
 void DataStore::loadChannels(DataStoreHost* host) {
     File file = openRead(_getContactsChannelsFS(), "/channels2");
     if (file) {
+      RecordReader in(file);
       bool full = false;
       uint8_t channel_idx = 0;
       while (!full) {
         ChannelDetails ch;
         uint8_t unused[4];
 
-        bool success = (file.read(unused, 4) == 4);
-        success = success && (file.read((uint8_t *)ch.name, 32) == 32);
-        success = success && (file.read((uint8_t *)ch.channel.secret, 32) == 32);
+        bool success = (in.read(unused, 4) == 4);
+        success = success && (in.read((uint8_t *)ch.name, 32) == 32);
+        success = success && (in.read((uint8_t *)ch.channel.secret, 32) == 32);
 
         if (!success) break; // EOF
 
@@ -416,137 +558,127 @@ void DataStore::saveChannels(DataStoreHost* host) {
 }
 
 void DataStore::loadNonces(DataStoreHost* host) {
-  File file = openRead(_getContactsChannelsFS(), "/nonces");
+  bool legacy = !nonce_log.exists();
+  File file;
+  if (legacy) {
+    file = openRead(_getContactsChannelsFS(), "/nonces");   // older format: the whole set, rewritten on every save
+    if (file) nonce_log.requestCompact();   // next saveNonces() converts it
+  } else {
+    file = nonce_log.openRead();
+  }
   if (file) {
-    uint8_t rec[6];  // 4-byte pub_key prefix + 2-byte nonce
-    while (file.read(rec, 6) == 6) {
+    uint8_t rec[NONCE_REC_SIZE];  // 4-byte pub_key prefix + 2-byte nonce
+    while (legacy ? file.read(rec, NONCE_REC_SIZE) == NONCE_REC_SIZE : nonce_log.read(file, rec)) {
       uint16_t nonce;
       memcpy(&nonce, &rec[4], 2);
-      host->onNonceLoaded(rec, nonce);
+      host->onNonceLoaded(rec, nonce);   // a contact's latest record wins
     }
     file.close();
   }
 }
 
 bool DataStore::saveNonces(DataStoreHost* host) {
-  File file = openWrite(_getContactsChannelsFS(), "/nonces");
-  if (file) {
-    int idx = 0;
-    uint8_t pub_key_prefix[4];
-    uint16_t nonce;
-    while (host->getNonceForSave(idx, pub_key_prefix, &nonce)) {
-      file.write(pub_key_prefix, 4);
-      file.write((uint8_t*)&nonce, 2);
-      idx++;
-    }
+  uint8_t rec[NONCE_REC_SIZE];
+  uint16_t nonce;
+  int num_live = 0;
+  while (host->getNonceForSave(num_live, rec, &nonce)) num_live++;
+
+  // append just the nonces which have moved on, or write the whole set to a new log once it has grown enough
+  bool compact = nonce_log.shouldCompact(num_live);
+  File file = compact ? nonce_log.beginCompact() : nonce_log.openAppend();
+  if (!file) return false;
+
+  bool success = true;
+  for (int idx = 0; success && host->getNonceForSave(idx, rec, &nonce); idx++) {
+    if (!compact && !host->isNonceChanged(idx)) continue;
+    memcpy(&rec[4], &nonce, 2);
+    success = nonce_log.append(file, rec) >= 0;
+  }
+  if (compact) {
+    success = nonce_log.endCompact(file, success);
+    if (success) removeFile(_getContactsChannelsFS(), "/nonces");
+  } else {
     file.close();
-    return true;
   }
-  return false;
+  return success;
 }
 
 void DataStore::loadSessionKeys(DataStoreHost* host) {
-  File file = openRead(_getContactsChannelsFS(), "/sess_keys");
-  if (!file) return;
-  while (true) {
-    uint8_t rec[SESSION_KEY_RECORD_MIN_SIZE];
-    if (file.read(rec, SESSION_KEY_RECORD_MIN_SIZE) != SESSION_KEY_RECORD_MIN_SIZE) break;
-    uint8_t flags = rec[4];
-    uint16_t nonce;
-    memcpy(&nonce, &rec[5], 2);
-    uint8_t prev_key[SESSION_KEY_SIZE];
-    if (flags & SESSION_FLAG_PREV_VALID) {
-      if (file.read(prev_key, SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-    } else {
-      memset(prev_key, 0, SESSION_KEY_SIZE);
-    }
-    host->onSessionKeyLoaded(rec, flags, nonce, &rec[7], prev_key);
-  }
-  file.close();
+  session_store.load(host);
 }
 
 bool DataStore::saveSessionKeys(DataStoreHost* host) {
-  FILESYSTEM* fs = _getContactsChannelsFS();
-
-  // 1. Read old flash file into buffer (variable-length records)
-  uint8_t old_buf[MAX_SESSION_KEYS_FLASH * SESSION_KEY_RECORD_SIZE];
-  int old_len = 0;
-  File rf = openRead(fs, "/sess_keys");
-  if (rf) {
-    while (true) {
-      if (old_len + SESSION_KEY_RECORD_MIN_SIZE > (int)sizeof(old_buf)) break;
-      if (rf.read(&old_buf[old_len], SESSION_KEY_RECORD_MIN_SIZE) != SESSION_KEY_RECORD_MIN_SIZE) break;
-      uint8_t flags = old_buf[old_len + 4];
-      int rec_len = SESSION_KEY_RECORD_MIN_SIZE;
-      if (flags & SESSION_FLAG_PREV_VALID) {
-        if (old_len + SESSION_KEY_RECORD_SIZE > (int)sizeof(old_buf)) break;
-        if (rf.read(&old_buf[old_len + SESSION_KEY_RECORD_MIN_SIZE], SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-        rec_len = SESSION_KEY_RECORD_SIZE;
-      }
-      old_len += rec_len;
-    }
-    rf.close();
-  }
-
-  // 2. Write merged file
-  File wf = openWrite(fs, "/sess_keys");
-  if (!wf) return false;
-
-  // Write kept old records (variable-length)
-  int pos = 0;
-  while (pos + SESSION_KEY_RECORD_MIN_SIZE <= old_len) {
-    uint8_t* rec = &old_buf[pos];
-    uint8_t flags = rec[4];
-    int rec_len = (flags & SESSION_FLAG_PREV_VALID) ? SESSION_KEY_RECORD_SIZE : SESSION_KEY_RECORD_MIN_SIZE;
-    if (pos + rec_len > old_len) break;
-    if (!host->isSessionKeyInRAM(rec) && !host->isSessionKeyRemoved(rec)) {
-      wf.write(rec, rec_len);
-    }
-    pos += rec_len;
-  }
-  // Write current RAM entries (variable-length)
-  for (int idx = 0; idx < MAX_SESSION_KEYS_RAM; idx++) {
-    uint8_t pk[4]; uint8_t fl; uint16_t n; uint8_t sk[32]; uint8_t psk[32];
-    if (!host->getSessionKeyForSave(idx, pk, &fl, &n, sk, psk)) continue;
-    wf.write(pk, 4); wf.write(&fl, 1); wf.write((uint8_t*)&n, 2);
-    wf.write(sk, 32);
-    if (fl & SESSION_FLAG_PREV_VALID) {
-      wf.write(psk, 32);
-    }
-  }
-  wf.close();
-  return true;
+  return session_store.save(host);
 }
 
 bool DataStore::loadSessionKeyByPrefix(const uint8_t* prefix,
     uint8_t* flags, uint16_t* nonce, uint8_t* session_key, uint8_t* prev_session_key) {
-  File f = openRead(_getContactsChannelsFS(), "/sess_keys");
-  if (!f) return false;
-  while (true) {
-    uint8_t rec[SESSION_KEY_RECORD_MIN_SIZE];
-    if (f.read(rec, SESSION_KEY_RECORD_MIN_SIZE) != SESSION_KEY_RECORD_MIN_SIZE) break;
-    uint8_t rec_flags = rec[4];
-    bool has_prev = (rec_flags & SESSION_FLAG_PREV_VALID);
-    if (memcmp(rec, prefix, 4) == 0) {
-      *flags = rec_flags;
-      memcpy(nonce, &rec[5], 2);
-      memcpy(session_key, &rec[7], SESSION_KEY_SIZE);
-      if (has_prev) {
-        if (f.read(prev_session_key, SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-      } else {
-        memset(prev_session_key, 0, SESSION_KEY_SIZE);
-      }
-      f.close();
-      return true;
-    }
-    // Skip prev_key if present
-    if (has_prev) {
-      uint8_t skip[SESSION_KEY_SIZE];
-      if (f.read(skip, SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-    }
+  return session_store.find(prefix, flags, nonce, session_key, prev_session_key);
+}
+
+static_assert(OFFLINE_FRAME_REC_SIZE <= RECORD_LOG_MAX_RECORD, "RECORD_LOG_MAX_RECORD too small");
+
+void DataStore::clearOfflineFrames() {
+  offline_log.clear();
+  offline_read_pos = 0;
+}
+
+// rewrites the log with just the frames not yet taken
+bool DataStore::compactOfflineFrames() {
+  File src = offline_log.openRead();
+  File dest = offline_log.beginCompact();
+  bool success = src && dest;
+  uint8_t rec[OFFLINE_FRAME_REC_SIZE];
+  for (uint32_t i = offline_read_pos; i < offline_log.getNumRecords() && success; i++) {
+    success = offline_log.readAt(src, i, rec) && offline_log.append(dest, rec) >= 0;
+  }
+  if (src) src.close();
+  if (dest) {
+    success = offline_log.endCompact(dest, success);
   }
-  f.close();
-  return false;
+  if (success) {
+    offline_read_pos = 0;
+  } else {
+    MESH_DEBUG_PRINTLN("DataStore: offline queue log unusable, frames lost");
+    clearOfflineFrames();
+  }
+  return success;
+}
+
+bool DataStore::appendOfflineFrame(const uint8_t frame[], int len) {
+  if (len <= 0 || len > MAX_FRAME_SIZE) return false;
+  if (offline_log.shouldCompact(getNumOfflineFrames()) && !compactOfflineFrames()) return false;
+
+  uint8_t rec[OFFLINE_FRAME_REC_SIZE];
+  rec[0] = len;
+  memcpy(&rec[1], frame, len);
+  memset(&rec[1 + len], 0, MAX_FRAME_SIZE - len);
+
+  File file = offline_log.openAppend();
+  if (!file) return false;
+  bool success = offline_log.append(file, rec) >= 0;
+  file.close();
+  return success;
+}
+
+int DataStore::takeOfflineFrame(uint8_t frame[]) {
+  if (getNumOfflineFrames() == 0) return 0;
+
+  uint8_t rec[OFFLINE_FRAME_REC_SIZE];
+  File file = offline_log.openRead();
+  bool success = file && offline_log.readAt(file, offline_read_pos, rec) && rec[0] > 0 && rec[0] <= MAX_FRAME_SIZE;
+  if (file) file.close();
+  if (!success) {
+    MESH_DEBUG_PRINTLN("DataStore: offline queue log unreadable, frames lost");
+    clearOfflineFrames();
+    return 0;
+  }
+
+  if (++offline_read_pos >= offline_log.getNumRecords()) {
+    clearOfflineFrames();   // all taken
+  }
+  memcpy(frame, &rec[1], rec[0]);
+  return rec[0];
 }
 
 #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
@@ -560,6 +692,11 @@ struct BlobRec {
   uint8_t  data[MAX_ADVERT_PKT_LEN];
 };
 
+#define BLOB_HDR_SIZE   offsetof(BlobRec, data)   // timestamp, key, len
+#define MIN_BLOB_LEN    (PUB_KEY_SIZE+4+SIGNATURE_SIZE)
+
+static_assert(MAX_BLOBRECS <= 256, "MAX_BLOBRECS too big for blob_free[]");
+
 void DataStore::checkAdvBlobFile() {
   if (!_getContactsChannelsFS()->exists("/adv_blobs")) {
     File file = openWrite(_getContactsChannelsFS(), "/adv_blobs");
@@ -571,9 +708,54 @@ void DataStore::checkAdvBlobFile() {
       }
       file.close();
     }
+    resetBlobIndex();   // all slots are free
+  }
+}
+
+void DataStore::resetBlobIndex() {
+  memset(blob_keys, 0, sizeof(blob_keys));
+  memset(blob_timestamps, 0, sizeof(blob_timestamps));
+  memset(blob_lens, 0, sizeof(blob_lens));
+  blob_index.clear();
+  num_blob_free = 0;
+  for (int i = MAX_BLOBRECS - 1; i >= 0; i--) {
+    blob_free[num_blob_free++] = i;   // lowest slot on top
   }
 }
 
+// rebuilds the RAM index from the slot headers, once at boot
+void DataStore::loadBlobIndex() {
+  resetBlobIndex();
+  File file = openRead(_getContactsChannelsFS(), "/adv_blobs");
+  if (!file) return;
+
+  for (int i = 0; i < MAX_BLOBRECS; i++) {
+    BlobRec hdr;
+    if (!file.seek(i * sizeof(BlobRec)) || file.read((uint8_t *) &hdr, BLOB_HDR_SIZE) != BLOB_HDR_SIZE) break;
+    if (hdr.len < MIN_BLOB_LEN || hdr.len > MAX_ADVERT_PKT_LEN) continue;   // free slot
+    if (blob_index.find(hdr.key, BLOB_KEY_SIZE) >= 0) continue;   // stale duplicate, the first slot is the one which was read
+
+    memcpy(blob_keys[i], hdr.key, BLOB_KEY_SIZE);
+    blob_timestamps[i] = hdr.timestamp;
+    blob_lens[i] = hdr.len;
+    blob_index.add(i);
+  }
+  file.close();
+
+  num_blob_free = 0;
+  for (int i = MAX_BLOBRECS - 1; i >= 0; i--) {
+    if (blob_lens[i] == 0) blob_free[num_blob_free++] = i;
+  }
+}
+
+static bool writeBlobSlot(FILESYSTEM* fs, int slot, const BlobRec& rec, int len) {
+  File file = openUpdate(fs, "/adv_blobs");
+  if (!file) return false;
+  bool success = file.seek(slot * sizeof(BlobRec)) && file.write((const uint8_t *) &rec, len) == len;
+  file.close();
+  return success;
+}
+
 void DataStore::migrateToSecondaryFS() {
   // migrate old adv_blobs, contacts3 and channels2 files to secondary FS if they don't already exist
   if (!_fsExtra->exists("/adv_blobs")) {
@@ -683,16 +865,17 @@ void DataStore::migrateToSecondaryFS() {
 }
 
 uint8_t DataStore::getBlobByKey(const uint8_t key[], int key_len, uint8_t dest_buf[]) {
+  int slot = blob_index.find(key, BLOB_KEY_SIZE);   // only match by 7 byte prefix
+  if (slot < 0) return 0;   // not found, no need to touch flash
+
   File file = openRead(_getContactsChannelsFS(), "/adv_blobs");
-  uint8_t len = 0;  // 0 = not found
+  uint8_t len = 0;
   if (file) {
     BlobRec tmp;
-    while (file.read((uint8_t *) &tmp, sizeof(tmp)) == sizeof(tmp)) {
-      if (memcmp(key, tmp.key, sizeof(tmp.key)) == 0) {  // only match by 7 byte prefix
-        len = tmp.len;
-        memcpy(dest_buf, tmp.data, len);
-        break;
-      }
+    if (file.seek(slot * sizeof(BlobRec)) && file.read((uint8_t *) &tmp, sizeof(tmp)) == sizeof(tmp)
+        && memcmp(tmp.key, blob_keys[slot], BLOB_KEY_SIZE) == 0 && tmp.len <= MAX_ADVERT_PKT_LEN) {
+      len = tmp.len;
+      memcpy(dest_buf, tmp.data, len);
     }
     file.close();
   }
@@ -700,46 +883,71 @@ uint8_t DataStore::getBlobByKey(const uint8_t key[], int key_len, uint8_t dest_b
 }
 
 bool DataStore::putBlobByKey(const uint8_t key[], int key_len, const uint8_t src_buf[], uint8_t len) {
-  if (len < PUB_KEY_SIZE+4+SIGNATURE_SIZE || len > MAX_ADVERT_PKT_LEN) return false;
+  if (len < MIN_BLOB_LEN || len > MAX_ADVERT_PKT_LEN) return false;
   checkAdvBlobFile();
-  File file = _getContactsChannelsFS()->open("/adv_blobs", FILE_O_WRITE);
-  if (file) {
-    uint32_t pos = 0, found_pos = 0;
-    uint32_t min_timestamp = 0xFFFFFFFF;
 
-    // search for matching key OR evict by oldest timestmap
-    BlobRec tmp;
-    file.seek(0);
-    while (file.read((uint8_t *) &tmp, sizeof(tmp)) == sizeof(tmp)) {
-      if (memcmp(key, tmp.key, sizeof(tmp.key)) == 0) {  // only match by 7 byte prefix
-        found_pos = pos;
-        break;
-      }
-      if (tmp.timestamp < min_timestamp) {
-        min_timestamp = tmp.timestamp;
-        found_pos = pos;
+  int slot = blob_index.find(key, BLOB_KEY_SIZE);
+  if (slot < 0) {
+    if (num_blob_free > 0) {
+      slot = blob_free[--num_blob_free];
+    } else {
+      // evict by oldest timestamp
+      slot = 0;
+      for (int i = 1; i < MAX_BLOBRECS; i++) {
+        if (blob_timestamps[i] < blob_timestamps[slot]) slot = i;
       }
-
-      pos += sizeof(tmp);
+      blob_index.remove(slot);
     }
+    memcpy(blob_keys[slot], key, BLOB_KEY_SIZE);   // just record 7 byte prefix of key
+    blob_index.add(slot);
+  }
 
-    memcpy(tmp.key, key, sizeof(tmp.key));  // just record 7 byte prefix of key
-    memcpy(tmp.data, src_buf, len);
-    tmp.len = len;
-    tmp.timestamp = _clock->getCurrentTime();
-
-    file.seek(found_pos);
-    file.write((uint8_t *) &tmp, sizeof(tmp));
-
-    file.close();
-    return true;
+  BlobRec tmp;
+  memcpy(tmp.key, key, sizeof(tmp.key));
+  memcpy(tmp.data, src_buf, len);
+  tmp.len = len;
+  tmp.timestamp = _clock->getCurrentTime();
+
+  if (!writeBlobSlot(_getContactsChannelsFS(), slot, tmp, BLOB_HDR_SIZE + len)) {
+    // slot contents now unknown, don't read from it again
+    blob_index.remove(slot);
+    blob_lens[slot] = 0;
+    blob_free[num_blob_free++] = slot;
+    return false; // error
   }
-  return false; // error
+  blob_timestamps[slot] = tmp.timestamp;
+  blob_lens[slot] = len;
+  return true;
 }
+
 bool DataStore::deleteBlobByKey(const uint8_t key[], int key_len) {
-  return true; // this is just a stub on NRF52/STM32 platforms
+  int slot = blob_index.find(key, BLOB_KEY_SIZE);
+  if (slot < 0) return true;   // return true even if not stored
+
+  BlobRec zeroes;
+  memset(&zeroes, 0, BLOB_HDR_SIZE);   // len = 0 marks the slot as free
+  bool success = writeBlobSlot(_getContactsChannelsFS(), slot, zeroes, BLOB_HDR_SIZE);
+
+  blob_index.remove(slot);
+  blob_timestamps[slot] = 0;
+  blob_lens[slot] = 0;
+  blob_free[num_blob_free++] = slot;
+  return success;
+}
+
+void DataStore::cleanOrphanBlobs(DataStoreHost* host) {
+  // blobs of contacts removed back when deleteBlobByKey() was a stub on these platforms
+  bool in_use[MAX_BLOBRECS];
+  memset(in_use, 0, sizeof(in_use));
+  ContactInfo c;
+  for (uint32_t i = 0; host->getContactForSave(i, c); i++) {
+    int slot = blob_index.find(c.id.pub_key, BLOB_KEY_SIZE);
+    if (slot >= 0) in_use[slot] = true;
+  }
+  for (int i = 0; i < MAX_BLOBRECS; i++) {
+    if (blob_lens[i] > 0 && !in_use[i]) deleteBlobByKey(blob_keys[i], BLOB_KEY_SIZE);
+  }
 }
-void DataStore::cleanOrphanBlobs(DataStoreHost* host) {}
 #else
 inline void makeBlobPath(const uint8_t key[], int key_len, char* path, size_t path_size) {
   char fname[18];
@@ -3,9 +3,30 @@
 #include <helpers/IdentityStore.h>
 #include <helpers/ContactInfo.h>
 #include <helpers/ChannelDetails.h>
+#include <helpers/SessionKeyStore.h>
+#include <helpers/RecordLog.h>
+#include <helpers/PubKeyIndex.h>
+#include <helpers/BaseSerialInterface.h>
 #include "NodePrefs.h"
 
-class DataStoreHost {
+#define NONCE_REC_SIZE   6   // [pub_prefix:4][nonce:2]
+
+#ifndef MAX_CONTACTS
+  #define MAX_CONTACTS 100   // the companion's default (MyMesh.h includes this ahead of BaseChatMesh.h, whose is 32)
+#endif
+
+#define CONTACT_REC_SIZE        152
+#define CONTACTS_JNL_REC_SIZE   (4 + CONTACT_REC_SIZE)   // [record_idx:4][contact record]
+#define OFFLINE_FRAME_REC_SIZE  (1 + MAX_FRAME_SIZE)     // [len:1][frame]
+
+#if defined(EXTRAFS) || defined(QSPIFLASH)
+  #define MAX_BLOBRECS 100
+#else
+  #define MAX_BLOBRECS 20
+#endif
+#define BLOB_KEY_SIZE   7   // blobs in /adv_blobs are matched by this prefix of the key
+
+class DataStoreHost : public SessionKeyStoreHost {
 public:
   virtual bool onContactLoaded(const ContactInfo& contact) =0;
   virtual bool getContactForSave(uint32_t idx, ContactInfo& contact) =0;
@@ -13,12 +34,7 @@ public:
   virtual bool getChannelForSave(uint8_t channel_idx, ChannelDetails& ch) =0;
   virtual bool onNonceLoaded(const uint8_t* pub_key_prefix, uint16_t nonce) { return false; }
   virtual bool getNonceForSave(int idx, uint8_t* pub_key_prefix, uint16_t* nonce) { return false; }
-  virtual bool onSessionKeyLoaded(const uint8_t* pub_key_prefix, uint8_t flags, uint16_t nonce,
-                                   const uint8_t* session_key, const uint8_t* prev_session_key) { return false; }
-  virtual bool getSessionKeyForSave(int idx, uint8_t* pub_key_prefix, uint8_t* flags, uint16_t* nonce,
-                                     uint8_t* session_key, uint8_t* prev_session_key) { return false; }
-  virtual bool isSessionKeyInRAM(const uint8_t* pub_key_prefix) { return false; }
-  virtual bool isSessionKeyRemoved(const uint8_t* pub_key_prefix) { return false; }
+  virtual bool isNonceChanged(int idx) { return true; }   // since last persisted
 };
 
 class DataStore {
@@ -26,11 +42,32 @@ class DataStore {
   FILESYSTEM* _fsExtra;
   mesh::RTCClock* _clock;
   IdentityStore identity_store;
+  SessionKeyStore session_store;
+  RecordLog nonce_log;
+  RecordLog contacts_jnl;
+  uint32_t contact_hashes[MAX_CONTACTS];   // of each /contacts3 record, as last read or written
+  uint32_t num_contact_recs;
+  RecordLog offline_log;
+  uint32_t offline_read_pos;   // next record of offline_log to take
 
   void loadPrefsInt(const char *filename, NodePrefs& prefs, double& node_lat, double& node_lon);
 #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+  // /adv_blobs slots, as in the file: key, timestamp and len (0 = free)
+  uint8_t blob_keys[MAX_BLOBRECS][BLOB_KEY_SIZE];
+  uint32_t blob_timestamps[MAX_BLOBRECS];
+  uint8_t blob_lens[MAX_BLOBRECS];
+  PubKeyIndex<MAX_BLOBRECS, BLOB_KEY_SIZE> blob_index;   // of the used slots
+  uint8_t blob_free[MAX_BLOBRECS];   // stack of the free slots
+  int num_blob_free;
+
   void checkAdvBlobFile();
+  void loadBlobIndex();
+  void resetBlobIndex();
 #endif
+  bool applyContactsJournal();
+  void writeAllContacts(DataStoreHost* host);
+  void clearOfflineFrames();
+  bool compactOfflineFrames();
 
 public:
   DataStore(FILESYSTEM& fs, mesh::RTCClock& clock);
@@ -54,6 +91,9 @@ public:
   bool loadSessionKeyByPrefix(const uint8_t* prefix,
       uint8_t* flags, uint16_t* nonce, uint8_t* session_key, uint8_t* prev_session_key);
   void migrateToSecondaryFS();
+  uint32_t getNumOfflineFrames() const { return offline_log.getNumRecords() - offline_read_pos; }
+  bool appendOfflineFrame(const uint8_t frame[], int len);
+  int takeOfflineFrame(uint8_t frame[]);
   uint8_t getBlobByKey(const uint8_t key[], int key_len, uint8_t dest_buf[]);
   bool putBlobByKey(const uint8_t key[], int key_len, const uint8_t src_buf[], uint8_t len);
   bool deleteBlobByKey(const uint8_t key[], int key_len);
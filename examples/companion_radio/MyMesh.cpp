@@ -90,6 +90,8 @@
 #define RESP_CODE_STATS               24   // v8+, second byte is stats type
 #define RESP_CODE_AUTOADD_CONFIG      25
 #define RESP_ALLOWED_REPEAT_FREQ      26
+#define RESP_CODE_CONTACTS_BATCH      27   // v10+, multiple of these (after CMD_GET_CONTACTS), instead of RESP_CODE_CONTACT
+#define RESP_CODE_MSGS_BATCH          28   // v10+, a reply to CMD_SYNC_NEXT_MESSAGE
 
 #define SEND_TIMEOUT_BASE_MILLIS        1000
 #define FLOOD_SEND_TIMEOUT_FACTOR       32.0f
@@ -177,6 +179,64 @@ void MyMesh::writeContactRespFrame(uint8_t code, const ContactInfo &contact) {
   _serial->writeFrame(out_frame, i);
 }
 
+// the fields of RESP_CODE_CONTACT, without the padding of out_path and name
+static int packContact(uint8_t* dest, const ContactInfo &contact) {
+  int i = 0;
+  memcpy(&dest[i], contact.id.pub_key, PUB_KEY_SIZE);
+  i += PUB_KEY_SIZE;
+  dest[i++] = contact.type;
+  dest[i++] = contact.flags;
+  dest[i++] = contact.out_path_len;
+  int path_len = contact.out_path_len > 0 ? contact.out_path_len : 0;
+  if (path_len > MAX_PATH_SIZE) path_len = MAX_PATH_SIZE;
+  memcpy(&dest[i], contact.out_path, path_len);
+  i += path_len;
+  int name_len = strnlen(contact.name, sizeof(contact.name));
+  dest[i++] = name_len;
+  memcpy(&dest[i], contact.name, name_len);
+  i += name_len;
+  memcpy(&dest[i], &contact.last_advert_timestamp, 4);
+  i += 4;
+  memcpy(&dest[i], &contact.gps_lat, 4);
+  i += 4;
+  memcpy(&dest[i], &contact.gps_lon, 4);
+  i += 4;
+  memcpy(&dest[i], &contact.lastmod, 4);
+  i += 4;
+  return i;
+}
+
+// v10+: as many of the iterator's contacts as fit, then the iterator's position (for resuming with CMD_GET_CONTACTS)
+void MyMesh::writeContactsBatchFrame() {
+  int i = 0;
+  out_frame[i++] = RESP_CODE_CONTACTS_BATCH;
+  i += 2;   // position, after these contacts
+  int count_pos = i++;
+  out_frame[count_pos] = 0;
+
+  uint8_t rec[MAX_FRAME_SIZE];
+  ContactInfo contact;
+  ContactsIterator next = _iter;
+  while (next.hasNext(this, contact)) {
+    if (contact.lastmod > _iter_filter_since) { // apply the 'since' filter
+      int len = packContact(rec, contact);
+      if (i + len > MAX_FRAME_SIZE) break;   // for the next frame
+      memcpy(&out_frame[i], rec, len);
+      i += len;
+      out_frame[count_pos]++;
+      if (contact.lastmod > _most_recent_lastmod) {
+        _most_recent_lastmod = contact.lastmod; // save for the RESP_CODE_END_OF_CONTACTS frame
+      }
+    }
+    _iter = next;
+  }
+  if (out_frame[count_pos] > 0) {
+    uint16_t pos = _iter.getPosition();
+    memcpy(&out_frame[1], &pos, 2);
+    _serial->writeFrame(out_frame, i);
+  }
+}
+
 void MyMesh::updateContactFromFrame(ContactInfo &contact, uint32_t& last_mod, const uint8_t *frame, int len) {
   int i = 0;
   uint8_t code = frame[i++]; // eg. CMD_ADD_UPDATE_CONTACT
@@ -206,44 +266,93 @@ bool MyMesh::Frame::isChannelMsg() const {
   return buf[0] == RESP_CODE_CHANNEL_MSG_RECV || buf[0] == RESP_CODE_CHANNEL_MSG_RECV_V3;
 }
 
+#define OFFLINE_QUEUE_AT(i)   offline_queue[(offline_queue_head + (i)) % OFFLINE_QUEUE_SIZE]
+
+bool MyMesh::removeOldestChannelMsg() {
+  for (int pos = 0; pos < offline_queue_len; pos++) {
+    if (OFFLINE_QUEUE_AT(pos).isChannelMsg()) {
+      for (int i = pos; i < offline_queue_len - 1; i++) { // delete oldest channel msg from queue
+        OFFLINE_QUEUE_AT(i) = OFFLINE_QUEUE_AT(i + 1);
+      }
+      offline_queue_len--;
+      return true;
+    }
+  }
+  return false;
+}
+
+// moves spilled frames back into the queue, oldest first, as it has room
+void MyMesh::unspillOfflineQueue() {
+  while (offline_queue_len < OFFLINE_QUEUE_SIZE && _store->getNumOfflineFrames() > 0) {
+    Frame& f = OFFLINE_QUEUE_AT(offline_queue_len);
+    int len = _store->takeOfflineFrame(f.buf);
+    if (len <= 0) break;
+    f.len = len;
+    offline_queue_len++;
+  }
+}
+
 void MyMesh::addToOfflineQueue(const uint8_t frame[], int len) {
   if (offline_queue_len >= OFFLINE_QUEUE_SIZE) {
+#if OFFLINE_QUEUE_FLASH_SIZE > 0
+    // newer than everything in the queue, so it goes to the end of the spilled frames
+    if (_store->getNumOfflineFrames() < OFFLINE_QUEUE_FLASH_SIZE && _store->appendOfflineFrame(frame, len)) return;
+#endif
     MESH_DEBUG_PRINTLN("WARN: offline_queue is full!");
-    int pos = 0;
-    while (pos < offline_queue_len) {
-      if (offline_queue[pos].isChannelMsg()) {
-        for (int i = pos; i < offline_queue_len - 1; i++) { // delete oldest channel msg from queue
-          offline_queue[i] = offline_queue[i + 1];
-        }
-        MESH_DEBUG_PRINTLN("INFO: removed oldest channel message from queue.");
-        offline_queue[offline_queue_len - 1].len = len;
-        memcpy(offline_queue[offline_queue_len - 1].buf, frame, len);
+    if (!removeOldestChannelMsg()) {
+      MESH_DEBUG_PRINTLN("INFO: no channel messages to remove from queue.");
+      return;
+    }
+    MESH_DEBUG_PRINTLN("INFO: removed oldest channel message from queue.");
+#if OFFLINE_QUEUE_FLASH_SIZE > 0
+    if (_store->getNumOfflineFrames() > 0) {   // older frames are spilled, so this goes after them
+      if (_store->appendOfflineFrame(frame, len)) {
+        unspillOfflineQueue();   // the freed slot takes the oldest spilled frame, keeping the order
         return;
       }
-      pos++;
+      MESH_DEBUG_PRINTLN("WARN: offline frame not spilled, keeping it in RAM (out of order)");
     }
-    MESH_DEBUG_PRINTLN("INFO: no channel messages to remove from queue.");
-  } else {
-    offline_queue[offline_queue_len].len = len;
-    memcpy(offline_queue[offline_queue_len].buf, frame, len);
-    offline_queue_len++;
+#endif
   }
+  Frame& f = OFFLINE_QUEUE_AT(offline_queue_len);
+  f.len = len;
+  memcpy(f.buf, frame, len);
+  offline_queue_len++;
 }
 
 int MyMesh::getFromOfflineQueue(uint8_t frame[]) {
   if (offline_queue_len > 0) {         // check offline queue
-    size_t len = offline_queue[0].len; // take from top of queue
-    memcpy(frame, offline_queue[0].buf, len);
+    Frame& f = offline_queue[offline_queue_head]; // take from top of queue
+    size_t len = f.len;
+    memcpy(frame, f.buf, len);
 
+    offline_queue_head = (offline_queue_head + 1) % OFFLINE_QUEUE_SIZE;
     offline_queue_len--;
-    for (int i = 0; i < offline_queue_len; i++) { // delete top item from queue
-      offline_queue[i] = offline_queue[i + 1];
-    }
+    unspillOfflineQueue();
     return len;
   }
   return 0; // queue is empty
 }
 
+// v10+: as many queued frames as fit, each prefixed by its length, then the number still queued
+int MyMesh::getBatchFromOfflineQueue(uint8_t frame[]) {
+  int i = 0;
+  frame[i++] = RESP_CODE_MSGS_BATCH;
+  i += 2;   // number still queued, after these
+  int n = 0;
+  while (offline_queue_len > 0 && i + 1 + offline_queue[offline_queue_head].len <= MAX_FRAME_SIZE) {
+    int len = getFromOfflineQueue(&frame[i + 1]);
+    frame[i] = len;
+    i += 1 + len;
+    n++;
+  }
+  if (n == 0) return 0; // queue is empty, or next frame is too big for a batch
+
+  uint16_t remaining = getOfflineQueueCount();
+  memcpy(&frame[1], &remaining, 2);
+  return i;
+}
+
 float MyMesh::getAirtimeBudgetFactor() const {
   return _prefs.airtime_factor;
 }
@@ -452,7 +561,7 @@ void MyMesh::queueMessage(const ContactInfo &from, uint8_t txt_type, mesh::Packe
   // we only want to show text messages on display, not cli data
   bool should_display = txt_type == TXT_TYPE_PLAIN || txt_type == TXT_TYPE_SIGNED_PLAIN;
   if (should_display && _ui) {
-    _ui->newMsg(path_len, from.name, text, offline_queue_len);
+    _ui->newMsg(path_len, from.name, text, getOfflineQueueCount());
     if (!_serial->isConnected()) {
       _ui->notify(UIEventType::contactMessage);
     }
@@ -556,7 +665,7 @@ void MyMesh::onChannelMessageRecv(const mesh::GroupChannel &channel, mesh::Packe
   if (getChannel(channel_idx, channel_details)) {
     channel_name = channel_details.name;
   }
-  if (_ui) _ui->newMsg(path_len, channel_name, text, offline_queue_len);
+  if (_ui) _ui->newMsg(path_len, channel_name, text, getOfflineQueueCount());
 #endif
 }
 
@@ -803,7 +912,7 @@ MyMesh::MyMesh(mesh::Radio &radio, mesh::RNG &rng, mesh::RTCClock &rtc, SimpleMe
       _serial(NULL), telemetry(MAX_PACKET_PAYLOAD - 4), _store(&store), _ui(ui) {
   _iter_started = false;
   _cli_rescue = false;
-  offline_queue_len = 0;
+  offline_queue_head = offline_queue_len = 0;
   app_target_ver = 0;
   clearPendingReqs();
   next_ack_idx = 0;
@@ -1075,6 +1184,10 @@ void MyMesh::handleCmdFrame(size_t len) {
       } else {
         _iter_filter_since = 0;
       }
+      uint16_t start_pos = 0;
+      if (len >= 7) { // v10+, has optional position to resume from (from a RESP_CODE_CONTACTS_BATCH)
+        memcpy(&start_pos, &cmd_frame[5], 2);
+      }
 
       uint8_t reply[5];
       reply[0] = RESP_CODE_CONTACTS_START;
@@ -1084,6 +1197,7 @@ void MyMesh::handleCmdFrame(size_t len) {
 
       // start iterator
       _iter = startContactsIterator();
+      _iter.setPosition(start_pos);
       _iter_started = true;
       _most_recent_lastmod = 0;
     }
@@ -1236,11 +1350,14 @@ void MyMesh::handleCmdFrame(size_t len) {
       writeErrFrame(ERR_CODE_ILLEGAL_ARG);
     }
   } else if (cmd_frame[0] == CMD_SYNC_NEXT_MESSAGE) {
-    int out_len;
-    if ((out_len = getFromOfflineQueue(out_frame)) > 0) {
+    int out_len = 0;
+    if (app_target_ver >= 10) {
+      out_len = getBatchFromOfflineQueue(out_frame);
+    }
+    if (out_len > 0 || (out_len = getFromOfflineQueue(out_frame)) > 0) {
       _serial->writeFrame(out_frame, out_len);
 #ifdef DISPLAY_CLASS
-      if (_ui) _ui->msgRead(offline_queue_len);
+      if (_ui) _ui->msgRead(getOfflineQueueCount());
 #endif
     } else {
       out_frame[0] = RESP_CODE_NO_MORE_MESSAGES;
@@ -1718,7 +1835,7 @@ void MyMesh::handleCmdFrame(size_t len) {
       out_frame[i++] = STATS_TYPE_CORE;
       uint16_t battery_mv = board.getBattMilliVolts();
       uint32_t uptime_secs = _ms->getMillis() / 1000;
-      uint8_t queue_len = (uint8_t)_mgr->getOutboundCount(0xFFFFFFFF);
+      uint8_t queue_len = (uint8_t)_mgr->getOutboundTotal();
       memcpy(&out_frame[i], &battery_mv, 2); i += 2;
       memcpy(&out_frame[i], &uptime_secs, 4); i += 4;
       memcpy(&out_frame[i], &_err_flags, 2); i += 2;
@@ -2014,7 +2131,9 @@ void MyMesh::checkSerialInterface() {
              && !_serial->isWriteBusy() // don't spam the Serial Interface too quickly!
   ) {
     ContactInfo contact;
-    if (_iter.hasNext(this, contact)) {
+    if (app_target_ver >= 10 && _iter.getPosition() < getNumContacts()) {
+      writeContactsBatchFrame();
+    } else if (_iter.hasNext(this, contact)) {
       if (contact.lastmod > _iter_filter_since) { // apply the 'since' filter
         writeContactRespFrame(RESP_CODE_CONTACT, contact);
         if (contact.lastmod > _most_recent_lastmod) {
@@ -2089,5 +2208,5 @@ bool MyMesh::advert() {
 
 // Check if there is pending work (packets to send)
 bool MyMesh::hasPendingWork() const {
-  return _mgr->getOutboundCount(0xFFFFFFFF) > 0;
+  return _mgr->getOutboundTotal() > 0;
 }
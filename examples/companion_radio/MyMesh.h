@@ -5,7 +5,7 @@
 #include "AbstractUITask.h"
 
 /*------------ Frame Protocol --------------*/
-#define FIRMWARE_VER_CODE 9
+#define FIRMWARE_VER_CODE 10
 
 #ifndef FIRMWARE_BUILD_DATE
 #define FIRMWARE_BUILD_DATE "15 Feb 2026"
@@ -55,14 +55,21 @@
 #define MAX_LORA_TX_POWER LORA_TX_POWER
 #endif
 
-#ifndef MAX_CONTACTS
-#define MAX_CONTACTS 100
-#endif
-
 #ifndef OFFLINE_QUEUE_SIZE
 #define OFFLINE_QUEUE_SIZE 16
 #endif
 
+// frames which don't fit in the offline queue are spilled to a log in flash, up to this many (0 = no spill)
+#ifndef OFFLINE_QUEUE_FLASH_SIZE
+  #if defined(STM32_PLATFORM) && !defined(EXTRAFS) && !defined(QSPIFLASH)
+    #define OFFLINE_QUEUE_FLASH_SIZE 0
+  #elif defined(NRF52_PLATFORM) && !defined(EXTRAFS) && !defined(QSPIFLASH)
+    #define OFFLINE_QUEUE_FLASH_SIZE 32    // ~5.6KB of InternalFS (the log is cleared once drained)
+  #else
+    #define OFFLINE_QUEUE_FLASH_SIZE 256
+  #endif
+#endif
+
 #ifndef BLE_NAME_PREFIX
 #define BLE_NAME_PREFIX "MeshCore-"
 #endif
@@ -157,6 +164,7 @@ protected:
   bool getChannelForSave(uint8_t channel_idx, ChannelDetails& ch) override { return getChannel(channel_idx, ch); }
   bool onNonceLoaded(const uint8_t* pub_key_prefix, uint16_t nonce) override { return applyLoadedNonce(pub_key_prefix, nonce); }
   bool getNonceForSave(int idx, uint8_t* pub_key_prefix, uint16_t* nonce) override { return getNonceEntry(idx, pub_key_prefix, nonce); }
+  bool isNonceChanged(int idx) override { return isNonceEntryChanged(idx); }
   bool onSessionKeyLoaded(const uint8_t* pub_key_prefix, uint8_t flags, uint16_t nonce,
                            const uint8_t* session_key, const uint8_t* prev_session_key) override {
     return applyLoadedSessionKey(pub_key_prefix, flags, nonce, session_key, prev_session_key);
@@ -181,9 +189,14 @@ private:
   void writeErrFrame(uint8_t err_code);
   void writeDisabledFrame();
   void writeContactRespFrame(uint8_t code, const ContactInfo &contact);
+  void writeContactsBatchFrame();
   void updateContactFromFrame(ContactInfo &contact, uint32_t& last_mod, const uint8_t *frame, int len);
   void addToOfflineQueue(const uint8_t frame[], int len);
   int getFromOfflineQueue(uint8_t frame[]);
+  int getBatchFromOfflineQueue(uint8_t frame[]);
+  bool removeOldestChannelMsg();
+  void unspillOfflineQueue();
+  int getOfflineQueueCount() const { return offline_queue_len + _store->getNumOfflineFrames(); }
   int getBlobByKey(const uint8_t key[], int key_len, uint8_t dest_buf[]) override { 
     return _store->getBlobByKey(key, key_len, dest_buf);
   }
@@ -243,8 +256,8 @@ private:
 
     bool isChannelMsg() const;
   };
-  int offline_queue_len;
-  Frame offline_queue[OFFLINE_QUEUE_SIZE];
+  int offline_queue_head, offline_queue_len;
+  Frame offline_queue[OFFLINE_QUEUE_SIZE];   // ring buffer, oldest at offline_queue_head
 
   struct AckTableEntry {
     unsigned long msg_sent;
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+static inline uint64_t benchNanos() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline void printBenchHeader(const char* title) {
+  printf("\n== %s ==\n", title);
+  printf("%-18s %10s %14s %12s\n", "name", "count", "ops/sec", "ns/op");
+}
+
+static inline void printBenchRow(const char* name, uint32_t count, uint64_t elapsed_ns) {
+  double ns_per = count ? (double)elapsed_ns / count : 0;
+  double per_sec = elapsed_ns ? count * 1e9 / elapsed_ns : 0;
+  printf("%-18s %10u %14.0f %12.1f\n", name, count, per_sec, ns_per);
+}
+
+// Suites -- each returns zero on success. 'scale' multiplies the default iteration counts.
+int runMeshBench(float scale);
+int runQueueBench(float scale);
+int runCryptoBench(float scale);
+int runBootBench(float scale);
@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include <Mesh.h>
+#include <helpers/ArduinoHelpers.h>
+#include <helpers/ClientACL.h>
+#include <helpers/RegionMap.h>
+#include <helpers/RecordReader.h>
+#include <helpers/host/HostFS.h>
+
+#include "BenchUtils.h"
+
+/*
+ * The file loads done at boot, from a scratch directory (HostFS standing in for the device filesystem):
+ *   acl          - ClientACL::load() of MAX_CLIENTS clients (which includes the ECDH for each shared secret)
+ *   regions      - RegionMap::load() of MAX_REGION_ENTRIES regions
+ *   contacts/... - decoding a full companion contacts file as DataStore::loadContacts() does, a whole record per
+ *                  read() then unpacked from memory: straight from the File, and through a RecordReader
+ * Each row is followed by the File::read() calls per load, which is what costs on LittleFS / InternalFileSystem,
+ * more so than the bytes read.
+ */
+
+#define BENCH_NUM_CONTACTS   350
+#define CONTACT_REC_SIZE     152
+
+#ifndef BENCH_FS_ROOT
+  #define BENCH_FS_ROOT  "/tmp/meshcore_bench"
+#endif
+
+static void printReadCalls(uint32_t calls, uint32_t count) {
+  printf("%-18s %10s %14s %12.1f\n", "  read() calls", "", "", count ? (double)calls / count : 0);
+}
+
+// same as DataStore::loadContacts() and its unpackContact()
+template <class R>
+static int decodeContacts(R& in) {
+  int n = 0;
+  uint8_t rec[CONTACT_REC_SIZE];
+  while (in.read(rec, CONTACT_REC_SIZE) == CONTACT_REC_SIZE) {
+    uint8_t pub_key[32], name[32], type, flags, out_path_len, out_path[64];
+    uint32_t sync_since, last_advert_timestamp, lastmod;
+    int32_t gps_lat, gps_lon;
+
+    memcpy(pub_key, &rec[0], 32);
+    memcpy(name, &rec[32], 32);
+    type = rec[64];
+    flags = rec[65];
+    memcpy(&sync_since, &rec[67], 4);
+    memcpy(&out_path_len, &rec[71], 1);
+    memcpy(&last_advert_timestamp, &rec[72], 4);
+    memcpy(out_path, &rec[76], 64);
+    memcpy(&lastmod, &rec[140], 4);
+    memcpy(&gps_lat, &rec[144], 4);
+    memcpy(&gps_lon, &rec[148], 4);
+    n += (type ^ flags ^ out_path_len ^ pub_key[0] ^ name[0] ^ out_path[0] ^ sync_since ^ last_advert_timestamp ^ lastmod
+          ^ gps_lat ^ gps_lon) != 0x1234567;   // (so the decode isn't optimised away)
+  }
+  return n;
+}
+
+int runBootBench(float scale) {
+  static HostFS fs(BENCH_FS_ROOT);
+  fs.format();
+
+  static StdRNG rng;
+  rng.begin(12345);
+  mesh::LocalIdentity self_id(&rng);
+
+  printBenchHeader("Boot loads");
+
+  // ACL
+  {
+    static ClientACL acl;
+    acl.load(&fs, self_id);
+    for (int i = 0; i < MAX_CLIENTS; i++) {
+      mesh::LocalIdentity client(&rng);
+      acl.applyPermissions(self_id, client.pub_key, PUB_KEY_SIZE, PERM_ACL_READ_WRITE);
+    }
+    acl.save(&fs);
+
+    uint32_t count = (uint32_t)(20 * scale);
+    if (count == 0) count = 1;
+    uint32_t calls = File::num_read_calls;
+    uint64_t t0 = benchNanos();
+    for (uint32_t i = 0; i < count; i++) {
+      acl.load(&fs, self_id);
+    }
+    printBenchRow("acl", count, benchNanos() - t0);
+    printReadCalls(File::num_read_calls - calls, count);
+    if (acl.getNumClients() != MAX_CLIENTS) printf("(acl load failed?)\n");
+  }
+
+  // regions
+  {
+    static TransportKeyStore key_store;
+    static RegionMap regions(key_store);
+    for (int i = 0; i < MAX_REGION_ENTRIES; i++) {
+      char name[16];
+      sprintf(name, "region-%d", i);
+      regions.putRegion(name, 0);
+    }
+    regions.save(&fs, "/boot_regions");
+
+    uint32_t count = (uint32_t)(2000 * scale);
+    if (count == 0) count = 1;
+    uint32_t calls = File::num_read_calls;
+    uint64_t t0 = benchNanos();
+    for (uint32_t i = 0; i < count; i++) {
+      regions.load(&fs, "/boot_regions");
+    }
+    printBenchRow("regions", count, benchNanos() - t0);
+    printReadCalls(File::num_read_calls - calls, count);
+  }
+
+  // companion contacts
+  {
+    File file = fs.open("/boot_contacts", "w", true);
+    uint8_t rec[CONTACT_REC_SIZE];
+    for (int i = 0; i < BENCH_NUM_CONTACTS; i++) {
+      rng.random(rec, sizeof(rec));
+      file.write(rec, sizeof(rec));
+    }
+    file.close();
+
+    uint32_t count = (uint32_t)(200 * scale);
+    if (count == 0) count = 1;
+    int n = 0;
+    for (int buffered = 0; buffered < 2; buffered++) {
+      uint32_t calls = File::num_read_calls;
+      uint64_t t0 = benchNanos();
+      for (uint32_t i = 0; i < count; i++) {
+        File f = fs.open("/boot_contacts");
+        if (buffered) {
+          RecordReader in(f);
+          n += decodeContacts(in);
+        } else {
+          n += decodeContacts(f);
+        }
+        f.close();
+      }
+      printBenchRow(buffered ? "contacts/buffered" : "contacts/direct", count, benchNanos() - t0);
+      printReadCalls(File::num_read_calls - calls, count);
+    }
+    if (n != 2 * count * BENCH_NUM_CONTACTS) printf("(contacts decode failed?)\n");
+  }
+  return 0;
+}
@@ -0,0 +1,151 @@
+#include "BenchUtils.h"
+#include <Utils.h>
+#include <SHA256.h>
+#include <AES.h>
+#include <Ed25519.h>
+#include <ed_25519.h>
+#include <ge.h>
+
+/*
+ * Crypto primitive costs, as used per packet:
+ *   hmac/*     - the 2-byte MAC check done for each trial decryption, with a fresh HMAC (resetHMAC() per call),
+ *                and via Utils::hmacSHA256() with the key's midstates cached
+ *   aes/*      - ECB encrypt then decrypt of a message (legacy peers and channels): with a fresh AES128 and key expansion
+ *                per call, via Utils::encrypt()/decrypt() with the key schedule cached, and with a prepared cipher
+ *                (Utils::getCipher()) used directly
+ *   ed25519/*  - advert signature checks, from a handful of repeating signers: with the Crypto library's
+ *                Ed25519::verify(), with ed25519_verify() decompressing the public key each time, and with
+ *                ed25519_verify_cached() (opt-in, ED25519_KEY_CACHE_SIZE) keeping recently used keys decompressed,
+ *                plus key generation (session key negotiation), signing (own adverts) and the ECDH key exchange
+ *                (per new contact, and ANON_REQ)
+ * The ed25519 rows depend on the field arithmetic backend (ED25519_FE51) and, for keypair and sign, on the size of
+ * the fixed-base table (ED25519_BASE_TABLE_ROWS), both shown in the header.
+ */
+
+#define BENCH_NUM_SIGNERS  8
+
+int runCryptoBench(float scale) {
+  char title[48];
+  sprintf(title, "Crypto (ed25519: %s, %d row base table)", ED25519_FE51 ? "fe51" : "ref10", ED25519_BASE_TABLE_ROWS);
+  printBenchHeader(title);
+
+  uint8_t key[PUB_KEY_SIZE], msg[64], mac[CIPHER_MAC_SIZE];
+  for (int i = 0; i < sizeof(key); i++) key[i] = i * 7 + 1;
+  memset(msg, 0x5A, sizeof(msg));
+
+  uint32_t count = (uint32_t)(200000 * scale);
+  uint64_t t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    msg[0] = i;
+    SHA256 sha;
+    sha.resetHMAC(key, sizeof(key));
+    sha.update(msg, sizeof(msg));
+    sha.finalizeHMAC(key, sizeof(key), mac, sizeof(mac));
+  }
+  printBenchRow("hmac/uncached", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    msg[0] = i;
+    mesh::Utils::hmacSHA256(mac, sizeof(mac), key, sizeof(key), msg, sizeof(msg));
+  }
+  printBenchRow("hmac/cached", count, benchNanos() - t0);
+
+  uint8_t enc[sizeof(msg)], dec[sizeof(msg)];
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    msg[0] = i;
+    AES128 aes;
+    aes.setKey(key, CIPHER_KEY_SIZE);
+    for (int b = 0; b < sizeof(msg); b += 16) aes.encryptBlock(&enc[b], &msg[b]);
+    AES128 aes2;
+    aes2.setKey(key, CIPHER_KEY_SIZE);
+    for (int b = 0; b < sizeof(msg); b += 16) aes2.decryptBlock(&dec[b], &enc[b]);
+  }
+  printBenchRow("aes/uncached", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    msg[0] = i;
+    mesh::Utils::encrypt(key, enc, msg, sizeof(msg));
+    mesh::Utils::decrypt(key, dec, enc, sizeof(enc));
+  }
+  printBenchRow("aes/cached", count, benchNanos() - t0);
+
+  AES128& cipher = mesh::Utils::getCipher(key);
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    msg[0] = i;
+    mesh::Utils::encrypt(cipher, enc, msg, sizeof(msg));
+    mesh::Utils::decrypt(cipher, dec, enc, sizeof(enc));
+  }
+  printBenchRow("aes/prepared", count, benchNanos() - t0);
+
+  if (memcmp(dec, msg, sizeof(msg)) != 0) {
+    printf("ERROR: aes round trip failed\n");
+    return 1;
+  }
+
+  uint8_t pub_keys[BENCH_NUM_SIGNERS][PUB_KEY_SIZE], prv_keys[BENCH_NUM_SIGNERS][PRV_KEY_SIZE];
+  uint8_t sigs[BENCH_NUM_SIGNERS][SIGNATURE_SIZE];
+  count = (uint32_t)(5000 * scale);
+  if (count == 0) count = 1;
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    int k = i % BENCH_NUM_SIGNERS;
+    uint8_t seed[32];
+    memset(seed, k + 1, sizeof(seed));
+    seed[0] = i;
+    ed25519_create_keypair(pub_keys[k], prv_keys[k], seed);
+  }
+  printBenchRow("ed25519/keypair", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    int k = i % BENCH_NUM_SIGNERS;
+    msg[0] = i;
+    ed25519_sign(sigs[k], msg, sizeof(msg), pub_keys[k], prv_keys[k]);
+  }
+  printBenchRow("ed25519/sign", count, benchNanos() - t0);
+
+  uint8_t secret[PUB_KEY_SIZE];
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    ed25519_key_exchange(secret, pub_keys[i % BENCH_NUM_SIGNERS], prv_keys[(i + 1) % BENCH_NUM_SIGNERS]);
+  }
+  printBenchRow("ed25519/exchange", count, benchNanos() - t0);
+
+  msg[0] = 0x5A;
+  for (int i = 0; i < BENCH_NUM_SIGNERS; i++) {
+    ed25519_sign(sigs[i], msg, sizeof(msg), pub_keys[i], prv_keys[i]);
+  }
+
+  uint32_t num_verified = 0;
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    int k = i % BENCH_NUM_SIGNERS;
+    num_verified += ed25519_verify(sigs[k], msg, sizeof(msg), pub_keys[k]);
+  }
+  printBenchRow("ed25519/verify", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    int k = i % BENCH_NUM_SIGNERS;
+    num_verified += Ed25519::verify(sigs[k], pub_keys[k], msg, sizeof(msg));
+  }
+  printBenchRow("ed25519/crypto", count, benchNanos() - t0);
+
+  ed25519_verify_cache_clear();
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    int k = i % BENCH_NUM_SIGNERS;
+    num_verified += ed25519_verify_cached(sigs[k], msg, sizeof(msg), pub_keys[k]);
+  }
+  printBenchRow("ed25519/cached", count, benchNanos() - t0);
+
+  if (num_verified != count*3) {
+    printf("ERROR: ed25519 signatures failed to verify (%u of %u)\n", num_verified, count*3);
+    return 1;
+  }
+  return 0;
+}
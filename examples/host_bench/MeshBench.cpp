@@ -0,0 +1,455 @@
+#include <Arduino.h>
+#include <Mesh.h>
+#include <helpers/ArduinoHelpers.h>
+#include <helpers/StaticPoolPacketManager.h>
+#include <helpers/SimpleMeshTables.h>
+#include <helpers/ClientACL.h>
+#include <helpers/RegionMap.h>
+#include <helpers/PubKeyIndex.h>
+#include <helpers/host/HostFS.h>
+#include <helpers/host/LoopbackRadio.h>
+
+#include "BenchUtils.h"
+
+/*
+ * Pushes synthetic packets of every PAYLOAD_TYPE_* through Mesh::onRecvPacket(), configured like a
+ * repeater (ClientACL peers, RegionMap flood filter, forwarding enabled), and reports throughput per type.
+ * Packets are built in batches outside of the timed section, so only receive processing is measured.
+ * With ACL_HOT_CLIENTS set below BENCH_NUM_CLIENTS, peer lookups page clients in and out of the ACL's flash file.
+ */
+
+#define BENCH_BATCH_SIZE    256
+#define BENCH_NUM_CLIENTS    16
+#define BENCH_NUM_REGIONS    32   // ie. MAX_REGION_ENTRIES
+#define BENCH_NUM_LOOKUP_KEYS  350   // eg. a full companion contacts table
+
+#ifndef BENCH_FS_ROOT
+  #define BENCH_FS_ROOT  "/tmp/meshcore_bench"
+#endif
+
+class BenchMesh : public mesh::Mesh {
+  ClientACL acl;
+  int matching_peer_indexes[MAX_CLIENTS];
+  mesh::GroupChannel channel;
+  RegionMap* region_map;
+  const RegionEntry* recv_pkt_region;
+
+protected:
+  bool allowPacketForward(const mesh::Packet* packet) override {
+    if (!forwarding) return false;
+    if (packet->isRouteFlood() && recv_pkt_region == NULL) return false;
+    return true;
+  }
+
+  bool filterRecvFloodPacket(mesh::Packet* pkt) override {
+    if (pkt->getRouteType() == ROUTE_TYPE_TRANSPORT_FLOOD) {
+      recv_pkt_region = region_map->findMatch(pkt, REGION_DENY_FLOOD);
+    } else if (pkt->getRouteType() == ROUTE_TYPE_FLOOD) {
+      recv_pkt_region = (region_map->getWildcard().flags & REGION_DENY_FLOOD) ? NULL : &region_map->getWildcard();
+    } else {
+      recv_pkt_region = NULL;
+    }
+    return false;
+  }
+
+  int searchPeersByHash(const uint8_t* hash) override {
+    return acl.findClientsByHash(hash, matching_peer_indexes, MAX_CLIENTS);
+  }
+  void getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) override {
+    auto c = acl.resolveClient(peer_idx, matching_peer_indexes);
+    if (c) memcpy(dest_secret, c->shared_secret, PUB_KEY_SIZE);
+  }
+  uint8_t getPeerFlags(int peer_idx) override {
+    auto c = acl.resolveClient(peer_idx, matching_peer_indexes);
+    return c ? c->flags : 0;
+  }
+  uint16_t getPeerNextAeadNonce(int peer_idx) override { return acl.peerNextAeadNonce(peer_idx, matching_peer_indexes); }
+  const uint8_t* getPeerSessionKey(int peer_idx) override { return acl.peerSessionKey(peer_idx, matching_peer_indexes); }
+  const uint8_t* getPeerPrevSessionKey(int peer_idx) override { return acl.peerPrevSessionKey(peer_idx, matching_peer_indexes); }
+  void onSessionKeyDecryptSuccess(int peer_idx) override { acl.peerSessionKeyDecryptSuccess(peer_idx, matching_peer_indexes); }
+  uint8_t getPeerDecodeHint(int peer_idx) override { return acl.peerDecodeHint(peer_idx, matching_peer_indexes); }
+  void setPeerDecodeHint(int peer_idx, uint8_t mode) override { acl.setPeerDecodeHint(peer_idx, matching_peer_indexes, mode); }
+  const uint8_t* getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) override {
+    return acl.peerEncryptionKey(peer_idx, matching_peer_indexes, static_secret);
+  }
+  uint16_t getPeerEncryptionNonce(int peer_idx) override { return acl.peerEncryptionNonce(peer_idx, matching_peer_indexes); }
+
+  int searchChannelsByHash(const uint8_t* hash, mesh::GroupChannel channels[], int max_matches) override {
+    if (channel.hash[0] == hash[0] && max_matches > 0) {
+      channels[0] = channel;
+      return 1;
+    }
+    return 0;
+  }
+
+  void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override { n_delivered++; }
+  bool onPeerPathRecv(mesh::Packet* packet, int sender_idx, const uint8_t* secret, uint8_t* path, uint8_t path_len, uint8_t extra_type, uint8_t* extra, uint8_t extra_len) override {
+    n_delivered++;
+    return false;
+  }
+  void onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id, uint32_t timestamp, const uint8_t* app_data, size_t app_data_len) override { n_delivered++; }
+  void onAnonDataRecv(mesh::Packet* packet, const uint8_t* secret, const mesh::Identity& sender, uint8_t* data, size_t len) override { n_delivered++; }
+  void onGroupDataRecv(mesh::Packet* packet, uint8_t type, const mesh::GroupChannel& channel, uint8_t* data, size_t len) override { n_delivered++; }
+  void onAckRecv(mesh::Packet* packet, uint32_t ack_crc) override { n_delivered++; }
+  void onTraceRecv(mesh::Packet* packet, uint32_t tag, uint32_t auth_code, uint8_t flags, const uint8_t* path_snrs, const uint8_t* path_hashes, uint8_t path_len) override { n_delivered++; }
+  void onControlDataRecv(mesh::Packet* packet) override { n_delivered++; }
+  void onRawDataRecv(mesh::Packet* packet) override { n_delivered++; }
+
+public:
+  bool forwarding;
+  uint32_t n_delivered, n_forwarded;
+
+  BenchMesh(mesh::Radio& radio, mesh::MillisecondClock& ms, mesh::RNG& rng, mesh::RTCClock& rtc, mesh::PacketManager& mgr, mesh::MeshTables& tables, RegionMap& regions)
+    : mesh::Mesh(radio, ms, rng, rtc, mgr, tables), region_map(&regions)
+  {
+    forwarding = true;
+    n_delivered = n_forwarded = 0;
+    recv_pkt_region = NULL;
+  }
+
+  void setup(HostFS& fs, mesh::RNG& rng, mesh::LocalIdentity clients[], int num_clients) {
+    acl.load(&fs, self_id);
+    acl.setRNG(&rng);
+    for (int i = 0; i < num_clients; i++) {
+      acl.applyPermissions(self_id, clients[i].pub_key, PUB_KEY_SIZE, PERM_ACL_READ_WRITE);
+    }
+    rng.random(channel.secret, sizeof(channel.secret));
+    memset(&channel.secret[16], 0, 16);   // 128-bit channel key, as per addChannel()
+    mesh::Utils::sha256(channel.hash, sizeof(channel.hash), channel.secret, 16);
+  }
+
+  const mesh::GroupChannel& getChannel() const { return channel; }
+  const ClientInfo* getClient(int idx) { return acl.getClientByIdx(idx); }
+  int getNumClients() const { return acl.getNumClients(); }
+
+  // same as Dispatcher::processRecvPacket(), but forwarded packets are released instead of queued
+  void process(mesh::Packet* pkt) {
+    mesh::DispatcherAction action = onRecvPacket(pkt);
+    if (action != ACTION_RELEASE && action != ACTION_MANUAL_HOLD) n_forwarded++;
+    if (action != ACTION_MANUAL_HOLD) releasePacket(pkt);
+  }
+
+  mesh::Packet* alloc() { return obtainNewPacket(); }
+};
+
+struct BenchType {
+  const char* name;
+  uint8_t type;
+  uint32_t count;   // default iterations
+};
+
+static const BenchType bench_types[] = {
+  { "REQ",            PAYLOAD_TYPE_REQ,        200000 },
+  { "RESPONSE",       PAYLOAD_TYPE_RESPONSE,   200000 },
+  { "TXT_MSG",        PAYLOAD_TYPE_TXT_MSG,    200000 },
+  { "ACK",            PAYLOAD_TYPE_ACK,       1000000 },
+  { "ADVERT",         PAYLOAD_TYPE_ADVERT,      10000 },
+  { "GRP_TXT",        PAYLOAD_TYPE_GRP_TXT,    200000 },
+  { "GRP_DATA",       PAYLOAD_TYPE_GRP_DATA,   200000 },
+  { "ANON_REQ",       PAYLOAD_TYPE_ANON_REQ,    10000 },
+  { "PATH",           PAYLOAD_TYPE_PATH,       200000 },
+  { "TRACE",          PAYLOAD_TYPE_TRACE,     1000000 },
+  { "MULTIPART",      PAYLOAD_TYPE_MULTIPART, 1000000 },
+  { "CONTROL",        PAYLOAD_TYPE_CONTROL,   1000000 },
+  { "RAW_CUSTOM",     PAYLOAD_TYPE_RAW_CUSTOM,1000000 },
+};
+
+#define NUM_BENCH_TYPES  (sizeof(bench_types) / sizeof(bench_types[0]))
+
+class PacketFactory {
+  BenchMesh* _mesh;
+  mesh::RNG* _rng;
+  mesh::LocalIdentity* _clients;
+  uint8_t anon_secrets[BENCH_NUM_CLIENTS][PUB_KEY_SIZE];
+  TransportKeyStore* _keys;
+  uint32_t seq;
+
+  void fillFloodPath(mesh::Packet* pkt) {
+    pkt->path_len = seq % 4;    // 0..3 hops
+    for (int i = 0; i < pkt->path_len; i++) {
+      pkt->path[i] = (uint8_t) (0x10 + i);
+    }
+  }
+
+public:
+  uint16_t region_id;
+  char region_name[32];
+
+  PacketFactory(BenchMesh& mesh, mesh::RNG& rng, mesh::LocalIdentity clients[], TransportKeyStore& keys)
+    : _mesh(&mesh), _rng(&rng), _clients(clients), _keys(&keys)
+  {
+    seq = 0;
+    region_id = 0;
+    region_name[0] = 0;
+    for (int i = 0; i < BENCH_NUM_CLIENTS; i++) {
+      clients[i].calcSharedSecret(anon_secrets[i], mesh.self_id);
+    }
+  }
+
+  void build(mesh::Packet* pkt, uint8_t type, bool transport) {
+    seq++;
+    uint8_t data[MAX_PACKET_PAYLOAD];
+    memcpy(data, &seq, 4);     // timestamp-like prefix keeps each packet unique
+    memset(&data[4], 'x', 28);
+    int data_len = 32;
+
+    pkt->header = (type << PH_TYPE_SHIFT) | ROUTE_TYPE_FLOOD;
+    pkt->transport_codes[0] = pkt->transport_codes[1] = 0;
+    pkt->_snr = 40;
+    fillFloodPath(pkt);
+
+    int len = 0;
+    switch (type) {
+      case PAYLOAD_TYPE_PATH:
+      case PAYLOAD_TYPE_REQ:
+      case PAYLOAD_TYPE_RESPONSE:
+      case PAYLOAD_TYPE_TXT_MSG: {
+        auto client = _mesh->getClient(seq % _mesh->getNumClients());
+        len += _mesh->self_id.copyHashTo(&pkt->payload[len]);   // dest hash
+        len += client->id.copyHashTo(&pkt->payload[len]);        // src hash
+        if (type == PAYLOAD_TYPE_PATH) {
+          data[0] = 2;   // path_len
+          data[1] = 0x21; data[2] = 0x22;
+          data[3] = 0xFF;  // extra_type
+          memcpy(&data[4], &seq, 4);
+          data_len = 8;
+        }
+        len += mesh::Utils::encryptThenMAC(client->shared_secret, &pkt->payload[len], data, data_len);
+        break;
+      }
+      case PAYLOAD_TYPE_ACK:
+        memcpy(pkt->payload, &seq, 4); len = 4;
+        break;
+      case PAYLOAD_TYPE_ADVERT: {
+        auto& id = _clients[seq % BENCH_NUM_CLIENTS];
+        memcpy(&pkt->payload[len], id.pub_key, PUB_KEY_SIZE); len += PUB_KEY_SIZE;
+        memcpy(&pkt->payload[len], &seq, 4); len += 4;   // timestamp
+        uint8_t* signature = &pkt->payload[len]; len += SIGNATURE_SIZE;
+        const char app_data[] = "\x81" "Bench Node";
+        int app_data_len = sizeof(app_data) - 1;
+        memcpy(&pkt->payload[len], app_data, app_data_len); len += app_data_len;
+
+        uint8_t message[PUB_KEY_SIZE + 4 + MAX_ADVERT_DATA_SIZE];
+        int msg_len = 0;
+        memcpy(&message[msg_len], id.pub_key, PUB_KEY_SIZE); msg_len += PUB_KEY_SIZE;
+        memcpy(&message[msg_len], &seq, 4); msg_len += 4;
+        memcpy(&message[msg_len], app_data, app_data_len); msg_len += app_data_len;
+        id.sign(signature, message, msg_len);
+        break;
+      }
+      case PAYLOAD_TYPE_GRP_TXT:
+      case PAYLOAD_TYPE_GRP_DATA: {
+        auto& ch = _mesh->getChannel();
+        memcpy(&pkt->payload[len], ch.hash, PATH_HASH_SIZE); len += PATH_HASH_SIZE;
+        len += mesh::Utils::encryptThenMAC(ch.secret, &pkt->payload[len], data, data_len);
+        break;
+      }
+      case PAYLOAD_TYPE_ANON_REQ: {
+        int k = seq % BENCH_NUM_CLIENTS;
+        len += _mesh->self_id.copyHashTo(&pkt->payload[len]);
+        memcpy(&pkt->payload[len], _clients[k].pub_key, PUB_KEY_SIZE); len += PUB_KEY_SIZE;
+        len += mesh::Utils::encryptThenMAC(anon_secrets[k], &pkt->payload[len], data, data_len);
+        break;
+      }
+      case PAYLOAD_TYPE_TRACE: {   // direct, with this node as the next hop
+        pkt->header = (type << PH_TYPE_SHIFT) | ROUTE_TYPE_DIRECT;
+        pkt->path_len = 0;   // SNRs collected so far
+        memcpy(&pkt->payload[len], &seq, 4); len += 4;   // tag
+        memset(&pkt->payload[len], 0, 4); len += 4;      // auth_code
+        pkt->payload[len++] = 0;   // flags
+        len += _mesh->self_id.copyHashTo(&pkt->payload[len]);
+        pkt->payload[len++] = 0x31;
+        pkt->payload[len++] = 0x32;
+        break;
+      }
+      case PAYLOAD_TYPE_MULTIPART:
+        pkt->payload[len++] = (1 << 4) | PAYLOAD_TYPE_ACK;
+        memcpy(&pkt->payload[len], &seq, 4); len += 4;
+        break;
+      case PAYLOAD_TYPE_CONTROL:   // zero-hop discovery style
+        pkt->header = (type << PH_TYPE_SHIFT) | ROUTE_TYPE_DIRECT;
+        pkt->path_len = 0;
+        pkt->payload[len++] = 0x80;
+        memcpy(&pkt->payload[len], &seq, 4); len += 4;
+        break;
+      case PAYLOAD_TYPE_RAW_CUSTOM:
+        pkt->header = (type << PH_TYPE_SHIFT) | ROUTE_TYPE_DIRECT;
+        pkt->path_len = 0;
+        memcpy(&pkt->payload[len], data, data_len); len += data_len;
+        break;
+    }
+    pkt->payload_len = len;
+
+    if (transport) {
+      pkt->header = (pkt->header & ~PH_ROUTE_MASK) | ROUTE_TYPE_TRANSPORT_FLOOD;
+      TransportKey key;
+      _keys->getAutoKeyFor(region_id, region_name, key);
+      pkt->transport_codes[0] = key.calcTransportCode(pkt);
+    }
+  }
+};
+
+static uint64_t runBatches(BenchMesh& mesh, PacketFactory& factory, uint8_t type, bool transport, uint32_t count) {
+  mesh::Packet* batch[BENCH_BATCH_SIZE];
+  uint64_t elapsed = 0;
+  uint32_t done = 0;
+  while (done < count) {
+    int n = count - done < BENCH_BATCH_SIZE ? count - done : BENCH_BATCH_SIZE;
+    for (int i = 0; i < n; i++) {
+      batch[i] = mesh.alloc();
+      factory.build(batch[i], type, transport);
+    }
+    uint64_t t0 = benchNanos();
+    for (int i = 0; i < n; i++) {
+      mesh.process(batch[i]);
+    }
+    elapsed += benchNanos() - t0;
+    done += n;
+  }
+  return elapsed;
+}
+
+struct BenchPeer {
+  uint8_t pub_key[PUB_KEY_SIZE];
+  uint8_t other[96];   // rest of a ContactInfo, roughly
+};
+
+// peer lookup by 1 byte hash, and by full key, as tables grow: linear scan vs PubKeyIndex
+static void runLookupBench(mesh::RNG& rng, float scale) {
+  static BenchPeer peers[BENCH_NUM_LOOKUP_KEYS];
+  static PubKeyIndex<BENCH_NUM_LOOKUP_KEYS> index(peers[0].pub_key, sizeof(BenchPeer));
+  for (int i = 0; i < BENCH_NUM_LOOKUP_KEYS; i++) {
+    rng.random(peers[i].pub_key, PUB_KEY_SIZE);
+    index.add(i);
+  }
+
+  char title[40];
+  sprintf(title, "peer lookup, %d entries", BENCH_NUM_LOOKUP_KEYS);
+  printBenchHeader(title);
+
+  uint32_t count = 1000000 * scale;
+  if (count == 0) count = 1;
+  int matches[8];
+  uint32_t found = 0;
+
+  uint64_t t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t hash = peers[i % BENCH_NUM_LOOKUP_KEYS].pub_key[0];
+    int n = 0;
+    for (int j = 0; j < BENCH_NUM_LOOKUP_KEYS && n < 8; j++) {
+      if (peers[j].pub_key[0] == hash) matches[n++] = j;
+    }
+    found += n;
+  }
+  printBenchRow("hash/linear", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    found += index.findByHash(peers[i % BENCH_NUM_LOOKUP_KEYS].pub_key[0], matches, 8);
+  }
+  printBenchRow("hash/indexed", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t* key = peers[(i * 7) % BENCH_NUM_LOOKUP_KEYS].pub_key;
+    for (int j = 0; j < BENCH_NUM_LOOKUP_KEYS; j++) {
+      if (memcmp(peers[j].pub_key, key, PUB_KEY_SIZE) == 0) { found++; break; }
+    }
+  }
+  printBenchRow("pubkey/linear", count, benchNanos() - t0);
+
+  t0 = benchNanos();
+  for (uint32_t i = 0; i < count; i++) {
+    if (index.find(peers[(i * 7) % BENCH_NUM_LOOKUP_KEYS].pub_key, PUB_KEY_SIZE) >= 0) found++;
+  }
+  printBenchRow("pubkey/indexed", count, benchNanos() - t0);
+
+  if (found == 0) printf("(no matches?)\n");   // also keeps the loops from being optimised away
+}
+
+int runMeshBench(float scale) {
+  static HostFS fs(BENCH_FS_ROOT);
+  fs.format();
+
+  static StdRNG rng;
+  rng.begin(12345);
+  static LoopbackRadio radio;
+  static ArduinoMillis ms;
+  static VolatileRTCClock rtc;
+  static StaticPoolPacketManager mgr(BENCH_BATCH_SIZE + 16);
+  static SimpleMeshTables tables;
+  static TransportKeyStore key_store;
+  static RegionKeyTable region_keys;
+  static RegionMap regions(key_store, &region_keys);
+  static BenchMesh mesh(radio, ms, rng, rtc, mgr, tables, regions);
+
+  mesh.self_id = mesh::LocalIdentity(&rng);
+  static mesh::LocalIdentity clients[BENCH_NUM_CLIENTS];
+  for (int i = 0; i < BENCH_NUM_CLIENTS; i++) {
+    clients[i] = mesh::LocalIdentity(&rng);
+  }
+  mesh.setup(fs, rng, clients, BENCH_NUM_CLIENTS);
+  mesh.begin();
+
+  // a full region map, all allowing floods, with packets coded for the last region (worst case for findMatch: past
+  // MAX_REGION_KEYS, so its key is looked up per packet)
+  RegionEntry* allowed = NULL;
+  for (int i = 0; i < BENCH_NUM_REGIONS; i++) {
+    char name[16];
+    sprintf(name, "region-%d", i);
+    allowed = regions.putRegion(name, 0);
+    allowed->flags = 0;
+  }
+
+  PacketFactory factory(mesh, rng, clients, key_store);
+  factory.region_id = allowed->id;
+  sprintf(factory.region_name, "#%s", allowed->name);
+
+  if (ACL_HOT_CLIENTS > 0) {
+    char title[64];
+    sprintf(title, "Mesh::onRecvPacket (ACL paged, %d of %d clients resident)", ACL_HOT_CLIENTS, BENCH_NUM_CLIENTS);
+    printBenchHeader(title);
+  } else {
+    printBenchHeader("Mesh::onRecvPacket");
+  }
+  for (int t = 0; t < NUM_BENCH_TYPES; t++) {
+    uint32_t count = bench_types[t].count * scale;
+    if (count == 0) count = 1;
+    uint64_t elapsed = runBatches(mesh, factory, bench_types[t].type, false, count);
+    printBenchRow(bench_types[t].name, count, elapsed);
+  }
+  {
+    uint32_t count = 200000 * scale;
+    if (count == 0) count = 1;
+    uint64_t elapsed = runBatches(mesh, factory, PAYLOAD_TYPE_GRP_TXT, true, count);
+    printBenchRow("GRP_TXT+region", count, elapsed);
+  }
+
+  // full receive path, from raw bytes through Dispatcher::loop()
+  {
+    printBenchHeader("Dispatcher::loop (raw RX)");
+    mesh.forwarding = false;
+    uint32_t count = 1000000 * scale;
+    if (count == 0) count = 1;
+    mesh::Packet tmp;
+    uint8_t raw[MAX_TRANS_UNIT];
+    uint64_t elapsed = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      factory.build(&tmp, PAYLOAD_TYPE_ACK, false);
+      int len = tmp.writeTo(raw);
+      radio.injectRaw(raw, len);
+
+      uint64_t t0 = benchNanos();
+      mesh.loop();
+      elapsed += benchNanos() - t0;
+    }
+    printBenchRow("ACK (raw)", count, elapsed);
+    mesh.forwarding = true;
+  }
+
+  runLookupBench(rng, scale);
+
+  printf("\ndelivered=%u forwarded=%u free=%d  anon secrets: hits=%u misses=%u\n", mesh.n_delivered, mesh.n_forwarded, mgr.getFreeCount(),
+         mesh.getNumAnonSecretHits(), mesh.getNumAnonSecretMisses());
+  return 0;
+}
@@ -0,0 +1,73 @@
+#include "BenchUtils.h"
+#include <helpers/StaticPoolPacketManager.h>
+#include <helpers/ArduinoHelpers.h>
+
+/*
+ * PacketQueue costs, at various pool sizes:
+ *   poll     - Dispatcher::checkSend() asking for the due count every loop, while everything queued is in the future
+ *   add+get  - steady state of queueing packets with random delays, and taking them as they fall due
+ *   alloc+free - StaticPoolPacketManager taking and returning packets, with a quarter of the pool held
+ */
+
+static const int queue_sizes[] = { 16, 32, 128, 256 };
+
+int runQueueBench(float scale) {
+  printBenchHeader("PacketQueue");
+
+  srandom(12345);
+  for (int s = 0; s < sizeof(queue_sizes) / sizeof(queue_sizes[0]); s++) {
+    int size = queue_sizes[s];
+    mesh::Packet* packets = new mesh::Packet[size];
+    PacketQueue q(size);
+    uint32_t now = 1000;
+    char name[32];
+
+    // poll
+    for (int i = 0; i < size * 3 / 4; i++) {
+      q.add(&packets[i], random(0, 4), now + 1000 + random(0, 5000));
+    }
+    uint32_t count = (uint32_t)(5000000 * scale);
+    int sink = 0;
+    uint64_t t0 = benchNanos();
+    for (uint32_t i = 0; i < count; i++) {
+      sink += q.countBefore(now + (i & 0x1FF));
+    }
+    sprintf(name, "poll/%d", size);
+    printBenchRow(name, count, benchNanos() - t0);
+    while (q.count() > 0) q.removeByIdx(0);
+
+    // add+get
+    int next = 0;
+    for (int i = 0; i < size / 2; i++) {
+      q.add(&packets[next++], random(0, 4), now + random(0, 2000));
+    }
+    count = (uint32_t)(1000000 * scale);
+    t0 = benchNanos();
+    for (uint32_t i = 0; i < count; i++) {
+      mesh::Packet* pkt;
+      while ((pkt = q.get(now)) != NULL) {
+        q.add(pkt, i & 3, now + (i * 7919) % 2000);   // re-queue, keeps occupancy steady
+      }
+      now += 4;
+    }
+    sprintf(name, "add+get/%d", size);
+    printBenchRow(name, count, benchNanos() - t0);
+
+    if (sink < 0) printf("%d\n", sink);   // keep the poll loop from being optimised away
+    delete[] packets;
+
+    // alloc+free
+    StaticPoolPacketManager mgr(size);
+    mesh::Packet* held[4];
+    for (int i = 0; i < size / 4; i++) mgr.allocNew();
+    count = (uint32_t)(5000000 * scale);
+    t0 = benchNanos();
+    for (uint32_t i = 0; i < count; i++) {
+      for (int j = 0; j < 4; j++) held[j] = mgr.allocNew();
+      for (int j = 0; j < 4; j++) mgr.free(held[j]);
+    }
+    sprintf(name, "alloc+free/%d", size);
+    printBenchRow(name, count * 4, benchNanos() - t0);
+  }
+  return 0;
+}
@@ -0,0 +1,47 @@
+#include <Arduino.h>
+#include "BenchUtils.h"
+
+/*
+ * Host benchmark harness, for profiling the mesh stack on a workstation.
+ *
+ *   usage:  host_bench [suite] [scale]
+ *
+ *   suite   one of the names below, or 'all' (default)
+ *   scale   multiplier for the default iteration counts (default 1.0)
+ */
+
+struct BenchSuite {
+  const char* name;
+  int (*run)(float scale);
+};
+
+static const BenchSuite suites[] = {
+  { "mesh", runMeshBench },
+  { "queue", runQueueBench },
+  { "crypto", runCryptoBench },
+  { "boot", runBootBench },
+};
+
+#define NUM_SUITES  (sizeof(suites) / sizeof(suites[0]))
+
+int main(int argc, char* argv[]) {
+  const char* which = argc > 1 ? argv[1] : "all";
+  float scale = argc > 2 ? atof(argv[2]) : 1.0f;
+  if (scale <= 0) scale = 1.0f;
+
+  int err = 0;
+  bool found = false;
+  for (int i = 0; i < NUM_SUITES; i++) {
+    if (strcmp(which, "all") == 0 || strcmp(which, suites[i].name) == 0) {
+      found = true;
+      err |= suites[i].run(scale);
+    }
+  }
+  if (!found) {
+    printf("unknown suite: %s\n  available: all", which);
+    for (int i = 0; i < NUM_SUITES; i++) printf(", %s", suites[i].name);
+    printf("\n");
+    return 1;
+  }
+  return err;
+}
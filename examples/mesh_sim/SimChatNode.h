@@ -0,0 +1,129 @@
+#pragma once
+
+#include <helpers/BaseChatMesh.h>
+#include "SimTracker.h"
+
+#define SEND_TIMEOUT_BASE_MILLIS          500
+#define FLOOD_SEND_TIMEOUT_FACTOR         16.0f
+#define DIRECT_SEND_PERHOP_FACTOR         6.0f
+#define DIRECT_SEND_PERHOP_EXTRA_MILLIS   250
+
+#define  PUBLIC_GROUP_PSK  "izOH6cXN6mrJ5e26oRXNcg=="
+
+#define MAX_PENDING_ACKS   8
+
+/**
+ * \brief  Minimal BaseChatMesh companion, driven by the simulator instead of a UI.
+*/
+class SimChatNode : public BaseChatMesh {
+  struct PendingAck {
+    uint32_t crc;
+    uint8_t pub_key_prefix[4];
+  };
+  SimTracker* _tracker;
+  int _node_idx;
+  char _name[32];
+  ChannelDetails* _public;
+  PendingAck _pending_acks[MAX_PENDING_ACKS];
+  int _next_ack_idx;
+
+protected:
+  void onDiscoveredContact(ContactInfo& contact, bool is_new, uint8_t path_len, const uint8_t* path) override { }
+  void onContactPathUpdated(const ContactInfo& contact) override { }
+
+  ContactInfo* processAck(const uint8_t *data) override {
+    uint32_t crc;
+    memcpy(&crc, data, 4);
+    for (int i = 0; i < MAX_PENDING_ACKS; i++) {
+      auto a = &_pending_acks[i];
+      if (a->crc != 0 && a->crc == crc) {
+        a->crc = 0;
+        _tracker->onAck(crc, _ms->getMillis());
+        return lookupContactByPubKey(a->pub_key_prefix, sizeof(a->pub_key_prefix));
+      }
+    }
+    return NULL;
+  }
+
+  void onMessageRecv(const ContactInfo& from, mesh::Packet* pkt, uint32_t sender_timestamp, const char *text) override {
+    _tracker->onDelivered(text, _node_idx, _ms->getMillis());
+  }
+  void onCommandDataRecv(const ContactInfo& from, mesh::Packet* pkt, uint32_t sender_timestamp, const char *text) override { }
+  void onSignedMessageRecv(const ContactInfo& from, mesh::Packet* pkt, uint32_t sender_timestamp, const uint8_t *sender_prefix, const char *text) override { }
+
+  void onChannelMessageRecv(const mesh::GroupChannel& channel, mesh::Packet* pkt, uint32_t timestamp, const char *text) override {
+    _tracker->onDelivered(text, _node_idx, _ms->getMillis());
+  }
+
+  uint8_t onContactRequest(const ContactInfo& contact, uint32_t sender_timestamp, const uint8_t* data, uint8_t len, uint8_t* reply) override {
+    return 0;  // unknown
+  }
+  void onContactResponse(const ContactInfo& contact, const uint8_t* data, uint8_t len) override { }
+
+  uint32_t calcFloodTimeoutMillisFor(uint32_t pkt_airtime_millis, uint8_t attempt = 0) const override {
+    return (SEND_TIMEOUT_BASE_MILLIS + (FLOOD_SEND_TIMEOUT_FACTOR * pkt_airtime_millis)) * (attempt + 1);
+  }
+  uint32_t calcDirectTimeoutMillisFor(uint32_t pkt_airtime_millis, uint8_t path_len) const override {
+    return SEND_TIMEOUT_BASE_MILLIS +
+         ( (pkt_airtime_millis*DIRECT_SEND_PERHOP_FACTOR + DIRECT_SEND_PERHOP_EXTRA_MILLIS) * (path_len + 1));
+  }
+  void onSendTimeout() override { }
+
+public:
+  SimChatNode(mesh::Radio& radio, mesh::MillisecondClock& ms, mesh::RNG& rng, mesh::RTCClock& rtc,
+              mesh::PacketManager& mgr, mesh::MeshTables& tables, SimTracker& tracker, int node_idx)
+     : BaseChatMesh(radio, ms, rng, rtc, mgr, tables), _tracker(&tracker), _node_idx(node_idx)
+  {
+    sprintf(_name, "chat-%d", node_idx);
+    _public = NULL;
+    memset(_pending_acks, 0, sizeof(_pending_acks));
+    _next_ack_idx = 0;
+  }
+
+  void begin() {
+    BaseChatMesh::begin();
+    _public = addChannel("Public", PUBLIC_GROUP_PSK);
+  }
+
+  const char* getName() const { return _name; }
+  int getNodeIdx() const { return _node_idx; }
+
+  bool hasPendingWork() const {
+    return _mgr->getOutboundTotal() > 0;
+  }
+
+  bool addPeer(const SimChatNode& peer) {
+    ContactInfo c;
+    memset(&c, 0, sizeof(c));
+    c.id = peer.self_id;
+    strcpy(c.name, peer._name);
+    c.type = ADV_TYPE_CHAT;
+    c.out_path_len = -1;   // no path yet, so first message will flood
+    return addContact(c);
+  }
+
+  bool sendChannelMsg(uint32_t msg_id) {
+    char text[24];
+    SimTracker::formatText(text, msg_id);
+    return sendGroupMessage(getRTCClock()->getCurrentTimeUnique(), _public->channel, _name, text, strlen(text));
+  }
+
+  bool sendDirectMsg(int contact_idx, uint32_t msg_id) {
+    ContactInfo c;
+    if (!getContactByIdx(contact_idx, c)) return false;
+    ContactInfo* recipient = lookupContactByPubKey(c.id.pub_key, PUB_KEY_SIZE);
+
+    char text[24];
+    SimTracker::formatText(text, msg_id);
+    uint32_t expected_ack, est_timeout;
+    int result = sendMessage(*recipient, getRTCClock()->getCurrentTimeUnique(), 0, text, expected_ack, est_timeout);
+    if (result == MSG_SEND_FAILED) return false;
+
+    auto a = &_pending_acks[_next_ack_idx];
+    _next_ack_idx = (_next_ack_idx + 1) % MAX_PENDING_ACKS;
+    a->crc = expected_ack;
+    memcpy(a->pub_key_prefix, recipient->id.pub_key, sizeof(a->pub_key_prefix));
+    _tracker->setExpectedAck(msg_id, expected_ack);
+    return true;
+  }
+};
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <vector>
+#include <unordered_set>
+#include <algorithm>
+
+#define SIM_MSG_CHANNEL   0
+#define SIM_MSG_DIRECT    1
+
+#define SIM_MSG_TAG       "#sim"
+
+/**
+ * \brief  Records every application message the simulator injects, and when (and where) each one arrives.
+ *        Messages are identified by a "#sim<id>" tag in their text.
+*/
+class SimTracker {
+  struct Message {
+    uint8_t kind;   // SIM_MSG_*
+    uint16_t sender;
+    unsigned long sent_at;
+    uint32_t expected, delivered;
+    uint32_t expected_ack;
+    bool acked;
+  };
+  std::vector<Message> _msgs;
+  std::unordered_set<uint64_t> _deliveries;   // (msg id, node)
+  std::vector<uint32_t> _latency[2], _ack_latency;
+
+  static uint32_t percentile(std::vector<uint32_t>& v, int pct) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[(v.size() - 1) * pct / 100];
+  }
+
+public:
+  struct Summary {
+    uint32_t n_sent, n_expected, n_delivered, n_acked;
+    uint32_t lat_mean, lat_p50, lat_p95, lat_max;
+    uint32_t ack_p50, ack_p95;
+  };
+
+  uint32_t newMessage(uint8_t kind, int sender, unsigned long now, uint32_t expected_recipients) {
+    Message m;
+    memset(&m, 0, sizeof(m));
+    m.kind = kind;
+    m.sender = sender;
+    m.sent_at = now;
+    m.expected = expected_recipients;
+    _msgs.push_back(m);
+    return _msgs.size() - 1;
+  }
+
+  void setExpectedAck(uint32_t id, uint32_t ack_crc) { _msgs[id].expected_ack = ack_crc; }
+
+  static void formatText(char* dest, uint32_t id) { sprintf(dest, SIM_MSG_TAG "%u", id); }
+
+  /**
+   * \returns  the message id tagged in 'text', or -1
+  */
+  static int parseText(const char* text) {
+    const char* sp = strstr(text, SIM_MSG_TAG);
+    return sp ? atoi(sp + strlen(SIM_MSG_TAG)) : -1;
+  }
+
+  void onDelivered(const char* text, int node, unsigned long now) {
+    int id = parseText(text);
+    if (id < 0 || id >= (int)_msgs.size()) return;
+    if (!_deliveries.insert(((uint64_t)id << 16) | node).second) return;   // already counted (eg. retry)
+
+    auto& m = _msgs[id];
+    m.delivered++;
+    _latency[m.kind].push_back(now - m.sent_at);
+  }
+
+  bool onAck(uint32_t ack_crc, unsigned long now) {
+    for (auto& m : _msgs) {
+      if (m.kind == SIM_MSG_DIRECT && !m.acked && m.expected_ack == ack_crc) {
+        m.acked = true;
+        _ack_latency.push_back(now - m.sent_at);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Summary summarise(uint8_t kind) {
+    Summary s;
+    memset(&s, 0, sizeof(s));
+    for (auto& m : _msgs) {
+      if (m.kind != kind) continue;
+      s.n_sent++;
+      s.n_expected += m.expected;
+      s.n_delivered += m.delivered;
+      if (m.acked) s.n_acked++;
+    }
+    auto& lat = _latency[kind];
+    if (!lat.empty()) {
+      uint64_t total = 0;
+      for (auto t : lat) total += t;
+      s.lat_mean = total / lat.size();
+      s.lat_p50 = percentile(lat, 50);
+      s.lat_p95 = percentile(lat, 95);
+      s.lat_max = lat.back();   // sorted by percentile()
+    }
+    if (kind == SIM_MSG_DIRECT) {
+      s.ack_p50 = percentile(_ack_latency, 50);
+      s.ack_p95 = percentile(_ack_latency, 95);
+    }
+    return s;
+  }
+};
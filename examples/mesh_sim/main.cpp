@@ -0,0 +1,366 @@
+#include <Arduino.h>
+#include <Mesh.h>
+#include <math.h>
+#include <time.h>
+#include <vector>
+
+#include "../simple_repeater/MyMesh.h"
+#include "SimChatNode.h"
+#include "SimTracker.h"
+#include <helpers/host/SimMedium.h>
+
+/*
+ *  Discrete event simulation of a whole mesh, running real repeater (simple_repeater MyMesh) and chat
+ *  (BaseChatMesh) instances on one virtual clock, connected through a SimMedium link graph.
+ *
+ *  usage:  mesh_sim [option=value ...]
+ *    nodes=100        total nodes
+ *    chat=10          how many of those are chat nodes (the rest are repeaters)
+ *    topo=random      random | grid | line | file:<path>   (file lines are: <node_a> <node_b> <snr> [loss])
+ *    spacing=1.5      km between grid/line neighbours, or mean spacing for random
+ *    range=4          km at which SNR reaches the demodulation threshold
+ *    loss=0.02        base per-link frame loss probability
+ *    sf=11 bw=250 cr=5
+ *    duration=600     virtual seconds to simulate
+ *    msgs=50          application messages to inject, spread over the run
+ *    direct=0.5       fraction of messages that are direct (the rest are 'Public' channel floods)
+ *    txdelay=         repeater 'set txdelay'
+ *    direct.txdelay=  repeater 'set direct.txdelay'
+ *    flood.max=       repeater 'set flood.max'
+ *    cmd=<cli cmd>    any other repeater CLI command, applied to all repeaters (may be repeated)
+ *    pool=16          chat node packet pool size (repeaters use PACKET_POOL_SIZE)
+ *    tick=1           virtual millis per step while anything is in the air, or due
+ *    seed=1
+ *    verbose=0
+ */
+
+#define SIM_FS_ROOT        "/tmp/meshcore_sim"
+#define SIM_IDLE_STEP      1000     // max millis to jump ahead when nothing is in the air
+
+struct SimConfig {
+  int nodes, chat;
+  const char* topo;
+  float spacing, range, loss;
+  int sf, cr;
+  float bw;
+  uint32_t duration_secs;
+  int msgs;
+  float direct_fraction;
+  std::vector<const char*> repeater_cmds;
+  int pool;
+  int tick;
+  uint32_t seed;
+  bool verbose;
+};
+
+struct SimNode {
+  SimRadio* radio;
+  HostFS* fs;
+  RepeaterMeshTables* tables;
+  MyMesh* repeater;
+  SimChatNode* chat;
+  float x, y;   // km
+
+  mesh::Mesh* mesh() const { return repeater ? (mesh::Mesh*)repeater : (mesh::Mesh*)chat; }
+};
+
+struct SimEvent {
+  unsigned long at;
+  int sender;
+  bool direct;
+};
+
+static VirtualMillisClock sim_clock;
+
+static unsigned long simMillis() {
+  return sim_clock.getMillis();
+}
+
+static bool parseOption(SimConfig& cfg, const char* arg) {
+  const char* eq = strchr(arg, '=');
+  if (eq == NULL) return false;
+  int klen = eq - arg;
+  const char* v = eq + 1;
+  char cmd[80];
+
+  #define IS_KEY(k)  (klen == (int)strlen(k) && memcmp(arg, k, klen) == 0)
+  if (IS_KEY("nodes")) cfg.nodes = atoi(v);
+  else if (IS_KEY("chat")) cfg.chat = atoi(v);
+  else if (IS_KEY("topo")) cfg.topo = v;
+  else if (IS_KEY("spacing")) cfg.spacing = atof(v);
+  else if (IS_KEY("range")) cfg.range = atof(v);
+  else if (IS_KEY("loss")) cfg.loss = atof(v);
+  else if (IS_KEY("sf")) cfg.sf = atoi(v);
+  else if (IS_KEY("bw")) cfg.bw = atof(v);
+  else if (IS_KEY("cr")) cfg.cr = atoi(v);
+  else if (IS_KEY("duration")) cfg.duration_secs = atol(v);
+  else if (IS_KEY("msgs")) cfg.msgs = atoi(v);
+  else if (IS_KEY("direct")) cfg.direct_fraction = atof(v);
+  else if (IS_KEY("pool")) cfg.pool = atoi(v);
+  else if (IS_KEY("tick")) cfg.tick = atoi(v);
+  else if (IS_KEY("seed")) cfg.seed = atol(v);
+  else if (IS_KEY("verbose")) cfg.verbose = atoi(v) != 0;
+  else if (IS_KEY("cmd")) cfg.repeater_cmds.push_back(strdup(v));
+  else if (IS_KEY("txdelay") || IS_KEY("direct.txdelay") || IS_KEY("flood.max")) {
+    snprintf(cmd, sizeof(cmd), "set %.*s %s", klen, arg, v);
+    cfg.repeater_cmds.push_back(strdup(cmd));
+  } else {
+    return false;
+  }
+  #undef IS_KEY
+  return true;
+}
+
+// log-distance model (exponent 3), anchored so that SNR == demod threshold at 'range' km
+static float calcLinkSNR(const SimConfig& cfg, float dist_km) {
+  if (dist_km < 0.01f) dist_km = 0.01f;
+  return SimRadio::getSNRThreshold(cfg.sf) + 30.0f * log10f(cfg.range / dist_km);
+}
+
+// frames close to the threshold fade more often
+static float calcLinkLoss(const SimConfig& cfg, float snr) {
+  float margin = snr - SimRadio::getSNRThreshold(cfg.sf);
+  float loss = cfg.loss;
+  if (margin < 3.0f) loss += (3.0f - margin) / 3.0f * 0.5f;
+  return loss > 1.0f ? 1.0f : loss;
+}
+
+static float randomUnit() {
+  return random(0, 1000000) / 1000000.0f;
+}
+
+static int buildTopology(const SimConfig& cfg, SimMedium& medium, std::vector<SimNode>& nodes) {
+  int n = nodes.size();
+  if (memcmp(cfg.topo, "file:", 5) == 0) {
+    FILE* f = fopen(&cfg.topo[5], "r");
+    if (f == NULL) {
+      printf("ERROR: can't open link file: %s\n", &cfg.topo[5]);
+      return -1;
+    }
+    char line[128];
+    int num = 0;
+    while (fgets(line, sizeof(line), f)) {
+      int a, b;
+      float snr, loss = cfg.loss;
+      if (line[0] == '#' || sscanf(line, "%d %d %f %f", &a, &b, &snr, &loss) < 3) continue;
+      if (a < 0 || b < 0 || a >= n || b >= n || a == b) continue;
+      medium.connect(a, b, snr, loss);
+      num++;
+    }
+    fclose(f);
+    return num * 2;
+  }
+
+  if (strcmp(cfg.topo, "line") == 0) {
+    for (int i = 0; i < n; i++) { nodes[i].x = i * cfg.spacing; nodes[i].y = 0; }
+  } else if (strcmp(cfg.topo, "grid") == 0) {
+    int cols = (int) ceilf(sqrtf(n));
+    for (int i = 0; i < n; i++) { nodes[i].x = (i % cols) * cfg.spacing; nodes[i].y = (i / cols) * cfg.spacing; }
+  } else {   // random
+    float side = sqrtf(n) * cfg.spacing;
+    for (int i = 0; i < n; i++) { nodes[i].x = randomUnit() * side; nodes[i].y = randomUnit() * side; }
+  }
+
+  int num = 0;
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) {
+      float dx = nodes[i].x - nodes[j].x, dy = nodes[i].y - nodes[j].y;
+      float snr = calcLinkSNR(cfg, sqrtf(dx*dx + dy*dy));
+      if (snr < SimRadio::getSNRThreshold(cfg.sf) - 3.0f) continue;   // too far to matter
+      medium.connect(i, j, snr, calcLinkLoss(cfg, snr));
+      num += 2;
+    }
+  }
+  return num;
+}
+
+static bool isChatIdx(const SimConfig& cfg, int i) {
+  if (cfg.chat <= 0) return false;
+  int stride = cfg.nodes / cfg.chat;
+  return stride > 0 && i % stride == 0 && i / stride < cfg.chat;
+}
+
+static mesh::LocalIdentity newIdentity(mesh::RNG& rng) {
+  mesh::LocalIdentity id(&rng);
+  while (id.pub_key[0] == 0x00 || id.pub_key[0] == 0xFF) {  // reserved id hashes
+    id = mesh::LocalIdentity(&rng);
+  }
+  return id;
+}
+
+int main(int argc, char* argv[]) {
+  SimConfig cfg;
+  cfg.nodes = 100; cfg.chat = 10;
+  cfg.topo = "random";
+  cfg.spacing = 1.5f; cfg.range = 4.0f; cfg.loss = 0.02f;
+  cfg.sf = 11; cfg.bw = 250.0f; cfg.cr = 5;
+  cfg.duration_secs = 600;
+  cfg.msgs = 50;
+  cfg.direct_fraction = 0.5f;
+  cfg.pool = 16;
+  cfg.tick = 1;
+  cfg.seed = 1;
+  cfg.verbose = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (!parseOption(cfg, argv[i])) {
+      printf("unknown option: %s  (see examples/mesh_sim/main.cpp for usage)\n", argv[i]);
+      return 1;
+    }
+  }
+  if (cfg.chat > cfg.nodes) cfg.chat = cfg.nodes;
+  if (cfg.tick < 1) cfg.tick = 1;
+
+  setHostMillisSource(simMillis);   // millis() used directly by some firmware code, must also be virtual
+  rtc_clock.setCurrentTime(1715770351);
+  srandom(cfg.seed);
+
+  StdRNG rng;
+  SimMedium medium(sim_clock, cfg.seed);
+  SimTracker tracker;
+  std::vector<SimNode> nodes(cfg.nodes);
+  std::vector<SimChatNode*> chats;
+
+  for (int i = 0; i < cfg.nodes; i++) {
+    auto& n = nodes[i];
+    n.radio = new SimRadio(medium, cfg.sf, cfg.bw, cfg.cr);
+    n.tables = new RepeaterMeshTables();
+    n.fs = new HostFS();
+    char root[64];
+    sprintf(root, SIM_FS_ROOT "/n%d", i);
+    n.fs->begin(root);
+    n.fs->format();   // each run starts from factory state
+
+    if (isChatIdx(cfg, i)) {
+      n.repeater = NULL;
+      n.chat = new SimChatNode(*n.radio, sim_clock, rng, rtc_clock, *new StaticPoolPacketManager(cfg.pool), *n.tables, tracker, i);
+      n.chat->self_id = newIdentity(rng);
+      n.chat->begin();
+      chats.push_back(n.chat);
+    } else {
+      n.chat = NULL;
+      n.repeater = new MyMesh(board, *n.radio, sim_clock, rng, rtc_clock, *n.tables);
+      n.repeater->self_id = newIdentity(rng);
+      n.repeater->begin(n.fs);
+
+      char cmd[96], reply[160];
+      sprintf(cmd, "set name rpt-%d", i);
+      n.repeater->handleCommand(0, cmd, reply);
+      for (auto c : cfg.repeater_cmds) {
+        strncpy(cmd, c, sizeof(cmd) - 1); cmd[sizeof(cmd) - 1] = 0;
+        reply[0] = 0;
+        n.repeater->handleCommand(0, cmd, reply);
+        if (cfg.verbose && i == 0) printf("rpt-0: %s -> %s\n", c, reply);
+      }
+    }
+  }
+
+  // every chat node knows (up to MAX_CONTACTS of) the others, but has no paths yet
+  for (auto c : chats) {
+    for (auto peer : chats) {
+      if (peer != c && !c->addPeer(*peer)) break;
+    }
+  }
+
+  int num_links = buildTopology(cfg, medium, nodes);
+  if (num_links < 0) return 1;
+
+  // schedule application traffic, over the middle of the run (so floods have time to settle)
+  std::vector<SimEvent> events;
+  unsigned long duration_ms = cfg.duration_secs * 1000UL;
+  if (chats.size() > 0) {
+    unsigned long start = duration_ms / 10, span = duration_ms * 7 / 10;
+    for (int i = 0; i < cfg.msgs; i++) {
+      SimEvent e;
+      e.at = start + (unsigned long)(randomUnit() * span);
+      e.sender = random(0, chats.size());
+      e.direct = chats.size() > 1 && randomUnit() < cfg.direct_fraction;
+      events.push_back(e);
+    }
+    std::sort(events.begin(), events.end(), [](const SimEvent& a, const SimEvent& b) { return a.at < b.at; });
+  }
+
+  printf("== mesh_sim: %d nodes (%d repeaters, %d chat), topo=%s, %d links, SF%d/%.0fkHz/CR%d, %u s ==\n",
+         cfg.nodes, cfg.nodes - (int)chats.size(), (int)chats.size(), cfg.topo, num_links, cfg.sf, cfg.bw, cfg.cr, cfg.duration_secs);
+
+  struct timespec wall_start, wall_end;
+  clock_gettime(CLOCK_MONOTONIC, &wall_start);
+
+  size_t next_event = 0;
+  uint64_t num_steps = 0;
+  while (sim_clock.getMillis() < duration_ms) {
+    unsigned long now = sim_clock.getMillis();
+    while (next_event < events.size() && events[next_event].at <= now) {
+      auto& e = events[next_event++];
+      auto sender = chats[e.sender];
+      if (e.direct) {
+        int n_contacts = sender->getNumContacts();
+        uint32_t id = tracker.newMessage(SIM_MSG_DIRECT, sender->getNodeIdx(), now, 1);
+        sender->sendDirectMsg(random(0, n_contacts), id);
+      } else {
+        uint32_t id = tracker.newMessage(SIM_MSG_CHANNEL, sender->getNodeIdx(), now, chats.size() - 1);
+        sender->sendChannelMsg(id);
+      }
+    }
+
+    for (auto& n : nodes) {
+      if (n.repeater) n.repeater->loop(); else n.chat->loop();
+    }
+    num_steps++;
+
+    // nothing in the air: jump ahead to the next queued packet, or message, that's due (at most SIM_IDLE_STEP)
+    unsigned long step = medium.isIdle() ? SIM_IDLE_STEP : 0;
+    for (int i = 0; step > 0 && i < cfg.nodes; i++) {
+      int due = nodes[i].mesh()->getNextDueIn();
+      if (due >= 0 && (unsigned long)due < step) step = due;
+    }
+    if (step > 0 && next_event < events.size() && events[next_event].at - now < step) step = events[next_event].at - now;
+    sim_clock.advance(step > 0 ? step : cfg.tick);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &wall_end);
+  double wall_secs = (wall_end.tv_sec - wall_start.tv_sec) + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e9;
+
+  // ---- report ----
+  const char* kind_names[] = { "channel", "direct" };
+  for (int k = SIM_MSG_CHANNEL; k <= SIM_MSG_DIRECT; k++) {
+    auto s = tracker.summarise(k);
+    if (s.n_sent == 0) continue;
+    printf("%-8s msgs=%u  delivery=%.1f%% (%u/%u)  latency ms: mean=%u p50=%u p95=%u max=%u",
+           kind_names[k], s.n_sent, s.n_expected ? 100.0 * s.n_delivered / s.n_expected : 0.0, s.n_delivered, s.n_expected,
+           s.lat_mean, s.lat_p50, s.lat_p95, s.lat_max);
+    if (k == SIM_MSG_DIRECT) {
+      printf("  acked=%.1f%% (rtt p50=%u p95=%u)", 100.0 * s.n_acked / s.n_sent, s.ack_p50, s.ack_p95);
+    }
+    printf("\n");
+  }
+
+  auto& ms = medium.stats;
+  uint32_t n_unique = medium.getNumUniquePackets();
+  printf("tx: total=%u unique=%u  tx/packet=%.2f  dup_tx=%u  rx_ok=%u redundant_rx=%u\n",
+         ms.n_tx, n_unique, n_unique ? (double)ms.n_tx / n_unique : 0.0, ms.n_dup_tx, ms.n_rx_ok, ms.n_rx_redundant);
+  printf("lost: collisions=%u half_duplex=%u link=%u below_sensitivity=%u rx_queue_full=%u\n",
+         ms.n_collisions, ms.n_half_duplex, ms.n_link_loss, ms.n_below_sensitivity, ms.n_queue_full);
+
+  uint64_t total_busy = 0, max_busy = 0;
+  uint32_t n_pool_full = 0, n_cad_timeout = 0, flood_dups = 0, direct_dups = 0, decrypt_trials = 0, decrypt_fails = 0;
+  for (auto& n : nodes) {
+    uint64_t b = n.radio->getBusyMillis();
+    total_busy += b;
+    if (b > max_busy) max_busy = b;
+    uint16_t err = n.mesh()->getErrFlags();
+    if (err & ERR_EVENT_FULL) n_pool_full++;
+    if (err & ERR_EVENT_CAD_TIMEOUT) n_cad_timeout++;
+    flood_dups += n.tables->getNumFloodDups();
+    direct_dups += n.tables->getNumDirectDups();
+    decrypt_trials += n.mesh()->getNumDecryptTrials();
+    decrypt_fails += n.mesh()->getNumDecryptFails();
+  }
+  printf("channel: airtime=%llu ms (%.2f%% of run, summed over nodes)  node busy: mean=%.2f%% max=%.2f%%\n",
+         (unsigned long long)ms.tx_airtime_millis, 100.0 * ms.tx_airtime_millis / duration_ms,
+         100.0 * total_busy / cfg.nodes / duration_ms, 100.0 * max_busy / duration_ms);
+  printf("nodes: pool_exhausted=%u cad_timeout=%u  flood_dups=%u direct_dups=%u  decrypt trials=%u failed=%u\n",
+         n_pool_full, n_cad_timeout, flood_dups, direct_dups, decrypt_trials, decrypt_fails);
+  printf("sim: %llu steps, %.2f s wall, %.0fx real time\n", (unsigned long long)num_steps, wall_secs, wall_secs > 0 ? cfg.duration_secs / wall_secs : 0.0);
+  return 0;
+}
@@ -216,7 +216,7 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
   if (payload[0] == REQ_TYPE_GET_STATUS) {  // guests can also access this now
     RepeaterStats stats;
     stats.batt_milli_volts = board.getBattMilliVolts();
-    stats.curr_tx_queue_len = _mgr->getOutboundCount(0xFFFFFFFF);
+    stats.curr_tx_queue_len = _mgr->getOutboundTotal();
     stats.noise_floor = (int16_t)_radio->getNoiseFloor();
     stats.last_rssi = (int16_t)radio_driver.getLastRSSI();
     stats.n_packets_recv = radio_driver.getPacketsRecv();
@@ -229,8 +229,8 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
     stats.n_recv_direct = getNumRecvDirect();
     stats.err_events = _err_flags;
     stats.last_snr = (int16_t)(radio_driver.getLastSNR() * 4);
-    stats.n_direct_dups = ((SimpleMeshTables *)getTables())->getNumDirectDups();
-    stats.n_flood_dups = ((SimpleMeshTables *)getTables())->getNumFloodDups();
+    stats.n_direct_dups = ((RepeaterMeshTables *)getTables())->getNumDirectDups();
+    stats.n_flood_dups = ((RepeaterMeshTables *)getTables())->getNumFloodDups();
     stats.total_rx_air_time_secs = getReceiveAirTime() / 1000;
     stats.n_recv_errors = radio_driver.getPacketsRecvErrors();
     memcpy(&reply_data[4], &stats, sizeof(stats));
@@ -265,10 +265,10 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
     if (res1 == 0 && res2 == 0) {
       uint8_t ofs = 4;
       for (int i = 0; i < acl.getNumClients() && ofs + 7 <= sizeof(reply_data) - 4; i++) {
-        auto c = acl.getClientByIdx(i);
-        if (c->permissions == 0) continue;  // skip deleted entries
-        memcpy(&reply_data[ofs], c->id.pub_key, 6); ofs += 6;  // just 6-byte pub_key prefix
-        reply_data[ofs++] = c->permissions;
+        auto status = acl.getStatusByIdx(i);   // (doesn't page in every client)
+        if (status.permissions == 0) continue;  // skip deleted entries
+        memcpy(&reply_data[ofs], acl.getKeyPrefixByIdx(i), 6); ofs += 6;  // just 6-byte pub_key prefix
+        reply_data[ofs++] = status.permissions;
       }
       return ofs;
     }
@@ -556,13 +556,8 @@ void MyMesh::onAnonDataRecv(mesh::Packet *packet, const uint8_t *secret, const m
 }
 
 int MyMesh::searchPeersByHash(const uint8_t *hash) {
-  int n = 0;
-  for (int i = 0; i < acl.getNumClients(); i++) {
-    if (acl.getClientByIdx(i)->id.isHashMatch(hash)) {
-      matching_peer_indexes[n++] = i; // store the INDEXES of matching contacts (for subsequent 'peer' methods)
-    }
-  }
-  return n;
+  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
+  return acl.findClientsByHash(hash, matching_peer_indexes, MAX_CLIENTS);
 }
 
 void MyMesh::getPeerSharedSecret(uint8_t *dest_secret, int peer_idx) {
@@ -578,7 +573,7 @@ void MyMesh::getPeerSharedSecret(uint8_t *dest_secret, int peer_idx) {
 uint8_t MyMesh::getPeerFlags(int peer_idx) {
   int i = matching_peer_indexes[peer_idx];
   if (i >= 0 && i < acl.getNumClients())
-    return acl.getClientByIdx(i)->flags;
+    return acl.getStatusByIdx(i).flags;
   return 0;
 }
 
@@ -606,6 +601,12 @@ const uint8_t* MyMesh::getPeerPrevSessionKey(int peer_idx) {
 void MyMesh::onSessionKeyDecryptSuccess(int peer_idx) {
   acl.peerSessionKeyDecryptSuccess(peer_idx, matching_peer_indexes);
 }
+uint8_t MyMesh::getPeerDecodeHint(int peer_idx) {
+  return acl.peerDecodeHint(peer_idx, matching_peer_indexes);
+}
+void MyMesh::setPeerDecodeHint(int peer_idx, uint8_t mode) {
+  acl.setPeerDecodeHint(peer_idx, matching_peer_indexes, mode);
+}
 const uint8_t* MyMesh::getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) {
   return acl.peerEncryptionKey(peer_idx, matching_peer_indexes, static_secret);
 }
@@ -659,6 +660,7 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
         use_static_secret = true;  // ACCEPT must use static secret (initiator doesn't have session key yet)
       } else {
         reply_len = handleRequest(client, timestamp, &data[4], len - 4);
+        client = acl.getClientByIdx(i);   // request may have paged in other clients
       }
       if (reply_len == 0) return; // invalid command
 
@@ -726,7 +728,12 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
       if (is_retry) {
         *reply = 0;
       } else {
+        uint8_t sender_key[PUB_KEY_SIZE];
+        memcpy(sender_key, client->id.pub_key, PUB_KEY_SIZE);
         handleCommand(sender_timestamp, command, reply);
+
+        client = acl.getClient(sender_key, PUB_KEY_SIZE);   // command may have moved or removed clients
+        if (client == NULL) return;
       }
       int text_len = strlen(reply);
       if (text_len > 0) {
@@ -849,8 +856,8 @@ void MyMesh::sendNodeDiscoverReq() {
 
 MyMesh::MyMesh(mesh::MainBoard &board, mesh::Radio &radio, mesh::MillisecondClock &ms, mesh::RNG &rng,
                mesh::RTCClock &rtc, mesh::MeshTables &tables)
-    : mesh::Mesh(radio, ms, rng, rtc, *new StaticPoolPacketManager(32), tables),
-      _cli(board, rtc, sensors, acl, &_prefs, this), telemetry(MAX_PACKET_PAYLOAD - 4), region_map(key_store), temp_map(key_store),
+    : mesh::Mesh(radio, ms, rng, rtc, *new StaticPoolPacketManager(PACKET_POOL_SIZE), tables),
+      _cli(board, rtc, sensors, acl, &_prefs, this), telemetry(MAX_PACKET_PAYLOAD - 4), region_map(key_store, &region_keys), temp_map(key_store),
       discover_limiter(4, 120),  // max 4 every 2 minutes
       anon_limiter(4, 180)   // max 4 every 3 minutes
 #if defined(WITH_RS232_BRIDGE)
@@ -926,7 +933,7 @@ void MyMesh::begin(FILESYSTEM *fs) {
   acl.finalizeNonceLoad(dirty_reset);
   if (dirty_reset) acl.saveNonces();  // persist bumped nonces immediately
   next_nonce_persist = futureMillis(60000);
-  // TODO: key_store.begin();
+  key_store.begin(_fs);
   region_map.load(_fs);
 
 #if defined(WITH_BRIDGE)
@@ -965,6 +972,8 @@ bool MyMesh::formatFileSystem() {
   return LittleFS.format();
 #elif defined(ESP32)
   return SPIFFS.format();
+#elif defined(HOST_PLATFORM)
+  return _fs->format();
 #else
 #error "need to implement file system erase"
   return false;
@@ -1095,6 +1104,8 @@ void MyMesh::saveIdentity(const mesh::LocalIdentity &new_id) {
   IdentityStore store(*_fs, "/identity");
 #elif defined(RP2040_PLATFORM)
   IdentityStore store(*_fs, "/identity");
+#elif defined(HOST_PLATFORM)
+  IdentityStore store(*_fs, "/identity");
 #else
 #error "need to define saveIdentity()"
 #endif
@@ -1104,7 +1115,7 @@ void MyMesh::saveIdentity(const mesh::LocalIdentity &new_id) {
 void MyMesh::clearStats() {
   radio_driver.resetStats();
   resetStats();
-  ((SimpleMeshTables *)getTables())->resetStats();
+  ((RepeaterMeshTables *)getTables())->resetStats();
 }
 
 void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply) {
@@ -1112,6 +1123,7 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
     if (StrHelper::isBlank(command)) {  // empty/blank line, signal to terminate 'load' operation
       region_map = temp_map;  // copy over the temp instance as new current map
       region_load_active = false;
+      region_map.pruneKeys();   // drop keys of private regions that weren't re-loaded
 
       sprintf(reply, "OK - loaded %d regions", region_map.getCount());
     } else {
@@ -1176,8 +1188,8 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
   } else if (sender_timestamp == 0 && strcmp(command, "get acl") == 0) {
     Serial.println("ACL:");
     for (int i = 0; i < acl.getNumClients(); i++) {
+      if (acl.getStatusByIdx(i).permissions == 0) continue;  // skip deleted (or guest) entries
       auto c = acl.getClientByIdx(i);
-      if (c->permissions == 0) continue;  // skip deleted (or guest) entries
 
       Serial.printf("%02X ", c->permissions);
       mesh::Utils::printHex(Serial, c->id.pub_key, PUB_KEY_SIZE);
@@ -1255,7 +1267,10 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
     } else if (n >= 3 && strcmp(parts[1], "remove") == 0) {
       auto region = region_map.findByName(parts[2]);
       if (region) {
+        uint16_t id = region->id;
+        bool is_private = region->name[0] == '$';
         if (region_map.removeRegion(*region)) {
+          if (is_private) key_store.removeKeys(id);
           strcpy(reply, "OK");
         } else {
           strcpy(reply, "Err - not empty");
@@ -1263,6 +1278,28 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
       } else {
         strcpy(reply, "Err - not found");
       }
+    } else if (n >= 4 && strcmp(parts[1], "key") == 0) {
+      auto region = region_map.findByName(parts[2]);
+      TransportKey keys[MAX_TKS_KEYS_PER_ID];
+      if (region == NULL || region->name[0] != '$') {
+        strcpy(reply, "Err - unknown private region");
+      } else if (strlen(parts[3]) != sizeof(keys[0].key)*2 || !mesh::Utils::fromHex(keys[0].key, sizeof(keys[0].key), parts[3])) {
+        strcpy(reply, "Err - bad key");
+      } else {
+        int num = key_store.loadKeysFor(region->id, &keys[1], MAX_TKS_KEYS_PER_ID - 1);   // newest first, drops the oldest when full
+        if (key_store.saveKeysFor(region->id, keys, num + 1)) {
+          sprintf(reply, "OK - %d key(s)", num + 1);
+        } else {
+          strcpy(reply, "Err - save failed");
+        }
+      }
+    } else if (n >= 3 && strcmp(parts[1], "unkey") == 0) {
+      auto region = region_map.findByName(parts[2]);
+      if (region == NULL || region->name[0] != '$') {
+        strcpy(reply, "Err - unknown private region");
+      } else {
+        strcpy(reply, key_store.removeKeys(region->id) ? "OK" : "Err - save failed");
+      }
     } else if (n >= 3 && strcmp(parts[1], "list") == 0) {
       uint8_t mask = 0;
       bool invert = false;
@@ -1355,5 +1392,5 @@ bool MyMesh::hasPendingWork() const {
 #if defined(WITH_BRIDGE)
   if (bridge.isRunning()) return true;  // bridge needs WiFi radio, can't sleep
 #endif
-  return _mgr->getOutboundCount(0xFFFFFFFF) > 0;
+  return _mgr->getOutboundTotal() > 0;
 }
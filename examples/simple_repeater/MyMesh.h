@@ -61,6 +61,20 @@ struct RepeaterStats {
   #define MAX_CLIENTS           32
 #endif
 
+#ifndef PACKET_POOL_SIZE
+  #define PACKET_POOL_SIZE      32
+#endif
+
+#ifndef REPEATER_PACKET_HASHES
+  #ifdef ESP32
+    #define REPEATER_PACKET_HASHES  1024   // busy repeaters hear each flood many times, over a longer window
+  #else
+    #define REPEATER_PACKET_HASHES  MAX_PACKET_HASHES
+  #endif
+#endif
+
+typedef SizedMeshTables<REPEATER_PACKET_HASHES, MAX_PACKET_ACKS> RepeaterMeshTables;
+
 struct NeighbourInfo {
   mesh::Identity id;
   uint32_t advert_timestamp;
@@ -93,6 +107,7 @@ class MyMesh : public mesh::Mesh, public CommonCLICallbacks {
   uint8_t reply_path[MAX_PATH_SIZE];
   int8_t  reply_path_len;
   TransportKeyStore key_store;
+  RegionKeyTable region_keys;   // for region_map only, temp_map just stages 'region load'
   RegionMap region_map, temp_map;
   RegionEntry* load_stack[8];
   RegionEntry* recv_pkt_region;
@@ -173,6 +188,8 @@ protected:
   const uint8_t* getPeerSessionKey(int peer_idx) override;
   const uint8_t* getPeerPrevSessionKey(int peer_idx) override;
   void onSessionKeyDecryptSuccess(int peer_idx) override;
+  uint8_t getPeerDecodeHint(int peer_idx) override;
+  void setPeerDecodeHint(int peer_idx, uint8_t mode) override;
   const uint8_t* getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) override;
   uint16_t getPeerEncryptionNonce(int peer_idx) override;
   void onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id, uint32_t timestamp, const uint8_t* app_data, size_t app_data_len);
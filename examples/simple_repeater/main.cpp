@@ -9,7 +9,7 @@
 #endif
 
 StdRNG fast_rng;
-SimpleMeshTables tables;
+RepeaterMeshTables tables;
 
 MyMesh the_mesh(board, radio_driver, *new ArduinoMillis(), fast_rng, rtc_clock, tables);
 
@@ -101,8 +101,9 @@ uint8_t MyMesh::getUnsyncedCount(ClientInfo *client) {
 
 bool MyMesh::processAck(const uint8_t *data) {
   for (int i = 0; i < acl.getNumClients(); i++) {
-    auto client = acl.getClientByIdx(i);
-    if (client->extra.room.pending_ack && memcmp(data, &client->extra.room.pending_ack, 4) == 0) { // got an ACK from Client!
+    auto pending_ack = acl.getStatusByIdx(i).pending_ack;   // (doesn't page in every client)
+    if (pending_ack && memcmp(data, &pending_ack, 4) == 0) { // got an ACK from Client!
+      auto client = acl.getClientByIdx(i);   // NOTE: only valid until the next acl lookup
       client->extra.room.pending_ack = 0; // clear this, so next push can happen
       client->extra.room.push_failures = 0;
       client->extra.room.sync_since = client->extra.room.push_post_timestamp; // advance Client's SINCE timestamp, to sync next post
@@ -138,7 +139,7 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
   if (payload[0] == REQ_TYPE_GET_STATUS) {
     ServerStats stats;
     stats.batt_milli_volts = board.getBattMilliVolts();
-    stats.curr_tx_queue_len = _mgr->getOutboundCount(0xFFFFFFFF);
+    stats.curr_tx_queue_len = _mgr->getOutboundTotal();
     stats.noise_floor = (int16_t)_radio->getNoiseFloor();
     stats.last_rssi = (int16_t)radio_driver.getLastRSSI();
     stats.n_packets_recv = radio_driver.getPacketsRecv();
@@ -180,10 +181,10 @@ int MyMesh::handleRequest(ClientInfo *sender, uint32_t sender_timestamp, uint8_t
     if (res1 == 0 && res2 == 0) {
       uint8_t ofs = 4;
       for (int i = 0; i < acl.getNumClients() && ofs + 7 <= sizeof(reply_data) - 4; i++) {
-        auto c = acl.getClientByIdx(i);
-        if (!c->isAdmin()) continue;  // skip non-Admin entries
-        memcpy(&reply_data[ofs], c->id.pub_key, 6); ofs += 6;  // just 6-byte pub_key prefix
-        reply_data[ofs++] = c->permissions;
+        auto status = acl.getStatusByIdx(i);   // (doesn't page in every client)
+        if (!status.isAdmin()) continue;  // skip non-Admin entries
+        memcpy(&reply_data[ofs], acl.getKeyPrefixByIdx(i), 6); ofs += 6;  // just 6-byte pub_key prefix
+        reply_data[ofs++] = status.permissions;
       }
       return ofs;
     }
@@ -368,19 +369,14 @@ void MyMesh::onAnonDataRecv(mesh::Packet *packet, const uint8_t *secret, const m
 }
 
 int MyMesh::searchPeersByHash(const uint8_t *hash) {
-  int n = 0;
-  for (int i = 0; i < acl.getNumClients(); i++) {
-    if (acl.getClientByIdx(i)->id.isHashMatch(hash)) {
-      matching_peer_indexes[n++] = i; // store the INDEXES of matching contacts (for subsequent 'peer' methods)
-    }
-  }
-  return n;
+  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
+  return acl.findClientsByHash(hash, matching_peer_indexes, MAX_CLIENTS);
 }
 
 void MyMesh::getPeerSharedSecret(uint8_t *dest_secret, int peer_idx) {
   int i = matching_peer_indexes[peer_idx];
   if (i >= 0 && i < acl.getNumClients()) {
-    // lookup pre-calculated shared_secret
+    // lookup pre-calculated shared_secret  (just this candidate is paged in)
     memcpy(dest_secret, acl.getClientByIdx(i)->shared_secret, PUB_KEY_SIZE);
   } else {
     MESH_DEBUG_PRINTLN("getPeerSharedSecret: Invalid peer idx: %d", i);
@@ -390,7 +386,7 @@ void MyMesh::getPeerSharedSecret(uint8_t *dest_secret, int peer_idx) {
 uint8_t MyMesh::getPeerFlags(int peer_idx) {
   int i = matching_peer_indexes[peer_idx];
   if (i >= 0 && i < acl.getNumClients())
-    return acl.getClientByIdx(i)->flags;
+    return acl.getStatusByIdx(i).flags;
   return 0;
 }
 
@@ -418,6 +414,12 @@ const uint8_t* MyMesh::getPeerPrevSessionKey(int peer_idx) {
 void MyMesh::onSessionKeyDecryptSuccess(int peer_idx) {
   acl.peerSessionKeyDecryptSuccess(peer_idx, matching_peer_indexes);
 }
+uint8_t MyMesh::getPeerDecodeHint(int peer_idx) {
+  return acl.peerDecodeHint(peer_idx, matching_peer_indexes);
+}
+void MyMesh::setPeerDecodeHint(int peer_idx, uint8_t mode) {
+  acl.setPeerDecodeHint(peer_idx, matching_peer_indexes, mode);
+}
 const uint8_t* MyMesh::getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) {
   return acl.peerEncryptionKey(peer_idx, matching_peer_indexes, static_secret);
 }
@@ -432,7 +434,7 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
     MESH_DEBUG_PRINTLN("onPeerDataRecv: invalid peer idx: %d", i);
     return;
   }
-  auto client = acl.getClientByIdx(i);
+  auto client = acl.getClientByIdx(i);   // NOTE: re-fetched after anything which can look up other clients
   if (type == PAYLOAD_TYPE_TXT_MSG && len > 5) { // a CLI command or new Post
     uint32_t sender_timestamp;
     memcpy(&sender_timestamp, data, 4); // timestamp (by sender's RTC clock - which could be wrong)
@@ -463,8 +465,13 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
           if (is_retry) {
             temp[5] = 0; // no reply
           } else {
+            uint8_t sender_key[PUB_KEY_SIZE];
+            memcpy(sender_key, client->id.pub_key, PUB_KEY_SIZE);
             handleCommand(sender_timestamp, (char *)&data[5], (char *)&temp[5]);
             temp[4] = (TXT_TYPE_CLI_DATA << 2); // attempt and flags,  (NOTE: legacy was: TXT_TYPE_PLAIN)
+
+            client = acl.getClient(sender_key, PUB_KEY_SIZE);   // command may have moved or removed clients
+            if (client == NULL) return;
           }
           send_ack = false;
         } else {
@@ -582,6 +589,7 @@ void MyMesh::onPeerDataRecv(mesh::Packet *packet, uint8_t type, int sender_idx,
           use_static_secret = true;  // ACCEPT must use static secret (initiator doesn't have session key yet)
         } else {
           reply_len = handleRequest(client, sender_timestamp, &data[4], len - 4);
+          client = acl.getClientByIdx(i);   // request may have paged in other clients
         }
         if (reply_len > 0) { // valid command
           const uint8_t* enc_key = use_static_secret ? secret : acl.getEncryptionKey(*client);
@@ -615,7 +623,7 @@ bool MyMesh::onPeerPathRecv(mesh::Packet *packet, int sender_idx, const uint8_t
 
   if (i >= 0 && i < acl.getNumClients()) { // get from our known_clients table (sender SHOULD already be known in this context)
     MESH_DEBUG_PRINTLN("PATH to client, path_len=%d", (uint32_t)path_len);
-    auto client = acl.getClientByIdx(i);
+    auto client = acl.getClientByIdx(i);   // NOTE: only valid until the next acl lookup
     memcpy(client->out_path, path, client->out_path_len = path_len); // store a copy of path, for sendDirect()
     client->last_activity = getRTCClock()->getCurrentTime();
   } else {
@@ -852,8 +860,8 @@ void MyMesh::handleCommand(uint32_t sender_timestamp, char *command, char *reply
   } else if (sender_timestamp == 0 && strcmp(command, "get acl") == 0) {
     Serial.println("ACL:");
     for (int i = 0; i < acl.getNumClients(); i++) {
+      if (acl.getStatusByIdx(i).permissions == 0) continue;  // skip deleted (or guest) entries
       auto c = acl.getClientByIdx(i);
-      if (c->permissions == 0) continue;  // skip deleted (or guest) entries
 
       Serial.printf("%02X ", c->permissions);
       mesh::Utils::printHex(Serial, c->id.pub_key, PUB_KEY_SIZE);
@@ -873,19 +881,20 @@ void MyMesh::loop() {
   mesh::Mesh::loop();
 
   if (millisHasNowPassed(next_push) && acl.getNumClients() > 0) {
-    // check for ACK timeouts
+    // check for ACK timeouts  (polls each client's status, so only those awaiting an ACK get paged in)
     for (int i = 0; i < acl.getNumClients(); i++) {
+      if (acl.getStatusByIdx(i).pending_ack == 0) continue;
       auto c = acl.getClientByIdx(i);
-      if (c->extra.room.pending_ack && millisHasNowPassed(c->extra.room.ack_timeout)) {
+      if (millisHasNowPassed(c->extra.room.ack_timeout)) {
         c->extra.room.push_failures++;
         c->extra.room.pending_ack = 0; // reset  (TODO: keep prev expected_ack's in a list, incase they arrive LATER, after we retry)
         MESH_DEBUG_PRINTLN("pending ACK timed out: push_failures: %d", (uint32_t)c->extra.room.push_failures);
       }
     }
     // check next Round-Robin client, and sync next new post
-    auto client = acl.getClientByIdx(next_client_idx);
     bool did_push = false;
-    if (client->extra.room.pending_ack == 0 && client->last_activity != 0 &&
+    ClientInfo* client = acl.getStatusByIdx(next_client_idx).pending_ack == 0 ? acl.getClientByIdx(next_client_idx) : NULL;
+    if (client && client->last_activity != 0 &&
         client->extra.room.push_failures < 3) { // not already waiting for ACK, AND not evicted, AND retries not max
       MESH_DEBUG_PRINTLN("loop - checking for client %02X", (uint32_t)client->id.pub_key[0]);
       uint32_t now = getRTCClock()->getCurrentTime();
@@ -903,7 +912,7 @@ void MyMesh::loop() {
         idx = (idx + 1) % MAX_UNSYNCED_POSTS; // wrap to start of cyclic queue
       }
     } else {
-      MESH_DEBUG_PRINTLN("loop - skipping busy (or evicted) client %02X", (uint32_t)client->id.pub_key[0]);
+      MESH_DEBUG_PRINTLN("loop - skipping busy (or evicted) client #%d", next_client_idx);
     }
     next_client_idx = (next_client_idx + 1) % acl.getNumClients(); // round robin polling for each client
 
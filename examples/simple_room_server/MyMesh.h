@@ -155,6 +155,8 @@ protected:
   const uint8_t* getPeerSessionKey(int peer_idx) override;
   const uint8_t* getPeerPrevSessionKey(int peer_idx) override;
   void onSessionKeyDecryptSuccess(int peer_idx) override;
+  uint8_t getPeerDecodeHint(int peer_idx) override;
+  void setPeerDecodeHint(int peer_idx, uint8_t mode) override;
   const uint8_t* getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) override;
   uint16_t getPeerEncryptionNonce(int peer_idx) override;
   void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override;
@@ -226,10 +226,10 @@ uint8_t SensorMesh::handleRequest(uint8_t perms, uint32_t sender_timestamp, uint
     if (res1 == 0 && res2 == 0) {
       uint8_t ofs = 4;
       for (int i = 0; i < acl.getNumClients() && ofs + 7 <= sizeof(reply_data) - 4; i++) {
-        auto c = acl.getClientByIdx(i);
-        if (c->permissions == 0) continue;  // skip deleted entries
-        memcpy(&reply_data[ofs], c->id.pub_key, 6); ofs += 6;  // just 6-byte pub_key prefix
-        reply_data[ofs++] = c->permissions;
+        auto status = acl.getStatusByIdx(i);   // (doesn't page in every client)
+        if (status.permissions == 0) continue;  // skip deleted entries
+        memcpy(&reply_data[ofs], acl.getKeyPrefixByIdx(i), 6); ofs += 6;  // just 6-byte pub_key prefix
+        reply_data[ofs++] = status.permissions;
       }
       return ofs;
     }
@@ -415,8 +415,8 @@ void SensorMesh::handleCommand(uint32_t sender_timestamp, char* command, char* r
   } else if (sender_timestamp == 0 && strcmp(command, "get acl") == 0) {
     Serial.println("ACL:");
     for (int i = 0; i < acl.getNumClients(); i++) {
+      if (acl.getStatusByIdx(i).permissions == 0) continue;  // skip deleted entries
       auto c = acl.getClientByIdx(i);
-      if (c->permissions == 0) continue;  // skip deleted entries
 
       Serial.printf("%02X ", c->permissions);
       mesh::Utils::printHex(Serial, c->id.pub_key, PUB_KEY_SIZE);
@@ -477,13 +477,8 @@ void SensorMesh::onAnonDataRecv(mesh::Packet* packet, const uint8_t* secret, con
 }
 
 int SensorMesh::searchPeersByHash(const uint8_t* hash) {
-  int n = 0;
-  for (int i = 0; i < acl.getNumClients() && n < MAX_SEARCH_RESULTS; i++) {
-    if (acl.getClientByIdx(i)->id.isHashMatch(hash)) {
-      matching_peer_indexes[n++] = i;  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
-    }
-  }
-  return n;
+  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
+  return acl.findClientsByHash(hash, matching_peer_indexes, MAX_SEARCH_RESULTS);
 }
 
 void SensorMesh::getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) {
@@ -499,7 +494,7 @@ void SensorMesh::getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) {
 uint8_t SensorMesh::getPeerFlags(int peer_idx) {
   int i = matching_peer_indexes[peer_idx];
   if (i >= 0 && i < acl.getNumClients())
-    return acl.getClientByIdx(i)->flags;
+    return acl.getStatusByIdx(i).flags;
   return 0;
 }
 
@@ -527,6 +522,12 @@ const uint8_t* SensorMesh::getPeerPrevSessionKey(int peer_idx) {
 void SensorMesh::onSessionKeyDecryptSuccess(int peer_idx) {
   acl.peerSessionKeyDecryptSuccess(peer_idx, matching_peer_indexes);
 }
+uint8_t SensorMesh::getPeerDecodeHint(int peer_idx) {
+  return acl.peerDecodeHint(peer_idx, matching_peer_indexes);
+}
+void SensorMesh::setPeerDecodeHint(int peer_idx, uint8_t mode) {
+  acl.setPeerDecodeHint(peer_idx, matching_peer_indexes, mode);
+}
 const uint8_t* SensorMesh::getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) {
   return acl.peerEncryptionKey(peer_idx, matching_peer_indexes, static_secret);
 }
@@ -575,6 +576,7 @@ void SensorMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_i
         use_static_secret = true;  // ACCEPT must use static secret (initiator doesn't have session key yet)
       } else {
         reply_len = handleRequest(from->isAdmin() ? 0xFF : from->permissions, timestamp, data[4], &data[5], len - 5);
+        from = acl.getClientByIdx(i);   // request may have paged in other clients
       }
       if (reply_len == 0) return;  // invalid command
 
@@ -635,8 +637,13 @@ void SensorMesh::onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_i
         uint8_t temp[166];
         char *command = (char *) &data[5];
         char *reply = (char *) &temp[5];
+        uint8_t sender_key[PUB_KEY_SIZE];
+        memcpy(sender_key, from->id.pub_key, PUB_KEY_SIZE);
         handleCommand(sender_timestamp, command, reply);
 
+        from = acl.getClient(sender_key, PUB_KEY_SIZE);   // command may have moved or removed clients
+        if (from == NULL) return;
+
         int text_len = strlen(reply);
         if (text_len > 0) {
           uint32_t timestamp = getRTCClock()->getCurrentTimeUnique();
@@ -977,15 +984,14 @@ void SensorMesh::loop() {
             alert_tasks[i] = alert_tasks[i + 1];
           }
         } else {
-          auto c = acl.getClientByIdx(t->curr_contact_idx);
           uint16_t pri_mask = (t->pri == HIGH_PRI_ALERT) ? PERM_RECV_ALERTS_HI : PERM_RECV_ALERTS_LO;
 
-          if (c->permissions & pri_mask) {   // contact wants alert
+          if (acl.getStatusByIdx(t->curr_contact_idx).permissions & pri_mask) {   // contact wants alert  (not paged in otherwise)
             // reset attempts
             t->attempt = (t->pri == LOW_PRI_ALERT) ? 3 : 0;   // Low pri alerts, start at attempt #3 (ie. only make ONE attempt)
             t->timestamp = getRTCClock()->getCurrentTimeUnique();   // need unique timestamp per contact
 
-            sendAlert(c, t);  // NOTE: modifies attempt, expected_acks[] and send_expiry
+            sendAlert(acl.getClientByIdx(t->curr_contact_idx), t);  // NOTE: modifies attempt, expected_acks[] and send_expiry
           } else {
             // next contact tested in next ::loop()
           }
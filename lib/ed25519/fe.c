@@ -2,6 +2,12 @@
 #include "fe.h"
 
 
+/*
+    ref10 backend (10 x 25.5 bit limbs), unless ED25519_FE51 selects fe51.c. fe_invert(), fe_pow22523(),
+    fe_isnegative() and fe_isnonzero() are built on the other operations, so shared by both.
+*/
+#if !ED25519_FE51
+
 /*
     helper functions
 */
@@ -358,6 +364,7 @@ void fe_frombytes(fe h, const unsigned char *s) {
     h[8] = (int32_t) h8;
     h[9] = (int32_t) h9;
 }
+#endif /* !ED25519_FE51 */
 
 
 
@@ -521,6 +528,7 @@ int fe_isnonzero(const fe f) {
 
 
 
+#if !ED25519_FE51
 /*
     h = f * g
     Can overlap h with f or g.
@@ -876,6 +884,7 @@ void fe_neg(fe h, const fe f) {
     h[8] = h8;
     h[9] = h9;
 }
+#endif /* !ED25519_FE51 */
 
 
 void fe_pow22523(fe out, const fe z) {
@@ -964,6 +973,7 @@ void fe_pow22523(fe out, const fe z) {
 }
 
 
+#if !ED25519_FE51
 /*
 h = f * f
 Can overlap h with f.
@@ -1489,3 +1499,5 @@ void fe_tobytes(unsigned char *s, const fe h) {
     s[30] = (unsigned char) (h9 >> 10);
     s[31] = (unsigned char) (h9 >> 18);
 }
+
+#endif /* !ED25519_FE51 */
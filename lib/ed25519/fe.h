@@ -4,16 +4,41 @@
 #include "fixedint.h"
 
 
+/*
+    ED25519_FE51 selects the field arithmetic backend:
+      0 - ref10, 10 signed 32-bit limbs (fe.c). Portable, suits 32-bit MCUs.
+      1 - 5 unsigned 64-bit limbs of 51 bits (fe51.c). Needs a 64x64->128 bit multiply, ie. 64-bit hosts.
+    Both give bit-identical results.
+*/
+#ifndef ED25519_FE51
+    #define ED25519_FE51 0
+#endif
+
+#if ED25519_FE51 && !defined(__SIZEOF_INT128__)
+    #error "ED25519_FE51 needs unsigned __int128 (a 64-bit target)"
+#endif
+
+
 /*
     fe means field element.
     Here the field is \Z/(2^255-19).
+*/
+
+#if ED25519_FE51
+/*
+    An element t, entries t[0]...t[4], represents the integer
+    t[0]+2^51 t[1]+2^102 t[2]+2^153 t[3]+2^204 t[4].
+    Limbs are kept below 2^52 between operations.
+*/
+typedef uint64_t fe[5];
+#else
+/*
     An element t, entries t[0]...t[9], represents the integer
     t[0]+2^26 t[1]+2^51 t[2]+2^77 t[3]+2^102 t[4]+...+2^230 t[9].
     Bounds on each t[i] vary depending on context.
 */
-
-
 typedef int32_t fe[10];
+#endif
 
 
 void fe_0(fe h);
@@ -0,0 +1,291 @@
+#include "fixedint.h"
+#include "fe.h"
+
+
+/*
+    64-bit backend, selected by ED25519_FE51: 5 unsigned limbs of 51 bits, with 128-bit products.
+    Every operation (add/sub/neg too) carries its result, so all limbs stay below 2^52 and any
+    result can be the input of any other operation. fe_invert(), fe_pow22523(), fe_isnegative() and
+    fe_isnonzero() are shared with the ref10 backend, in fe.c.
+*/
+#if ED25519_FE51
+
+typedef unsigned __int128 uint128_t;
+
+#define MASK51  ((((uint64_t) 1) << 51) - 1)
+
+/* 4*p, added before subtracting so limbs can't go negative */
+#define FOUR_P0 ((((uint64_t) 1) << 53) - 76)
+#define FOUR_P1 ((((uint64_t) 1) << 53) - 4)
+
+
+static uint64_t load_8(const unsigned char *in) {
+    uint64_t result = 0;
+    int i;
+
+    for (i = 7; i >= 0; --i) {
+        result = (result << 8) | in[i];
+    }
+
+    return result;
+}
+
+static void store_8(unsigned char *out, uint64_t v) {
+    int i;
+
+    for (i = 0; i < 8; ++i) {
+        out[i] = (unsigned char) v;
+        v >>= 8;
+    }
+}
+
+/*
+    limbs below 2^51, except h[0] which gets the top carry (times 19)
+*/
+static void fe_carry(fe h) {
+    uint64_t c;
+
+    c = h[0] >> 51; h[0] &= MASK51; h[1] += c;
+    c = h[1] >> 51; h[1] &= MASK51; h[2] += c;
+    c = h[2] >> 51; h[2] &= MASK51; h[3] += c;
+    c = h[3] >> 51; h[3] &= MASK51; h[4] += c;
+    c = h[4] >> 51; h[4] &= MASK51; h[0] += c * 19;
+}
+
+/*
+    h = t, reducing 128-bit column sums (each below 2^112) back to 51-bit limbs
+*/
+static void fe_carry_wide(fe h, uint128_t t0, uint128_t t1, uint128_t t2, uint128_t t3, uint128_t t4) {
+    uint64_t c;
+
+    t1 += (uint64_t) (t0 >> 51); h[0] = (uint64_t) t0 & MASK51;
+    t2 += (uint64_t) (t1 >> 51); h[1] = (uint64_t) t1 & MASK51;
+    t3 += (uint64_t) (t2 >> 51); h[2] = (uint64_t) t2 & MASK51;
+    t4 += (uint64_t) (t3 >> 51); h[3] = (uint64_t) t3 & MASK51;
+    c = (uint64_t) (t4 >> 51); h[4] = (uint64_t) t4 & MASK51;
+    h[0] += c * 19;
+    h[1] += h[0] >> 51;
+    h[0] &= MASK51;
+}
+
+
+void fe_0(fe h) {
+    h[0] = 0;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+void fe_1(fe h) {
+    h[0] = 1;
+    h[1] = 0;
+    h[2] = 0;
+    h[3] = 0;
+    h[4] = 0;
+}
+
+void fe_copy(fe h, const fe f) {
+    h[0] = f[0];
+    h[1] = f[1];
+    h[2] = f[2];
+    h[3] = f[3];
+    h[4] = f[4];
+}
+
+
+/*
+    h = f + g
+    Can overlap h with f or g.
+*/
+void fe_add(fe h, const fe f, const fe g) {
+    h[0] = f[0] + g[0];
+    h[1] = f[1] + g[1];
+    h[2] = f[2] + g[2];
+    h[3] = f[3] + g[3];
+    h[4] = f[4] + g[4];
+    fe_carry(h);
+}
+
+/*
+    h = f - g
+    Can overlap h with f or g.
+*/
+void fe_sub(fe h, const fe f, const fe g) {
+    h[0] = f[0] + FOUR_P0 - g[0];
+    h[1] = f[1] + FOUR_P1 - g[1];
+    h[2] = f[2] + FOUR_P1 - g[2];
+    h[3] = f[3] + FOUR_P1 - g[3];
+    h[4] = f[4] + FOUR_P1 - g[4];
+    fe_carry(h);
+}
+
+/*
+    h = -f
+*/
+void fe_neg(fe h, const fe f) {
+    h[0] = FOUR_P0 - f[0];
+    h[1] = FOUR_P1 - f[1];
+    h[2] = FOUR_P1 - f[2];
+    h[3] = FOUR_P1 - f[3];
+    h[4] = FOUR_P1 - f[4];
+    fe_carry(h);
+}
+
+
+/*
+    Replace (f,g) with (g,g) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+void fe_cmov(fe f, const fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+
+    f[0] ^= mask & (f[0] ^ g[0]);
+    f[1] ^= mask & (f[1] ^ g[1]);
+    f[2] ^= mask & (f[2] ^ g[2]);
+    f[3] ^= mask & (f[3] ^ g[3]);
+    f[4] ^= mask & (f[4] ^ g[4]);
+}
+
+/*
+    Replace (f,g) with (g,f) if b == 1;
+    replace (f,g) with (f,g) if b == 0.
+
+    Preconditions: b in {0,1}.
+*/
+void fe_cswap(fe f, fe g, unsigned int b) {
+    uint64_t mask = (uint64_t) 0 - (uint64_t) b;
+    uint64_t x;
+    int i;
+
+    for (i = 0; i < 5; ++i) {
+        x = mask & (f[i] ^ g[i]);
+        f[i] ^= x;
+        g[i] ^= x;
+    }
+}
+
+
+/*
+    Ignores top bit of s.
+*/
+void fe_frombytes(fe h, const unsigned char *s) {
+    h[0] = load_8(s) & MASK51;
+    h[1] = (load_8(s + 6) >> 3) & MASK51;
+    h[2] = (load_8(s + 12) >> 6) & MASK51;
+    h[3] = (load_8(s + 19) >> 1) & MASK51;
+    h[4] = (load_8(s + 24) >> 12) & MASK51;
+}
+
+/*
+    s = h, fully reduced mod p (same approach as ref10's fe_tobytes)
+*/
+void fe_tobytes(unsigned char *s, const fe f) {
+    fe h;
+    uint64_t q;
+
+    fe_copy(h, f);
+    fe_carry(h);
+    fe_carry(h);   /* now all limbs < 2^51, ie. h < 2^255 */
+
+    /* q = 1 if h >= p, ie. if h + 19 >= 2^255 */
+    q = (h[0] + 19) >> 51;
+    q = (h[1] + q) >> 51;
+    q = (h[2] + q) >> 51;
+    q = (h[3] + q) >> 51;
+    q = (h[4] + q) >> 51;
+
+    /* h - q*p = h + 19*q - q*2^255 */
+    h[0] += 19 * q;
+    h[1] += h[0] >> 51; h[0] &= MASK51;
+    h[2] += h[1] >> 51; h[1] &= MASK51;
+    h[3] += h[2] >> 51; h[2] &= MASK51;
+    h[4] += h[3] >> 51; h[3] &= MASK51;
+    h[4] &= MASK51;
+
+    store_8(s, h[0] | (h[1] << 51));
+    store_8(s + 8, (h[1] >> 13) | (h[2] << 38));
+    store_8(s + 16, (h[2] >> 26) | (h[3] << 25));
+    store_8(s + 24, (h[3] >> 39) | (h[4] << 12));
+}
+
+
+/*
+    h = f * g
+    Can overlap h with f or g.
+*/
+void fe_mul(fe h, const fe f, const fe g) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+    uint64_t g1_19 = 19 * g1;
+    uint64_t g2_19 = 19 * g2;
+    uint64_t g3_19 = 19 * g3;
+    uint64_t g4_19 = 19 * g4;
+    uint128_t t0, t1, t2, t3, t4;
+
+    t0 = (uint128_t) f0 * g0 + (uint128_t) f1 * g4_19 + (uint128_t) f2 * g3_19 + (uint128_t) f3 * g2_19 + (uint128_t) f4 * g1_19;
+    t1 = (uint128_t) f0 * g1 + (uint128_t) f1 * g0 + (uint128_t) f2 * g4_19 + (uint128_t) f3 * g3_19 + (uint128_t) f4 * g2_19;
+    t2 = (uint128_t) f0 * g2 + (uint128_t) f1 * g1 + (uint128_t) f2 * g0 + (uint128_t) f3 * g4_19 + (uint128_t) f4 * g3_19;
+    t3 = (uint128_t) f0 * g3 + (uint128_t) f1 * g2 + (uint128_t) f2 * g1 + (uint128_t) f3 * g0 + (uint128_t) f4 * g4_19;
+    t4 = (uint128_t) f0 * g4 + (uint128_t) f1 * g3 + (uint128_t) f2 * g2 + (uint128_t) f3 * g1 + (uint128_t) f4 * g0;
+
+    fe_carry_wide(h, t0, t1, t2, t3, t4);
+}
+
+/*
+    h = f * f
+    Can overlap h with f.
+*/
+void fe_sq(fe h, const fe f) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t f0_2 = 2 * f0;
+    uint64_t f1_2 = 2 * f1;
+    uint64_t f2_2 = 2 * f2;
+    uint64_t f3_2 = 2 * f3;
+    uint64_t f3_19 = 19 * f3;
+    uint64_t f4_19 = 19 * f4;
+    uint128_t t0, t1, t2, t3, t4;
+
+    t0 = (uint128_t) f0 * f0 + (uint128_t) f1_2 * f4_19 + (uint128_t) f2_2 * f3_19;
+    t1 = (uint128_t) f0_2 * f1 + (uint128_t) f2_2 * f4_19 + (uint128_t) f3 * f3_19;
+    t2 = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) f3_2 * f4_19;
+    t3 = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4 * f4_19;
+    t4 = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+
+    fe_carry_wide(h, t0, t1, t2, t3, t4);
+}
+
+/*
+    h = 2 * f * f
+    Can overlap h with f.
+*/
+void fe_sq2(fe h, const fe f) {
+    uint64_t f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    uint64_t f0_2 = 2 * f0;
+    uint64_t f1_2 = 2 * f1;
+    uint64_t f2_2 = 2 * f2;
+    uint64_t f3_2 = 2 * f3;
+    uint64_t f3_19 = 19 * f3;
+    uint64_t f4_19 = 19 * f4;
+    uint128_t t0, t1, t2, t3, t4;
+
+    t0 = (uint128_t) f0 * f0 + (uint128_t) f1_2 * f4_19 + (uint128_t) f2_2 * f3_19;
+    t1 = (uint128_t) f0_2 * f1 + (uint128_t) f2_2 * f4_19 + (uint128_t) f3 * f3_19;
+    t2 = (uint128_t) f0_2 * f2 + (uint128_t) f1 * f1 + (uint128_t) f3_2 * f4_19;
+    t3 = (uint128_t) f0_2 * f3 + (uint128_t) f1_2 * f2 + (uint128_t) f4 * f4_19;
+    t4 = (uint128_t) f0_2 * f4 + (uint128_t) f1_2 * f3 + (uint128_t) f2 * f2;
+
+    fe_carry_wide(h, t0 << 1, t1 << 1, t2 << 1, t3 << 1, t4 << 1);
+}
+
+/*
+    h = f * 121666
+*/
+void fe_mul121666(fe h, fe f) {
+    fe_carry_wide(h, (uint128_t) f[0] * 121666, (uint128_t) f[1] * 121666, (uint128_t) f[2] * 121666,
+                  (uint128_t) f[3] * 121666, (uint128_t) f[4] * 121666);
+}
+
+#endif /* ED25519_FE51 */
@@ -1,5 +1,9 @@
 #include "ge.h"
+#if ED25519_FE51
+#include "precomp_data51.h"
+#else
 #include "precomp_data.h"
+#endif
 
 
 /*
@@ -65,9 +69,18 @@ B is the Ed25519 base point (x,4/5) with x positive.
 */
 
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b) {
+    ge_cached Ai[8];
+    ge_double_scalarmult_vartime_table(r, a, A, Ai, b);
+}
+
+/*
+same, with Ai[8] (scratch for A,3A,5A,7A,9A,11A,13A,15A: 1280 bytes with either field backend) supplied by the
+caller, so it needn't be on the stack
+*/
+
+void ge_double_scalarmult_vartime_table(ge_p2 *r, const unsigned char *a, const ge_p3 *A, ge_cached Ai[8], const unsigned char *b) {
     signed char aslide[256];
     signed char bslide[256];
-    ge_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
     ge_p1p1 t;
     ge_p3 u;
     ge_p3 A2;
@@ -130,6 +143,15 @@ void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3
 }
 
 
+#if ED25519_FE51
+static const fe d = {
+    929955233495203, 466365720129213, 1662059464998953, 2033849074728123, 1442794654840575
+};
+
+static const fe sqrtm1 = {
+    1718705420411056, 234908883556509, 2233514472574048, 2117202627021982, 765476049583133
+};
+#else
 static const fe d = {
     -10913610, 13857413, -15372611, 6949391, 114729, -8787816, -6275908, -3247719, -18696448, -12055116
 };
@@ -137,6 +159,7 @@ static const fe d = {
 static const fe sqrtm1 = {
     -32595792, -7943725, 9377950, 3500415, 12389472, -272473, -25146209, -2005654, 326686, 11406482
 };
+#endif
 
 int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s) {
     fe u;
@@ -295,9 +318,15 @@ void ge_p3_dbl(ge_p1p1 *r, const ge_p3 *p) {
 r = p
 */
 
+#if ED25519_FE51
+static const fe d2 = {
+    1859910466990425, 932731440258426, 1072319116312658, 1815898335770999, 633789495995903
+};
+#else
 static const fe d2 = {
     -21827239, -5839606, -30745221, 13898782, 229458, 15978800, -12551817, -6495438, 29715968, 9444199
 };
+#endif
 
 void ge_p3_to_cached(ge_cached *r, const ge_p3 *p) {
     fe_add(r->YplusX, p->Y, p->X);
@@ -389,7 +418,7 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     ge_p1p1 r;
     ge_p2 s;
     ge_precomp t;
-    int i;
+    int i, j;
 
     for (i = 0; i < 32; ++i) {
         e[2 * i + 0] = (a[i] >> 0) & 15;
@@ -411,24 +440,28 @@ void ge_scalarmult_base(ge_p3 *h, const unsigned char *a) {
     /* each e[i] is between -8 and 8 */
     ge_p3_0(h);
 
-    for (i = 1; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
-        ge_madd(&r, h, &t);
-        ge_p1p1_to_p3(h, &r);
-    }
+    /*
+    h = sum of e[i]*16^i*B, taking the digits ED25519_BASE_SPACING apart, from the
+    highest offset down, and multiplying h by 16 between offsets
+    */
+    for (j = ED25519_BASE_SPACING - 1; j >= 0; --j) {
+        for (i = j; i < 64; i += ED25519_BASE_SPACING) {
+            select(&t, i / ED25519_BASE_SPACING, e[i]);
+            ge_madd(&r, h, &t);
+            ge_p1p1_to_p3(h, &r);
+        }
+
+        if (j == 0) {
+            break;
+        }
 
-    ge_p3_dbl(&r, h);
-    ge_p1p1_to_p2(&s, &r);
-    ge_p2_dbl(&r, &s);
-    ge_p1p1_to_p2(&s, &r);
-    ge_p2_dbl(&r, &s);
-    ge_p1p1_to_p2(&s, &r);
-    ge_p2_dbl(&r, &s);
-    ge_p1p1_to_p3(h, &r);
-
-    for (i = 0; i < 64; i += 2) {
-        select(&t, i / 2, e[i]);
-        ge_madd(&r, h, &t);
+        ge_p3_dbl(&r, h);
+        ge_p1p1_to_p2(&s, &r);
+        ge_p2_dbl(&r, &s);
+        ge_p1p1_to_p2(&s, &r);
+        ge_p2_dbl(&r, &s);
+        ge_p1p1_to_p2(&s, &r);
+        ge_p2_dbl(&r, &s);
         ge_p1p1_to_p3(h, &r);
     }
 }
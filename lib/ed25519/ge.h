@@ -4,6 +4,27 @@
 #include "fe.h"
 
 
+/*
+    ED25519_BASE_TABLE_ROWS sets the size of the fixed-base table used by ge_scalarmult_base(), ie. by key
+    generation, signing and key exchange: 8, 16, 32 (ref10's table) or 64 rows of 8 points, 960 bytes of flash
+    per row. A smaller table costs more point doublings per scalar multiplication (on top of its 64 additions):
+      64 rows - 61440 bytes, no doublings
+      32 rows - 30720 bytes, 4 doublings
+      16 rows - 15360 bytes, 12 doublings
+       8 rows -  7680 bytes, 28 doublings
+*/
+#ifndef ED25519_BASE_TABLE_ROWS
+    #define ED25519_BASE_TABLE_ROWS 32
+#endif
+
+#if ED25519_BASE_TABLE_ROWS != 8 && ED25519_BASE_TABLE_ROWS != 16 && ED25519_BASE_TABLE_ROWS != 32 && ED25519_BASE_TABLE_ROWS != 64
+    #error "ED25519_BASE_TABLE_ROWS must be 8, 16, 32 or 64"
+#endif
+
+/* radix-16 digit positions between table rows */
+#define ED25519_BASE_SPACING (64 / ED25519_BASE_TABLE_ROWS)
+
+
 /*
 ge means group element.
 
@@ -58,6 +79,7 @@ int ge_frombytes_negate_vartime(ge_p3 *h, const unsigned char *s);
 void ge_add(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_sub(ge_p1p1 *r, const ge_p3 *p, const ge_cached *q);
 void ge_double_scalarmult_vartime(ge_p2 *r, const unsigned char *a, const ge_p3 *A, const unsigned char *b);
+void ge_double_scalarmult_vartime_table(ge_p2 *r, const unsigned char *a, const ge_p3 *A, ge_cached Ai[8], const unsigned char *b);
 void ge_madd(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_msub(ge_p1p1 *r, const ge_p3 *p, const ge_precomp *q);
 void ge_scalarmult_base(ge_p3 *h, const unsigned char *a);
@@ -0,0 +1,2848 @@
+/* precomp_data.h, converted to the 5 x 51 bit limb field elements of the ED25519_FE51 backend */
+static const ge_precomp Bi[8] = {
+    {
+        { 1288382639258501, 245678601348599, 269427782077623, 1462984067271730, 137412439391563 },
+        { 62697248952638, 204681361388450, 631292143396476, 338455783676468, 1213667448819585 },
+        { 301289933810280, 1259582250014073, 1422107436869536, 796239922652654, 1953934009299142 },
+    },
+    {
+        { 1601611775252272, 1720807796594148, 1132070835939856, 1260455018889551, 2147779492816911 },
+        { 316559037616741, 2177824224946892, 1459442586438991, 1461528397712656, 751590696113597 },
+        { 1850748884277385, 1200145853858453, 1068094770532492, 672251375690438, 1586055907191707 },
+    },
+    {
+        { 769950342298419, 132954430919746, 844085933195555, 974092374476333, 726076285546016 },
+        { 425251763115706, 608463272472562, 442562545713235, 837766094556764, 374555092627893 },
+        { 1086255230780037, 274979815921559, 1960002765731872, 929474102396301, 1190409889297339 },
+    },
+    {
+        { 665000864555967, 2065379846933859, 370231110385876, 350988370788628, 1233371373142985 },
+        { 2019367628972465, 676711900706637, 110710997811333, 1108646842542025, 517791959672113 },
+        { 965130719900578, 247011430587952, 526356006571389, 91986625355052, 2157223321444601 },
+    },
+    {
+        { 1802695059465007, 1664899123557221, 593559490740857, 2160434469266659, 927570450755031 },
+        { 1725674970513508, 1933645953859181, 1542344539275782, 1767788773573747, 1297447965928905 },
+        { 1381809363726107, 1430341051343062, 2061843536018959, 1551778050872521, 2036394857967624 },
+    },
+    {
+        { 1970894096313054, 528066325833207, 1619374932191227, 2207306624415883, 1169170329061080 },
+        { 2070390218572616, 1458919061857835, 624171843017421, 1055332792707765, 433987520732508 },
+        { 893653801273833, 1168026499324677, 1242553501121234, 1306366254304474, 1086752658510815 },
+    },
+    {
+        { 213454002618221, 939771523987438, 1159882208056014, 317388369627517, 621213314200687 },
+        { 1971678598905747, 338026507889165, 762398079972271, 655096486107477, 42299032696322 },
+        { 177130678690680, 1754759263300204, 1864311296286618, 1180675631479880, 1292726903152791 },
+    },
+    {
+        { 1913163449625248, 460779200291993, 2193883288642314, 1008900146920800, 1721983679009502 },
+        { 1070401523076875, 1272492007800961, 1910153608563310, 2075579521696771, 1191169788841221 },
+        { 692896803108118, 500174642072499, 2068223309439677, 1162190621851337, 1426986007309901 },
+    },
+};
+
+
+/* base[i][j] = (j+1)*16^(i*ED25519_BASE_SPACING)*B, ie. only every ED25519_BASE_SPACING'th row is compiled in */
+static const ge_precomp base[64 / ED25519_BASE_SPACING][8] = {
+    {
+        {
+            { 1288382639258501, 245678601348599, 269427782077623, 1462984067271730, 137412439391563 },
+            { 62697248952638, 204681361388450, 631292143396476, 338455783676468, 1213667448819585 },
+            { 301289933810280, 1259582250014073, 1422107436869536, 796239922652654, 1953934009299142 },
+        },
+        {
+            { 1380971894829527, 790832306631236, 2067202295274102, 1995808275510000, 1566530869037010 },
+            { 463307831301544, 432984605774163, 1610641361907204, 750899048855000, 1894842303421586 },
+            { 748439484463711, 1033211726465151, 1396005112841647, 1611506220286469, 1972177495910992 },
+        },
+        {
+            { 1601611775252272, 1720807796594148, 1132070835939856, 1260455018889551, 2147779492816911 },
+            { 316559037616741, 2177824224946892, 1459442586438991, 1461528397712656, 751590696113597 },
+            { 1850748884277385, 1200145853858453, 1068094770532492, 672251375690438, 1586055907191707 },
+        },
+        {
+            { 934282339813791, 1846903124198670, 1172395437954843, 1007037127761661, 1830588347719256 },
+            { 1694390458783935, 1735906047636159, 705069562067493, 648033061693059, 696214010414170 },
+            { 1121406372216585, 192876649532226, 190294192191717, 1994165897297032, 2245000007398739 },
+        },
+        {
+            { 769950342298419, 132954430919746, 844085933195555, 974092374476333, 726076285546016 },
+            { 425251763115706, 608463272472562, 442562545713235, 837766094556764, 374555092627893 },
+            { 1086255230780037, 274979815921559, 1960002765731872, 929474102396301, 1190409889297339 },
+        },
+        {
+            { 1388594989461809, 316767091099457, 394298842192982, 1230079486801005, 1440737038838979 },
+            { 7380825640100, 146210432690483, 304903576448906, 1198869323871120, 997689833219095 },
+            { 1181317918772081, 114573476638901, 262805072233344, 265712217171332, 294181933805782 },
+        },
+        {
+            { 665000864555967, 2065379846933859, 370231110385876, 350988370788628, 1233371373142985 },
+            { 2019367628972465, 676711900706637, 110710997811333, 1108646842542025, 517791959672113 },
+            { 965130719900578, 247011430587952, 526356006571389, 91986625355052, 2157223321444601 },
+        },
+        {
+            { 2068619540119183, 1966274918058806, 957728544705549, 729906502578991, 159834893065166 },
+            { 2073601412052185, 31021124762708, 264500969797082, 248034690651703, 1030252227928288 },
+            { 551790716293402, 1989538725166328, 801169423371717, 2052451893578887, 678432056995012 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1412482364088822, 1810590036362821, 923779398567548, 2023841154802081, 355905946953295 },
+            { 89929455382003, 409881867087833, 601740464114195, 1198413365513369, 1353640795548072 },
+            { 1825728698698411, 497946242397168, 105715611816086, 968568072676853, 592999326381074 },
+        },
+        {
+            { 697390239916431, 1979948019919137, 219386298782941, 1322163545375974, 2216896082446062 },
+            { 2243384404640579, 785474317161769, 1966836974893905, 484861779306458, 182878807563947 },
+            { 743917567567859, 870447381138646, 392196079309387, 1786878704882853, 1520161635991866 },
+        },
+        {
+            { 837738163844765, 1888948267748046, 1789290739253972, 345950321621651, 890962267685143 },
+            { 240845230049176, 892862609315587, 742407066185927, 398043635328896, 420093919257918 },
+            { 1764333363430455, 898309455329908, 1381444383468949, 620561614151766, 158377983927494 },
+        },
+        {
+            { 17312075132209, 979788843744677, 871430968010085, 1299656894822779, 1180051671372258 },
+            { 1437746335671579, 1161524116603216, 612164096500525, 996617112698868, 969716318261981 },
+            { 407953783981, 1647278360877740, 584504284208188, 906066565536232, 1341016264992694 },
+        },
+        {
+            { 129625489252573, 1387820520945503, 874186954557962, 211932663503866, 1933613400499820 },
+            { 180546948364949, 2161170911946791, 1670848345551833, 753642680531476, 2190316738651690 },
+            { 286790540720370, 376171092666609, 1535083117539001, 143466475958698, 1595136426572043 },
+        },
+        {
+            { 577289733493044, 1790256014216199, 1797656649279268, 311091238837443, 493980515519392 },
+            { 2025760966125832, 102033327397065, 115646513104586, 1232705905425061, 485822002465270 },
+            { 62004126799683, 1668357417723485, 402010966421038, 827662362499868, 620754241677270 },
+        },
+        {
+            { 1227888687423439, 661378171709698, 160494423168774, 553331170800292, 1308360976872087 },
+            { 1667596759313896, 1586859001230089, 1499039432506846, 1474874425327380, 1579412813166531 },
+            { 1643929373822818, 59659873139317, 1165353313134798, 2003225793255085, 1953102130608543 },
+        },
+        {
+            { 898618711827587, 1314215296781160, 1302503840208753, 1244939174414641, 1698289814254751 },
+            { 1863200156658018, 1022256865883135, 1702323481131932, 1517463390341654, 1993268869301555 },
+            { 1392999845620760, 634309693840701, 815492400002072, 340703897996290, 2038693787178716 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 1368953770187805, 790347636712921, 437508475667162, 2142576377050580, 1932081720066286 },
+            { 953638594433374, 1092333936795051, 1419774766716690, 805677984380077, 859228993502513 },
+            { 1200766035879111, 20142053207432, 1465634435977050, 1645256912097844, 295121984874596 },
+        },
+        {
+            { 1735718747031557, 1248237894295956, 1204753118328107, 976066523550493, 65943769534592 },
+            { 1060098822528990, 1586825862073490, 212301317240126, 1975302711403555, 666724059764335 },
+            { 1091990273418756, 1572899409348578, 80968014455247, 306009358661350, 1520450739132526 },
+        },
+        {
+            { 1480517209436112, 1511153322193952, 1244343858991172, 304788150493241, 369136856496443 },
+            { 2151330273626164, 762045184746182, 1688074332551515, 823046109005759, 907602769079491 },
+            { 2047386910586836, 168470092900250, 1552838872594810, 340951180073789, 360819374702533 },
+        },
+        {
+            { 1982622644432056, 2014393600336956, 128909208804214, 1617792623929191, 105294281913815 },
+            { 980234343912898, 1712256739246056, 588935272190264, 204298813091998, 841798321043288 },
+            { 197561292938973, 454817274782871, 1963754960082318, 2113372252160468, 971377527342673 },
+        },
+        {
+            { 164699448829328, 3127451757672, 1199504971548753, 1766155447043652, 1899238924683527 },
+            { 732262946680281, 1674412764227063, 2182456405662809, 1350894754474250, 558458873295247 },
+            { 2103305098582922, 1960809151316468, 715134605001343, 1454892949167181, 40827143824949 },
+        },
+        {
+            { 1239289043050212, 1744654158124578, 758702410031698, 1796762995074688, 1603056663766 },
+            { 2232056027107988, 987343914584615, 2115594492994461, 1819598072792159, 1119305654014850 },
+            { 320153677847348, 939613871605645, 641883205761567, 1930009789398224, 329165806634126 },
+        },
+        {
+            { 980930490474130, 1242488692177893, 1251446316964684, 1086618677993530, 1961430968465772 },
+            { 276821765317453, 1536835591188030, 1305212741412361, 61473904210175, 2051377036983058 },
+            { 833449923882501, 1750270368490475, 1123347002068295, 185477424765687, 278090826653186 },
+        },
+        {
+            { 794524995833413, 1849907304548286, 53348672473145, 1272368559505217, 1147304168324779 },
+            { 1504846112759364, 1203096289004681, 562139421471418, 274333017451844, 1284344053775441 },
+            { 483048732424432, 2116063063343382, 30120189902313, 292451576741007, 1156379271702225 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 423177393666002, 81745418621691, 2028971153113313, 476357540333955, 1525930694244524 },
+            { 2111527632783832, 450040158835276, 2024085682500627, 1804656400081649, 1628769314539400 },
+            { 1435691822393684, 1850026012837208, 2218717487026642, 81859254010196, 244808221751742 },
+        },
+        {
+            { 821837003520378, 1758499246064311, 611427618116979, 1826926617406750, 190751450672812 },
+            { 1899219292317099, 301143383160140, 1505423608269154, 262436526053886, 1603944942225467 },
+            { 1428688544729295, 109069749881410, 270830364539996, 1755181768867140, 162349670944771 },
+        },
+        {
+            { 387321772446342, 157157592651549, 1734448286334816, 737995238873311, 2164082093074358 },
+            { 138427770525630, 1006458583514274, 50156603826175, 564841532066850, 1867325910960689 },
+            { 309881142350067, 2106019349943259, 816133263871674, 2018031260992166, 1563425406132832 },
+        },
+        {
+            { 1498799085180043, 1744340656397133, 2064851197592072, 178034001090864, 2145324400616904 },
+            { 2143695105244535, 759647590919964, 1665346117918695, 508167339935601, 1875842900408800 },
+            { 614788980313577, 1501513053451003, 1472055221710495, 1920317897819127, 2208964791748263 },
+        },
+        {
+            { 2150595732685719, 864120654414656, 1640951315905192, 1214130519042771, 456097105512669 },
+            { 1308984279657470, 490762851431257, 1003676583936381, 2193756292296678, 450872048228751 },
+            { 612249867445962, 159208429955777, 563950177277347, 561041393363217, 1270750549218661 },
+        },
+        {
+            { 2055033216205046, 210032758889177, 490891442200825, 1052243367900375, 500299953983352 },
+            { 16580842158665, 1696274359000911, 2124389411830829, 139711129303025, 888869530492522 },
+            { 1827261746419924, 1468053133723229, 425022050209163, 1161272199376693, 589189496874922 },
+        },
+        {
+            { 2005207463235272, 2001528853385595, 1602253387656095, 850080090066646, 123526059515759 },
+            { 2186723082510000, 1171729756607414, 378838991362655, 1322228051184542, 2245735889737124 },
+            { 847469444462207, 318959830531389, 408429171873782, 1661514071773102, 909441091898553 },
+        },
+        {
+            { 2174491994328155, 493557282042709, 1350905374864565, 998113744991988, 496681585664265 },
+            { 1850443852254769, 1964063521171136, 2156578506765080, 119377851781170, 1787528661543958 },
+            { 758760864397232, 1830650226770835, 326981597370189, 1345979301472296, 174985669849506 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 928372153029038, 2147692869914564, 1455665844462196, 1986737809425946, 185207050258089 },
+            { 137732961814206, 706670923917341, 1387038086865771, 1965643813686352, 1384777115696347 },
+            { 481144981981577, 2053319313589856, 2065402289827512, 617954271490316, 1106602634668125 },
+        },
+        {
+            { 696298019648792, 893299659040895, 1148636718636009, 26734077349617, 2203955659340681 },
+            { 657390353372855, 998499966885562, 991893336905797, 810470207106761, 343139804608786 },
+            { 791736669492960, 934767652997115, 824656780392914, 1759463253018643, 361530362383518 },
+        },
+        {
+            { 2022541353055597, 2094700262587466, 1551008075025686, 242785517418164, 695985404963562 },
+            { 1287487199965223, 2215311941380308, 1552928390931986, 1664859529680196, 1125004975265243 },
+            { 677434665154918, 989582503122485, 1817429540898386, 1052904935475344, 1143826298169798 },
+        },
+        {
+            { 367266328308408, 318431188922404, 695629353755355, 634085657580832, 24581612564426 },
+            { 773360688841258, 1815381330538070, 363773437667376, 539629987070205, 783280434248437 },
+            { 180820816194166, 168937968377394, 748416242794470, 1227281252254508, 1567587861004268 },
+        },
+        {
+            { 478775558583645, 2062896624554807, 699391259285399, 358099408427873, 1277310261461761 },
+            { 1984740906540026, 1079164179400229, 1056021349262661, 1659958556483663, 1088529069025527 },
+            { 580736401511151, 1842931091388998, 1177201471228238, 2075460256527244, 1301133425678027 },
+        },
+        {
+            { 1515728832059182, 1575261009617579, 1510246567196186, 191078022609704, 116661716289141 },
+            { 1295295738269652, 1714742313707026, 545583042462581, 2034411676262552, 1513248090013606 },
+            { 230710545179830, 30821514358353, 760704303452229, 390668103790604, 573437871383156 },
+        },
+        {
+            { 1169380107545646, 263167233745614, 2022901299054448, 819900753251120, 2023898464874585 },
+            { 2102254323485823, 1570832666216754, 34696906544624, 1993213739807337, 70638552271463 },
+            { 894132856735058, 548675863558441, 845349339503395, 1942269668326667, 1615682209874691 },
+        },
+        {
+            { 1287670217537834, 1222355136884920, 1846481788678694, 1150426571265110, 1613523400722047 },
+            { 793388516527298, 1315457083650035, 1972286999342417, 1901825953052455, 338269477222410 },
+            { 550201530671806, 778605267108140, 2063911101902983, 115500557286349, 2041641272971022 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1907837041515237, 898421797873440, 1363421772307007, 1869148099628409, 252053503603382 },
+            { 1983475287633675, 383067298392598, 1529372645239762, 271237723417042, 16306006127885 },
+            { 45902352975738, 1246446699820833, 173320410042641, 1542230462600972, 692910725375140 },
+        },
+        {
+            { 710084928405467, 2105676789486896, 168843193799662, 353334820683649, 1050869817514446 },
+            { 2234556940968142, 508383103687203, 548677296961294, 1801756227307155, 763581134184080 },
+            { 2191680341805656, 1972509245077282, 981795995975654, 852454486043614, 1189735660434765 },
+        },
+        {
+            { 1743977233997800, 1581920097003352, 192244940755923, 2232313400412572, 1420975603500953 },
+            { 394331370968199, 375506683250477, 178987122837126, 1628597680090539, 1981626777721129 },
+            { 1931343025077052, 1393738210614177, 622857924319466, 1123524882306454, 1963513295012502 },
+        },
+        {
+            { 1850504730697909, 2129879659168370, 2011448898092861, 2090154061858281, 1857166627539261 },
+            { 93122640069162, 80390620181922, 904913824687012, 878714325670358, 2009239140681625 },
+            { 1509035496076582, 1583601071466027, 421912810565136, 1678479534084506, 2033502297510813 },
+        },
+        {
+            { 2238137325796934, 1165391281982950, 2048774700033766, 1309041739154703, 952882074105884 },
+            { 648683464284688, 918118399351936, 1745356360731796, 498388366566450, 2218312233818996 },
+            { 520151332809519, 1588829471961614, 2166353389460390, 404024831468766, 1335244071323823 },
+        },
+        {
+            { 276674675630644, 2071299735249834, 367425156502024, 1019665374394195, 1519932762444250 },
+            { 140650035965992, 4102126210825, 1340382612618316, 1431330732152485, 95392378361840 },
+            { 1935180256227856, 250757393177447, 1959439731378182, 1297506762666169, 575184640324100 },
+        },
+        {
+            { 1312014106178185, 1486712601904121, 727281996805526, 1807789883906315, 1294755680282130 },
+            { 1746208083129163, 286040119208595, 923407701729416, 1058134233102422, 2156333962869932 },
+            { 1438068615152094, 34949160848567, 1911746456436447, 1412684293826264, 1046374507505090 },
+        },
+        {
+            { 1493476678908327, 1067355251760666, 2088667670293412, 1347426012722422, 874958688794590 },
+            { 1106398809275628, 1328345218773061, 1782306826891988, 2161245407418976, 674877440657824 },
+            { 1428599160764785, 602821281250279, 1877258833313507, 333285098655770, 740310036947361 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 717255318455100, 519313764361315, 2080406977303708, 541981206705521, 774328150311600 },
+            { 261715221532238, 1795354330069993, 1496878026850283, 499739720521052, 389031152673770 },
+            { 1997217696294013, 1717306351628065, 1684313917746180, 1644426076011410, 1857378133465451 },
+        },
+        {
+            { 1475434724792648, 76931896285979, 1116729029771667, 2002544139318042, 725547833803938 },
+            { 2022306639183567, 726296063571875, 315345054448644, 1058733329149221, 1448201136060677 },
+            { 1710065158525665, 1895094923036397, 123988286168546, 1145519900776355, 1607510767693874 },
+        },
+        {
+            { 561605375422540, 1071733543815037, 131496498800990, 1946868434569999, 828138133964203 },
+            { 1548495173745801, 442310529226540, 998072547000384, 553054358385281, 644824326376171 },
+            { 1445526537029440, 2225519789662536, 914628859347385, 1064754194555068, 1660295614401091 },
+        },
+        {
+            { 1199690223111956, 24028135822341, 66638289244341, 57626156285975, 565093967979607 },
+            { 876926774220824, 554618976488214, 1012056309841565, 839961821554611, 1414499340307677 },
+            { 703047626104145, 1266841406201770, 165556500219173, 486991595001879, 1011325891650656 },
+        },
+        {
+            { 1622861044480487, 1156394801573634, 1869132565415504, 327103985777730, 2095342781472284 },
+            { 334886927423922, 489511099221528, 129160865966726, 1720809113143481, 619700195649254 },
+            { 1646545795166119, 1758370782583567, 714746174550637, 1472693650165135, 898994790308209 },
+        },
+        {
+            { 333403773039279, 295772542452938, 1693106465353610, 912330357530760, 471235657950362 },
+            { 1811196219982022, 1068969825533602, 289602974833439, 1988956043611592, 863562343398367 },
+            { 906282429780072, 2108672665779781, 432396390473936, 150625823801893, 1708930497638539 },
+        },
+        {
+            { 925664675702328, 21416848568684, 1831436641861340, 601157008940113, 371818055044496 },
+            { 1479786007267725, 1738881859066675, 68646196476567, 2146507056100328, 1247662817535471 },
+            { 52035296774456, 939969390708103, 312023458773250, 59873523517659, 1231345905848899 },
+        },
+        {
+            { 643355106415761, 290186807495774, 2013561737429023, 319648069511546, 393736678496162 },
+            { 129358342392716, 1932811617704777, 1176749390799681, 398040349861790, 1170779668090425 },
+            { 2051980782668029, 121859921510665, 2048329875753063, 1235229850149665, 519062146124755 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 622985803843745, 1037465406252873, 1045087237459432, 35039786059068, 786748793374779 },
+            { 1081639936085048, 107037096524550, 982783085397386, 1478794236122441, 1973445033407428 },
+            { 1152063960223905, 1495207756023516, 403624329924470, 288757773501508, 634701074033280 },
+        },
+        {
+            { 666083887617405, 673285785424434, 1762910413161601, 912132719741983, 462281505628903 },
+            { 2036807708438173, 343296519154494, 203759671035838, 631607941505392, 1537534416157211 },
+            { 204576686258175, 1916354881141604, 2182213405559566, 836541881049164, 1393662576855498 },
+        },
+        {
+            { 1429326167011008, 1597736985440061, 15497090767177, 1401818346447299, 2008400870233861 },
+            { 1255845370440482, 1941641023944959, 741447215809463, 71123411326285, 958784689852576 },
+            { 1583200791922713, 581155064879634, 776749520692821, 82151283071376, 1733847968592305 },
+        },
+        {
+            { 471657679736049, 36304457446248, 1889807602666694, 571526543144584, 2151183507738315 },
+            { 1320619393211836, 1830783765803799, 733116888584824, 192154761237340, 1836129819319417 },
+            { 216379584390389, 359329711860756, 2220840445637019, 1935487238453911, 314381139238943 },
+        },
+        {
+            { 2134908988986295, 710707389294819, 1681144354786143, 1678261855220080, 2165079891714277 },
+            { 1820833315022596, 1614503197118753, 768314454089893, 439418882707913, 444366931195669 },
+            { 839191618399610, 151822034158330, 65272611705697, 938153274860627, 14360318777459 },
+        },
+        {
+            { 1473478682616257, 1381582770189518, 1909784146543314, 1098186893113858, 993668408613516 },
+            { 866614735832317, 247068397163249, 2137773260671377, 1435769942740467, 835303919685078 },
+            { 364270308207016, 667227739516977, 122427551474936, 957177061876827, 1110258403339423 },
+        },
+        {
+            { 1475819827325245, 1181551732606965, 348788859640155, 217255130824332, 1133565804562478 },
+            { 2004412139637791, 1152281141937617, 644111456763199, 1263546682508663, 1745485513281276 },
+            { 858909692206820, 61057235030988, 1105898533486092, 2202030785898301, 1422234761465688 },
+        },
+        {
+            { 1354120322856557, 1315215183190037, 873849392207479, 969776210885688, 1552605391252884 },
+            { 62769891776663, 1685142666023085, 443051725399699, 1094137944849531, 1786990183014737 },
+            { 758252632702114, 914226082256766, 434171717412081, 779505540917105, 51590353584795 },
+        },
+    },
+#endif
+    {
+        {
+            { 1608170971973096, 415809060360428, 1350468408164766, 2038620059057678, 1026904485989112 },
+            { 1837656083115103, 1510134048812070, 906263674192061, 1821064197805734, 565375124676301 },
+            { 578027192365650, 2034800251375322, 2128954087207123, 478816193810521, 2196171989962750 },
+        },
+        {
+            { 1633188840273139, 852787172373708, 1548762607215796, 1266275218902681, 1107218203325133 },
+            { 462189358480054, 1784816734159228, 1611334301651368, 1303938263943540, 707589560319424 },
+            { 1038829280972848, 38176604650029, 753193246598573, 1136076426528122, 595709990562434 },
+        },
+        {
+            { 1408451820859834, 2194984964010833, 2198361797561729, 1061962440055713, 1645147963442934 },
+            { 4701053362120, 1647641066302348, 1047553002242085, 1923635013395977, 206970314902065 },
+            { 1750479161778571, 1362553355169293, 1891721260220598, 966109370862782, 1024913988299801 },
+        },
+        {
+            { 212699049131723, 1117950018299775, 1873945661751056, 1403802921984058, 130896082652698 },
+            { 636808533673210, 1262201711667560, 390951380330599, 1663420692697294, 561951321757406 },
+            { 520731594438141, 1446301499955692, 273753264629267, 1565101517999256, 1019411827004672 },
+        },
+        {
+            { 926527492029409, 1191853477411379, 734233225181171, 184038887541270, 1790426146325343 },
+            { 1464651961852572, 1483737295721717, 1519450561335517, 1161429831763785, 405914998179977 },
+            { 996126634382301, 796204125879525, 127517800546509, 344155944689303, 615279846169038 },
+        },
+        {
+            { 738724080975276, 2188666632415296, 1961313708559162, 1506545807547587, 1151301638969740 },
+            { 622917337413835, 1218989177089035, 1284857712846592, 970502061709359, 351025208117090 },
+            { 2067814584765580, 1677855129927492, 2086109782475197, 235286517313238, 1416314046739645 },
+        },
+        {
+            { 586844262630358, 307444381952195, 458399356043426, 602068024507062, 1028548203415243 },
+            { 678489922928203, 2016657584724032, 90977383049628, 1026831907234582, 615271492942522 },
+            { 301225714012278, 1094837270268560, 1202288391010439, 644352775178361, 1647055902137983 },
+        },
+        {
+            { 1210746697896478, 1416608304244708, 686487477217856, 1245131191434135, 1051238336855737 },
+            { 1135604073198207, 1683322080485474, 769147804376683, 2086688130589414, 900445683120379 },
+            { 1971518477615628, 401909519527336, 448627091057375, 1409486868273821, 1214789035034363 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1773953341907125, 1826809791300708, 924874532383668, 712490100943736, 748251880846901 },
+            { 1773696272644354, 524584715796245, 2052807431577622, 1474261915840483, 1472344085384396 },
+            { 1048828262296911, 626018299495748, 1536855937015065, 557005099579827, 205000143299648 },
+        },
+        {
+            { 941815577996700, 1930911276112812, 749821254542917, 1967675522206375, 892948220720651 },
+            { 1434849833149473, 1179935727179617, 1288878261580880, 251520331051845, 2174778140013271 },
+            { 39364207708032, 54077643340559, 47072300438335, 484490203728205, 330170579231628 },
+        },
+        {
+            { 1020447780607298, 551245056565558, 1618835409581890, 673850310162293, 354159319190084 },
+            { 199234941368169, 1039878917333290, 1138631272437872, 1506846618426377, 651537961859356 },
+            { 1190283817822151, 29815862110548, 1401771831527381, 1814017508050437, 751331585591881 },
+        },
+        {
+            { 2159866514586362, 1758376548473728, 1635569740383557, 192110938352718, 2023235829583534 },
+            { 605995978939884, 48218004293082, 461040418591673, 316385510440522, 1980476765721118 },
+            { 535848012622913, 543536404720769, 149076814975879, 1567757637416350, 1002851193383852 },
+        },
+        {
+            { 850247344591371, 1642810784021239, 1974409276090170, 1605973976114297, 1350011424543020 },
+            { 1563762061819676, 483704726889726, 378890223689177, 614454628872887, 138207457619482 },
+            { 66796032196982, 83108349878636, 1058512765854606, 355785880766958, 2173660513649027 },
+        },
+        {
+            { 1941123290917747, 65177497691743, 661963569507333, 1172954226263396, 1951085968954154 },
+            { 633834845666480, 1266075508915353, 932911917033228, 2013039593891141, 2014375254042349 },
+            { 1331723279107642, 360406964548232, 602431788387748, 1292398959539176, 347247628588850 },
+        },
+        {
+            { 2170226002806049, 1739335733478471, 1765672611311764, 666860341980082, 542065866111114 },
+            { 928917294762421, 827086505179749, 79913563808991, 1363419744736215, 1159465025606665 },
+            { 245885669910192, 255454579697350, 869246923980317, 823008017430135, 2047987637517532 },
+        },
+        {
+            { 1363748633264621, 134440781639129, 1969460953567930, 687618113673021, 1831662708850446 },
+            { 484597594561270, 1872466346130086, 1773863188829220, 2151270062723810, 574178361260864 },
+            { 1325588019367749, 1763566216507756, 445592400440775, 1009027711126237, 1471076108623188 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 1364039144731711, 1897497433586190, 2203097701135459, 145461396811251, 1349844460790699 },
+            { 1045230323257973, 818206601145807, 630513189076103, 1672046528998132, 807204017562437 },
+            { 439961968385997, 386362664488986, 1382706320807688, 309894000125359, 2207801346498567 },
+        },
+        {
+            { 1229004686397588, 920643968530863, 123975893911178, 681423993215777, 1400559197080973 },
+            { 2003766096898049, 170074059235165, 1141124258967971, 1485419893480973, 1573762821028725 },
+            { 729905708611432, 1270323270673202, 123353058984288, 426460209632942, 2195574535456672 },
+        },
+        {
+            { 1271140255321235, 2044363183174497, 52125387634689, 1445120246694705, 942541986339084 },
+            { 1761608437466135, 583360847526804, 1586706389685493, 2157056599579261, 1170692369685772 },
+            { 871476219910823, 1878769545097794, 2241832391238412, 548957640601001, 690047440233174 },
+        },
+        {
+            { 297194732135507, 1366347803776820, 1301185512245601, 561849853336294, 1533554921345731 },
+            { 999628998628371, 1132836708493400, 2084741674517453, 469343353015612, 678782988708035 },
+            { 2189427607417022, 699801937082607, 412764402319267, 1478091893643349, 2244675696854460 },
+        },
+        {
+            { 1712292055966563, 204413590624874, 1405738637332841, 408981300829763, 861082219276721 },
+            { 508561155940631, 966928475686665, 2236717801150132, 424543858577297, 2089272956986143 },
+            { 221245220129925, 1156020201681217, 491145634799213, 542422431960839, 828100817819207 },
+        },
+        {
+            { 153756971240384, 1299874139923977, 393099165260502, 1058234455773022, 996989038681183 },
+            { 559086812798481, 573177704212711, 1629737083816402, 1399819713462595, 1646954378266038 },
+            { 1887963056288059, 228507035730124, 1468368348640282, 930557653420194, 613513962454686 },
+        },
+        {
+            { 1224529808187553, 1577022856702685, 2206946542980843, 625883007765001, 279930793512158 },
+            { 1076287717051609, 1114455570543035, 187297059715481, 250446884292121, 1885187512550540 },
+            { 902497362940219, 76749815795675, 1657927525633846, 1420238379745202, 1340321636548352 },
+        },
+        {
+            { 1129576631190784, 1281994010027327, 996844254743018, 257876363489249, 1150850742055018 },
+            { 628740660038789, 1943038498527841, 467786347793886, 1093341428303375, 235413859513003 },
+            { 237425418909360, 469614029179605, 1512389769174935, 1241726368345357, 441602891065214 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1326059070986772, 1683859889439034, 800400358642626, 1553800812119228, 1435890639134217 },
+            { 10289322871173, 960938633288362, 54790899094325, 355480603420821, 769816521286162 },
+            { 1081752225631401, 201284952113932, 1619339403526661, 1533363030164674, 1727571790703503 },
+        },
+        {
+            { 899735975760499, 1741766716299829, 1742063303545331, 2027626928190420, 2245203856982753 },
+            { 1954377740831254, 964432157821305, 1474491321949063, 395839918315184, 1677872381409569 },
+            { 868012933261061, 1472665613225898, 1744063644616181, 1350305502884983, 2227467074628670 },
+        },
+        {
+            { 1335230745886941, 598728549596672, 722417037613414, 976095242318001, 1349661756105254 },
+            { 165457682597283, 1146916011393707, 790234092480115, 1826324642155959, 1162742112144696 },
+            { 1313383948772993, 1074655824143287, 20040386640896, 305794891855170, 2123092901229151 },
+        },
+        {
+            { 492643442569612, 1013874505344584, 1972732629285783, 1936827407065469, 1830481951704579 },
+            { 1948145815698108, 1342521170841730, 1978080278356424, 1881064851625948, 229238155064023 },
+            { 634737804354539, 422989080575800, 1774993942417585, 688011718282303, 581542014403477 },
+        },
+        {
+            { 265399853542438, 856367096857962, 378771815533299, 1768604592283814, 1437163645108878 },
+            { 565089126521862, 1651981693498760, 1364270015682434, 1021850589179420, 1529046392923632 },
+            { 1683677903016217, 2036167240589310, 262287609979509, 977873833112269, 433284640623898 },
+        },
+        {
+            { 1755760392036140, 2130115351478138, 442625433812754, 2043622709923143, 86495244370338 },
+            { 973803294013993, 865469347514382, 1546238264282843, 1531400184873330, 852951437390016 },
+            { 1425112218383847, 329346717672590, 378517748485393, 1806152114945447, 1211275024279312 },
+        },
+        {
+            { 1968587687914188, 629221916684842, 1429009633828433, 518276827442332, 2012343565772576 },
+            { 1342915774787253, 1592245673934951, 2232778725092237, 861867335158983, 2085695411008232 },
+            { 1629969809602186, 1106234784906336, 863587490378700, 1792807263239898, 1429043938024750 },
+        },
+        {
+            { 1973106012015851, 342123586374596, 833516958919696, 2182197879897069, 1721403407106648 },
+            { 1234205143570590, 574413568977114, 1646424797106159, 300930903818472, 929000726436362 },
+            { 1591076166555979, 849361769125080, 1443799738863429, 166584794343739, 1861773413238536 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 1736417953058555, 726531315520508, 1833335034432527, 1629442561574747, 624418919286085 },
+            { 1960754663920689, 497040957888962, 1909832851283095, 1271432136996826, 2219780368020940 },
+            { 1537037379417136, 1358865369268262, 2130838645654099, 828733687040705, 1999987652890901 },
+        },
+        {
+            { 629042105241814, 1098854999137608, 887281544569320, 1423102019874777, 7911258951561 },
+            { 1811562332665373, 1501882019007673, 2213763501088999, 359573079719636, 36370565049116 },
+            { 218907117361280, 1209298913016966, 1944312619096112, 1130690631451061, 1342327389191701 },
+        },
+        {
+            { 1369976867854704, 1396479602419169, 1765656654398856, 2203659200586299, 998327836117241 },
+            { 2230701885562825, 1348173180338974, 2172856128624598, 1426538746123771, 444193481326151 },
+            { 784210426627951, 918204562375674, 1284546780452985, 1324534636134684, 1872449409642708 },
+        },
+        {
+            { 319638829540294, 596282656808406, 2037902696412608, 1557219121643918, 341938082688094 },
+            { 1901860206695915, 2004489122065736, 1625847061568236, 973529743399879, 2075287685312905 },
+            { 1371853944110545, 1042332820512553, 1949855697918254, 1791195775521505, 37487364849293 },
+        },
+        {
+            { 687200189577855, 1082536651125675, 644224940871546, 340923196057951, 343581346747396 },
+            { 2082717129583892, 27829425539422, 145655066671970, 1690527209845512, 1865260509673478 },
+            { 1059729620568824, 2163709103470266, 1440302280256872, 1769143160546397, 869830310425069 },
+        },
+        {
+            { 1609516219779025, 777277757338817, 2101121130363987, 550762194946473, 1905542338659364 },
+            { 2024821921041576, 426948675450149, 595133284085473, 471860860885970, 600321679413000 },
+            { 598474602406721, 1468128276358244, 1191923149557635, 1501376424093216, 1281662691293476 },
+        },
+        {
+            { 1721138489890707, 1264336102277790, 433064545421287, 1359988423149466, 1561871293409447 },
+            { 719520245587143, 393380711632345, 132350400863381, 1543271270810729, 1819543295798660 },
+            { 396397949784152, 1811354474471839, 1362679985304303, 2117033964846756, 498041172552279 },
+        },
+        {
+            { 1812471844975748, 1856491995543149, 126579494584102, 1036244859282620, 1975108050082550 },
+            { 650623932407995, 1137551288410575, 2125223403615539, 1725658013221271, 2134892965117796 },
+            { 522584000310195, 1241762481390450, 1743702789495384, 2227404127826575, 1686746002148897 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1171837083014025, 264732902278699, 1770010974323604, 266108208353474, 2020794083615322 },
+            { 293218709634113, 1719011489643599, 831619655945737, 1611022286286405, 2006064581746788 },
+            { 762321251771152, 1460210191529427, 2248797163104578, 217468651569622, 63003536153574 },
+        },
+        {
+            { 391588043113892, 2202456919563943, 1617888818929289, 694159965511217, 2143606811138355 },
+            { 2008058364358132, 1051355690609066, 1659991296428347, 1022293360838405, 1042097367448254 },
+            { 719793864170869, 1411477466905009, 1515019021063010, 1483421690183889, 1704042941619334 },
+        },
+        {
+            { 517835973347256, 706523709933216, 1537480429839773, 1483278086593314, 1378968978067758 },
+            { 783163454514521, 1366624508143284, 1863506003869690, 917979662972397, 1583895088313562 },
+            { 1315034452637574, 1172434640681242, 1135533609020364, 253349230877293, 161211572823476 },
+        },
+        {
+            { 407608189412637, 2049444491227494, 342891130347629, 1169428941568801, 848234126951058 },
+            { 1690850439525075, 1667024303418336, 1749847485823236, 736954918508817, 531773443234823 },
+            { 437225545901468, 888271756229202, 903344393515123, 162913205438885, 1475178706291532 },
+        },
+        {
+            { 1455493636488624, 751219268219696, 1525065253586106, 2054680090861517, 1393874745922970 },
+            { 2036122071377878, 537649193830804, 1081885102254542, 1030768092026017, 28673195105264 },
+            { 1910711495320594, 321017884248758, 1651671690842787, 527123817162741, 847944616444202 },
+        },
+        {
+            { 1474221667712465, 816888956654317, 1358088375247374, 1853329794010803, 679495195920834 },
+            { 1163431681760636, 1938797201846954, 401473612016388, 437327642541001, 1477240401828670 },
+            { 70084211861389, 1248863300280704, 1009402227613886, 1445171656255193, 728732085908498 },
+        },
+        {
+            { 617950679184798, 1153392601340918, 502976659155882, 1100510641818701, 618421337595665 },
+            { 1088702065079191, 907323729407776, 1527188956642328, 1091012131984810, 763978074893835 },
+            { 1481950048975238, 97096668186528, 429204027887699, 1510003697018425, 2114825823462494 },
+        },
+        {
+            { 1440929316705148, 1633730452330828, 1405404753609489, 1406118623302575, 309924733037947 },
+            { 656250768022145, 564144318086388, 48310283291479, 2142014283110632, 1641981030879013 },
+            { 809017030155597, 1831934834657405, 58189812416765, 1517873507099267, 889681994437792 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 427904865186312, 1703211129693455, 1585368107547509, 1436984488744336, 761188534613978 },
+            { 318101947455002, 248138407995851, 1481904195303927, 309278454311197, 1258516760217879 },
+            { 1275068538599310, 513726919533379, 349926553492294, 688428871968420, 1702400196000666 },
+        },
+        {
+            { 1061864036265233, 961611260325381, 321859632700838, 1045600629959517, 1985130202504038 },
+            { 1558816436882417, 1962896332636523, 1337709822062152, 1501413830776938, 294436165831932 },
+            { 818359826554971, 1862173000996177, 626821592884859, 573655738872376, 1749691246745455 },
+        },
+        {
+            { 1988022651432119, 1082111498586040, 1834020786104821, 1454826876423687, 692929915223122 },
+            { 2146513703733331, 584788900394667, 464965657279958, 2183973639356127, 238371159456790 },
+            { 1129007025494441, 2197883144413266, 265142755578169, 971864464758890, 1983715884903702 },
+        },
+        {
+            { 1291366624493075, 381456718189114, 1711482489312444, 1815233647702022, 892279782992467 },
+            { 444548969917454, 1452286453853356, 2113731441506810, 645188273895859, 810317625309512 },
+            { 2242724082797924, 1373354730327868, 1006520110883049, 2147330369940688, 1151816104883620 },
+        },
+        {
+            { 1745720200383796, 1911723143175317, 2056329390702074, 355227174309849, 879232794371100 },
+            { 163723479936298, 115424889803150, 1156016391581227, 1894942220753364, 1970549419986329 },
+            { 681981452362484, 267208874112496, 1374683991933094, 638600984916117, 646178654558546 },
+        },
+        {
+            { 13378654854251, 106237307029567, 1944412051589651, 1841976767925457, 230702819835573 },
+            { 260683893467075, 854060306077237, 913639551980112, 4704576840123, 280254810808712 },
+            { 715374893080287, 1173334812210491, 1806524662079626, 1894596008000979, 398905715033393 },
+        },
+        {
+            { 500026409727661, 1596431288195371, 1420380351989370, 985211561521489, 392444930785633 },
+            { 2096421546958141, 1922523000950363, 789831022876840, 427295144688779, 320923973161730 },
+            { 1927770723575450, 1485792977512719, 1850996108474547, 551696031508956, 2126047405475647 },
+        },
+        {
+            { 2112099158080148, 742570803909715, 6484558077432, 1951119898618916, 93090382703416 },
+            { 383905201636970, 859946997631870, 855623867637644, 1017125780577795, 794250831877809 },
+            { 77571826285752, 999304298101753, 487841111777762, 1038031143212339, 339066367948762 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1179642228804668, 1418657644034850, 675683856213334, 596096446428822, 1170437361620647 },
+            { 1511564286472767, 2184358636968286, 1412906036411316, 89284351539568, 352068421522218 },
+            { 1907217462504765, 679044428705663, 1371479879514675, 1420793148384765, 190685345044087 },
+        },
+        {
+            { 1276705999322783, 1661230352625442, 1205734973860699, 784019563379976, 1449546143149561 },
+            { 637296935955637, 450944727568131, 645072163640910, 309713610901635, 311189073223217 },
+            { 2213525665395526, 146358659614731, 1573034916169973, 1131167148341295, 1194403623212224 },
+        },
+        {
+            { 2105305689409187, 1932040296635725, 307501795091619, 1653053081843051, 1246676406522367 },
+            { 782790693528855, 1519731603158914, 2028140081496226, 1275020033363837, 2056444369633135 },
+            { 1916484225176, 1896106466807315, 1279953155660650, 1725386140841619, 757101416534772 },
+        },
+        {
+            { 2133488547373098, 633134528408434, 1652284377802153, 2035540453530543, 489273649398225 },
+            { 2051614458366870, 728789063070456, 282245488169187, 2178894003553741, 1855341936085133 },
+            { 655928016394658, 1087485647128905, 1281789693328119, 2088439151211398, 1863153332596984 },
+        },
+        {
+            { 210017655980803, 1811183847825904, 1323101412046938, 1360571080713195, 1716626899554003 },
+            { 716543727419056, 2051592790034539, 1445865707531046, 863515409408522, 1102874443417899 },
+            { 1790273650925445, 2180187262630477, 28219260774301, 1951582862584504, 1059160821201578 },
+        },
+        {
+            { 857134543659225, 571584078624683, 457976954128720, 480578452053593, 1695118712507850 },
+            { 1455060305288896, 1678698521692147, 955042089053421, 482480751768889, 972076543638923 },
+            { 95538772778706, 1914880923031197, 417513632407841, 1767845086605839, 832379724270193 },
+        },
+        {
+            { 1456443406045738, 1909385161475434, 816382632051404, 1426587922914898, 2166890266198132 },
+            { 629341497594299, 294953389516334, 1800301282775361, 2224016821184931, 924802345871186 },
+            { 393110820654303, 662371396172458, 1370237312917823, 2034119121136113, 904928937827 },
+        },
+        {
+            { 1257344135899307, 524694436287172, 1637109398723535, 1801319038042246, 2082644998926031 },
+            { 571822557710951, 195833865463720, 1444687327784978, 1429898638089182, 1938057576257967 },
+            { 189274223123103, 2188109173279445, 1461570511269332, 151886143484743, 1557837550414982 },
+        },
+    },
+#endif
+    {
+        {
+            { 674994775520533, 266035846330789, 826951213393478, 1405007746162285, 1781791018620876 },
+            { 1001412661522686, 348196197067298, 1666614366723946, 888424995032760, 580747687801357 },
+            { 1939560076207777, 1409892634407635, 552574736069277, 383854338280405, 190706709864139 },
+        },
+        {
+            { 2177087163428741, 1439255351721944, 1208070840382793, 2230616362004769, 1396886392021913 },
+            { 676962063230039, 1880275537148808, 2046721011602706, 888463247083003, 1318301552024067 },
+            { 1466980508178206, 617045217998949, 652303580573628, 757303753529064, 207583137376902 },
+        },
+        {
+            { 1511056752906902, 105403126891277, 493434892772846, 1091943425335976, 1802717338077427 },
+            { 1853982405405128, 1878664056251147, 1528011020803992, 1019626468153565, 1128438412189035 },
+            { 1963939888391106, 293456433791664, 697897559513649, 985882796904380, 796244541237972 },
+        },
+        {
+            { 416770998629779, 389655552427054, 1314476859406756, 1749382513022778, 1161905598739491 },
+            { 1428358296490651, 1027115282420478, 304840698058337, 441410174026628, 1819358356278573 },
+            { 204943430200135, 1554861433819175, 216426658514651, 264149070665950, 2047097371738319 },
+        },
+        {
+            { 1934415182909034, 1393285083565062, 516409331772960, 1157690734993892, 121039666594268 },
+            { 662035583584445, 286736105093098, 1131773000510616, 818494214211439, 472943792054479 },
+            { 665784778135882, 1893179629898606, 808313193813106, 276797254706413, 1563426179676396 },
+        },
+        {
+            { 945205108984232, 526277562959295, 1324180513733566, 1666970227868664, 153547609289173 },
+            { 2031433403516252, 203996615228162, 170487168837083, 981513604791390, 843573964916831 },
+            { 1476570093962618, 838514669399805, 1857930577281364, 2017007352225784, 317085545220047 },
+        },
+        {
+            { 1461557121912842, 1600674043318359, 2157134900399597, 1670641601940616, 127765583803283 },
+            { 1293543509393474, 2143624609202546, 1058361566797508, 214097127393994, 946888515472729 },
+            { 357067959932916, 1290876214345711, 521245575443703, 1494975468601005, 800942377643885 },
+        },
+        {
+            { 566116659100033, 820247422481740, 994464017954148, 327157611686365, 92591318111744 },
+            { 617256647603209, 1652107761099439, 1857213046645471, 1085597175214970, 817432759830522 },
+            { 771808161440705, 1323510426395069, 680497615846440, 851580615547985, 1320806384849017 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 875483311206750, 1070293195031859, 1281389774974538, 2234860500431395, 778685125379289 },
+            { 61535391329516, 448636217346295, 2080976424777490, 1693183775735280, 1282728854739106 },
+            { 2191861413872447, 1998107865473216, 135161483760725, 1133778951112075, 2177808149908975 },
+        },
+        {
+            { 1355285592679618, 964532200162205, 606767307684972, 180576224889129, 482463910553398 },
+            { 2220808064153177, 176691452047504, 762781849533969, 944930357489006, 1534273731293129 },
+            { 449706520184472, 2214233011551797, 684523848529734, 431843026966950, 1758835924810462 },
+        },
+        {
+            { 1617166089281207, 448710947316786, 2017034644293574, 1886691422085664, 123642336720311 },
+            { 1161442465661288, 21003748063787, 385827624308176, 2122110448433305, 916494441542470 },
+            { 1239614751060180, 254449956067847, 1915952567259905, 391989559805324, 853553448301328 },
+        },
+        {
+            { 1381495390544381, 584763141985101, 879705032985300, 313362758653765, 2037973653370615 },
+            { 1890742306105773, 171853555874878, 1636487436566592, 1018479096469591, 1049093089544630 },
+            { 762375715838646, 553562190209386, 1146347552263484, 824188464596685, 1830942666102590 },
+        },
+        {
+            { 1348374701112873, 1701900740509234, 1150531280942293, 552979832224709, 2204826476892035 },
+            { 1319775590492097, 1988327190606602, 107465387635729, 1267108314610850, 411829441129739 },
+            { 2119092558617159, 1045482671389213, 690197889240825, 471826136635342, 1637923217880356 },
+        },
+        {
+            { 2181081937454965, 1121830291087960, 580779417614728, 873036455797166, 2225668708158200 },
+            { 1807266836472778, 637966070791859, 1481226202132566, 371464048684432, 580205417661681 },
+            { 1193994157146400, 1628108083694642, 1021885296427132, 816068909639879, 2088480068848711 },
+        },
+        {
+            { 1673050054377651, 1765054067091528, 711173592194582, 87474058367652, 1699131689883902 },
+            { 928818711922426, 838829706546979, 504639790201676, 1254264560292085, 35053452202780 },
+            { 2229241184614921, 2107352800266199, 77312115078922, 2151892262530718, 947910914861383 },
+        },
+        {
+            { 1528297312537716, 2187935649407647, 715931603706163, 903221378972329, 1577434241618945 },
+            { 816944747089363, 1889295505677179, 1061560556919768, 681907473170465, 1031466762565130 },
+            { 1385713524190245, 153942078459639, 747467190641094, 1446053675113471, 429215290527338 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 1219260086131915, 647169006596815, 79601124759706, 2161724213426748, 404861897060198 },
+            { 1327968293887866, 1335500852943256, 1401587164534264, 558137311952440, 1551360549268902 },
+            { 417621685193956, 1429953819744454, 396157358457099, 1940470778873255, 214000046234152 },
+        },
+        {
+            { 1268047918491973, 2172375426948536, 1533916099229249, 1761293575457130, 1590622667026765 },
+            { 1627072914981959, 2211603081280073, 1912369601616504, 1191770436221309, 2187309757525860 },
+            { 1149147819689533, 378692712667677, 828475842424202, 2218619146419342, 70688125792186 },
+        },
+        {
+            { 1299739417079761, 1438616663452759, 1536729078504412, 2053896748919838, 1008421032591246 },
+            { 2040723824657366, 399555637875075, 632543375452995, 872649937008051, 1235394727030233 },
+            { 2211311599327900, 2139787259888175, 938706616835350, 12609661139114, 2081897930719789 },
+        },
+        {
+            { 1324994503390450, 336982330582631, 1183998925654177, 1091654665913274, 48727673971319 },
+            { 1845522914617879, 1222198248335542, 150841072760134, 1927029069940982, 1189913404498011 },
+            { 1079559557592645, 2215338383666441, 1903569501302605, 49033973033940, 305703433934152 },
+        },
+        {
+            { 94653405416909, 1386121349852999, 1062130477891762, 36553947479274, 833669648948846 },
+            { 1432015813136298, 440364795295369, 1395647062821501, 1976874522764578, 934452372723352 },
+            { 1296625309219774, 2068273464883862, 1858621048097805, 1492281814208508, 2235868981918946 },
+        },
+        {
+            { 1490330266465570, 1858795661361448, 1436241134969763, 294573218899647, 1208140011028933 },
+            { 1282462923712748, 741885683986255, 2027754642827561, 518989529541027, 1826610009555945 },
+            { 1525827120027511, 723686461809551, 1597702369236987, 244802101764964, 1502833890372311 },
+        },
+        {
+            { 113622036244513, 1233740067745854, 674109952278496, 2114345180342965, 166764512856263 },
+            { 2041668749310338, 2184405322203901, 1633400637611036, 2110682505536899, 2048144390084644 },
+            { 503058759232932, 760293024620937, 2027152777219493, 666858468148475, 1539184379870952 },
+        },
+        {
+            { 1916168475367211, 915626432541343, 883217071712575, 363427871374304, 1976029821251593 },
+            { 678039535434506, 570587290189340, 1605302676614120, 2147762562875701, 1706063797091704 },
+            { 1439489648586438, 2194580753290951, 832380563557396, 561521973970522, 584497280718389 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1684548552982170, 260880483365080, 2151565475089601, 2240257948464080, 105534272702509 },
+            { 759532983145199, 1041506031166509, 2098906843949927, 2024575413813287, 1129901033077001 },
+            { 2245889758290233, 1304556815701186, 1427348922813143, 221464961710041, 2149077757654506 },
+        },
+        {
+            { 1200977971745538, 679604753110803, 118640303903686, 13161284424804, 1017048311556209 },
+            { 518289544308872, 2210328310178151, 992468182848569, 1632583101328401, 88660873565255 },
+            { 1190992926530423, 1046016291129455, 1934369009614752, 958221374199446, 762751542850234 },
+        },
+        {
+            { 1196600994744564, 1547369290503378, 2035231477477616, 1257032246257935, 477213736067146 },
+            { 1209177241620207, 898929391359607, 808801284537394, 1245342740956132, 272014677526521 },
+            { 1316355169784636, 2159471323343549, 195437001734225, 1784725127680235, 23628188515854 },
+        },
+        {
+            { 1782397857084708, 48095726564004, 1468513199329122, 1169924369129606, 1452708652401532 },
+            { 2163087320072509, 199316101406292, 1846431193137861, 204046193177858, 1779620820558944 },
+            { 246845927125542, 475207520380026, 1495857355234583, 1332907410765356, 1137190823002655 },
+        },
+        {
+            { 402770419372181, 879148936024281, 171152161387778, 1521258543891684, 1016650524881308 },
+            { 116038458993258, 608632312109909, 1178551838069391, 1820997430699396, 949215725963241 },
+            { 122249525311324, 1126352422834922, 929325077009082, 782368628240853, 94217591211022 },
+        },
+        {
+            { 739195792604578, 770122614286754, 302802129599792, 1502244105829111, 1773114045409669 },
+            { 459035525733650, 770535776464013, 252174834449567, 2131746448577589, 954066860320410 },
+            { 156241863414061, 496518516536107, 402847929676013, 1139792271454333, 1977247161507402 },
+        },
+        {
+            { 211523957170473, 1644670408070226, 756431515781898, 949873124601275, 36660463549794 },
+            { 529214503061057, 257079294506787, 2191069624568715, 1061830060574110, 2065600952844923 },
+            { 1855056967762827, 1495181328549832, 966278130514841, 758391654071223, 467588501531856 },
+        },
+        {
+            { 185100610527958, 1954148435588968, 1712385658617173, 471993490740154, 681838917243490 },
+            { 313435187549042, 1956277154208437, 1365239857368542, 1348897712723582, 126454872238337 },
+            { 1439947543028469, 885225692302481, 1285222886469976, 1588398795428018, 1298691185892088 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 187989455492609, 681223515948275, 1933493571072456, 1872921007304880, 488162364135671 },
+            { 1413466089534451, 410844090765630, 1397263346404072, 408227143123410, 1594561803147811 },
+            { 2102170800973153, 719462588665004, 1479649438510153, 1097529543970028, 1302363283777685 },
+        },
+        {
+            { 942065717847195, 1069313679352961, 2007341951411051, 70973416446291, 1419433790163706 },
+            { 1146565545556377, 1661971299445212, 406681704748893, 564452436406089, 1109109865829139 },
+            { 2214421081775077, 1165671861210569, 1890453018796184, 3556249878661, 442116172656317 },
+        },
+        {
+            { 753830546620811, 1666955059895019, 1530775289309243, 1119987029104146, 2164156153857580 },
+            { 615171919212796, 1523849404854568, 854560460547503, 2067097370290715, 1765325848586042 },
+            { 1094538949313667, 1796592198908825, 870221004284388, 2025558921863561, 1699010892802384 },
+        },
+        {
+            { 1951351290725195, 1916457206844795, 198025184438026, 1909076887557595, 1938542290318919 },
+            { 1014323197538413, 869150639940606, 1756009942696599, 1334952557375672, 1544945379082874 },
+            { 764055910920305, 1603590757375439, 146805246592357, 1843313433854297, 954279890114939 },
+        },
+        {
+            { 80113526615750, 764536758732259, 1055139345100233, 469252651759390, 617897512431515 },
+            { 74497112547268, 740094153192149, 1745254631717581, 727713886503130, 1283034364416928 },
+            { 525892105991110, 1723776830270342, 1476444848991936, 573789489857760, 133864092632978 },
+        },
+        {
+            { 542611720192581, 1986812262899321, 1162535242465837, 481498966143464, 544600533583622 },
+            { 64123227344372, 1239927720647794, 1360722983445904, 222610813654661, 62429487187991 },
+            { 1793193323953132, 91096687857833, 70945970938921, 2158587638946380, 1537042406482111 },
+        },
+        {
+            { 1895854577604609, 1394895708949416, 1728548428495944, 1140864900240149, 563645333603061 },
+            { 141358280486863, 91435889572504, 1087208572552643, 1829599652522921, 1193307020643647 },
+            { 1611230858525381, 950720175540785, 499589887488610, 2001656988495019, 88977313255908 },
+        },
+        {
+            { 1189080501479658, 2184348804772597, 1040818725742319, 2018318290311834, 1712060030915354 },
+            { 873966876953756, 1090638350350440, 1708559325189137, 672344594801910, 1320437969700239 },
+            { 1508590048271766, 1131769479776094, 101550868699323, 428297785557897, 561791648661744 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 464451590840864, 1631117916585970, 1763058100245834, 2213037729836095, 1396521499150134 },
+            { 1708891979933193, 193606038525586, 1981223293240314, 1300147684220123, 1415690962041537 },
+            { 296206175452724, 658879322369119, 97943562265366, 1761747874053347, 665498744562262 },
+        },
+        {
+            { 1200760264207189, 52939066426767, 1927960174691145, 1569518880089323, 1152309979337507 },
+            { 38546390495599, 61816108201901, 1929402325321447, 2162999785972298, 837806219901868 },
+            { 2038947849479643, 237162323211423, 2065816839891168, 419806183479203, 384865548997533 },
+        },
+        {
+            { 1152764853239608, 30290046791954, 1601380253073466, 898105377854964, 1583948862629235 },
+            { 128932575450262, 2176238657569348, 500334689254643, 1958172022248342, 1015981788056542 },
+            { 1558193059260245, 1778073808602536, 402624851529717, 66752783641769, 824353727713740 },
+        },
+        {
+            { 1987770197713503, 751549594590657, 1878974480372933, 520288146790215, 146577641784525 },
+            { 1870148064878802, 1722962699461314, 2148888862361842, 1498958478808291, 1078521514059403 },
+            { 1021194340773145, 2214506742467645, 1946787888944335, 2047968106648641, 1821857137920583 },
+        },
+        {
+            { 520345345283734, 993525428347841, 830705726342297, 1401316007351696, 272642075430152 },
+            { 313411658320980, 1569700568290857, 1364146655651272, 1389399851157765, 1363175910566070 },
+            { 540709883326476, 664748033877723, 77460650157458, 1882229467398241, 1217186023704288 },
+        },
+        {
+            { 1148904473568401, 40634531148500, 608217842239622, 896886146116791, 1793557015614071 },
+            { 1636905029336861, 770793125827227, 1336171461860292, 201993548186316, 114272157082495 },
+            { 738867948290551, 1113067062951318, 2239418068162676, 2235388618772922, 321946428440080 },
+        },
+        {
+            { 255478373377161, 1965300287234723, 1455241861966706, 106226761267792, 104783220638674 },
+            { 682770171818581, 1445373742074242, 2010927294009799, 933580777601529, 1898007959060472 },
+            { 1141974899967420, 1197500508248512, 1725264994009043, 1639228663875285, 1766256613674282 },
+        },
+        {
+            { 1473307785816396, 2183888493524504, 1340430334743973, 620286732260876, 718894511556160 },
+            { 355530883651858, 1186819460918536, 2022594105067760, 38939679101912, 518229550986997 },
+            { 200438687964996, 1579389594103736, 1144999901302662, 1292188560016150, 1342060233269448 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 756417570499462, 237882279232602, 2136263418594016, 1701968045454886, 703713185137472 },
+            { 1781187809325462, 1697624151492346, 1381393690939988, 175194132284669, 1483054666415238 },
+            { 2175517777364616, 708781536456029, 955668231122942, 1967557500069555, 2021208005604118 },
+        },
+        {
+            { 1115135966606887, 224217372950782, 915967306279222, 593866251291540, 561747094208006 },
+            { 1443163092879439, 391875531646162, 2180847134654632, 464538543018753, 1594098196837178 },
+            { 850858855888869, 319436476624586, 327807784938441, 740785849558761, 17128415486016 },
+        },
+        {
+            { 2132756334090067, 536247820155645, 48907151276867, 608473197600695, 1261689545022784 },
+            { 1525176236978354, 974205476721062, 293436255662638, 148269621098039, 137961998433963 },
+            { 1121075518299410, 2071745529082111, 1265567917414828, 1648196578317805, 496232102750820 },
+        },
+        {
+            { 122321229299801, 1022922077493685, 2001275453369484, 2017441881607947, 993205880778002 },
+            { 654925550560074, 1168810995576858, 575655959430926, 905758704861388, 496774564663534 },
+            { 1954109525779738, 2117022646152485, 338102630417180, 1194140505732026, 107881734943492 },
+        },
+        {
+            { 1714785840001267, 2036500018681589, 1876380234251966, 2056717182974196, 1645855254384642 },
+            { 106431476499341, 62482972120563, 1513446655109411, 807258751769522, 538491469114 },
+            { 2002850762893643, 1243624520538135, 1486040410574605, 2184752338181213, 378495998083531 },
+        },
+        {
+            { 922510868424903, 1089502620807680, 402544072617374, 1131446598479839, 1290278588136533 },
+            { 1867998812076769, 715425053580701, 39968586461416, 2173068014586163, 653822651801304 },
+            { 162892278589453, 182585796682149, 75093073137630, 497037941226502, 133871727117371 },
+        },
+        {
+            { 1914596576579670, 1608999621851578, 1987629837704609, 1519655314857977, 1819193753409464 },
+            { 1949315551096831, 1069003344994464, 1939165033499916, 1548227205730856, 1933767655861407 },
+            { 1730519386931635, 1393284965610134, 1597143735726030, 416032382447158, 1429665248828629 },
+        },
+        {
+            { 360275475604565, 547835731063078, 215360904187529, 596646739879007, 332709650425085 },
+            { 47602113726801, 1522314509708010, 437706261372925, 814035330438027, 335930650933545 },
+            { 1291597595523886, 1058020588994081, 402837842324045, 1363323695882781, 2105763393033193 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 831848399557275, 2203944328508070, 1205773492199750, 696100069920808, 1258775953756160 },
+            { 1536600197637719, 735192130338721, 1949638657621950, 1215398877067309, 196061350744259 },
+            { 801855642469056, 1726062700700587, 1064722548099106, 1128997468587175, 1368420390253860 },
+        },
+        {
+            { 1095027470911861, 1309452919940954, 165563932177558, 1165431755382480, 1895316643922204 },
+            { 717156719298230, 1955979138243696, 2199791266029467, 1058002839738406, 1449532534254269 },
+            { 2142749866659158, 1962490102531981, 1691447155265793, 1827079035266074, 3803331638058 },
+        },
+        {
+            { 1104482724596124, 121997531441, 635349471659539, 1384857237573085, 1805272655273783 },
+            { 478069199145280, 1141170740207616, 940257554984262, 897591638444270, 1814438392415312 },
+            { 399619403797256, 1517816986720610, 1503473770785461, 1650204761619743, 2016574488970872 },
+        },
+        {
+            { 1452497321657782, 1539338328736177, 1904958092028386, 1587402592924884, 2189645592400953 },
+            { 1830872026784925, 1623034384028758, 2186083484441019, 1970420851072046, 64231867033146 },
+            { 481460971838645, 495603062939192, 2081146895236470, 971761350637757, 742727604094484 },
+        },
+        {
+            { 209124997731951, 1270184737939192, 1511404974611241, 375249799211988, 1530607726935532 },
+            { 1012073874592193, 42790166525331, 496669786240166, 100229188104254, 1649037173883968 },
+            { 2048665788177445, 1408893800498572, 1918636993246022, 317961445367427, 656800592778138 },
+        },
+        {
+            { 170551136248788, 943103623278344, 1291301021890213, 94515389766570, 1860925285740835 },
+            { 175176261947926, 1399800407330296, 982465035605378, 221509495410385, 2155496689521389 },
+            { 269878912827170, 1290670313639785, 2170448731381563, 1730590899024060, 665688666929019 },
+        },
+        {
+            { 1580177441875156, 254258483925768, 682989882894099, 1061310370544481, 596660656376680 },
+            { 496813734622430, 1096113151371306, 1283642582170893, 1567992629237510, 344025372990045 },
+            { 1957905575869340, 963138800079095, 1346185076450932, 33814819376238, 1624717058267694 },
+        },
+        {
+            { 1661216359883315, 1198665005326425, 1223676681611594, 881743418686048, 635325796191538 },
+            { 610180487982555, 1103087737610894, 1696274700114993, 1767466185217554, 250915004216473 },
+            { 1196599610725063, 2100294611545468, 412113633351820, 925880965367657, 519930913383517 },
+        },
+    },
+#endif
+    {
+        {
+            { 109521982566564, 1715257748585139, 1112231216891516, 2046641005101484, 134249157157013 },
+            { 2156991030936798, 2227544497153325, 1869050094431622, 754875860479115, 1754242344267058 },
+            { 1846089562873800, 98894784984326, 1412430299204844, 171351226625762, 1100604760929008 },
+        },
+        {
+            { 84172382130492, 499710970700046, 425749630620778, 1762872794206857, 612842602127960 },
+            { 868309334532756, 1703010512741873, 1952690008738057, 4325269926064, 2071083554962116 },
+            { 523094549451158, 401938899487815, 1407690589076010, 2022387426254453, 158660516411257 },
+        },
+        {
+            { 612867287630009, 448212612103814, 571629077419196, 1466796750919376, 1728478129663858 },
+            { 1723848973783452, 2208822520534681, 1718748322776940, 1974268454121942, 1194212502258141 },
+            { 1254114807944608, 977770684047110, 2010756238954993, 1783628927194099, 1525962994408256 },
+        },
+        {
+            { 232464058235826, 1948628555342434, 1835348780427694, 1031609499437291, 64472106918373 },
+            { 767338676040683, 754089548318405, 1523192045639075, 435746025122062, 512692508440385 },
+            { 1255955808701983, 1700487367990941, 1166401238800299, 1175121994891534, 1190934801395380 },
+        },
+        {
+            { 349144008168292, 1337012557669162, 1475912332999108, 1321618454900458, 47611291904320 },
+            { 877519947135419, 2172838026132651, 272304391224129, 1655143327559984, 886229406429814 },
+            { 375806028254706, 214463229793940, 572906353144089, 572168269875638, 697556386112979 },
+        },
+        {
+            { 1168827102357844, 823864273033637, 2071538752104697, 788062026895924, 599578340743362 },
+            { 1948116082078088, 2054898304487796, 2204939184983900, 210526805152138, 786593586607626 },
+            { 1915320147894736, 156481169009469, 655050471180417, 592917090415421, 2165897438660879 },
+        },
+        {
+            { 1726336468579724, 1119932070398949, 1929199510967666, 33918788322959, 1836837863503150 },
+            { 829996854845988, 217061778005138, 1686565909803640, 1346948817219846, 1723823550730181 },
+            { 384301494966394, 687038900403062, 2211195391021739, 254684538421383, 1245698430589680 },
+        },
+        {
+            { 1247567493562688, 1978182094455847, 183871474792955, 806570235643435, 288461518067916 },
+            { 1449077384734201, 38285445457996, 2136537659177832, 2146493000841573, 725161151123125 },
+            { 1201928866368855, 800415690605445, 1703146756828343, 997278587541744, 1858284414104014 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1941100238292788, 1530763972357988, 689917761100876, 517834246099702, 1016501476684148 },
+            { 1361281020450455, 1270489161609055, 2229166815777130, 478093075579488, 1028298658754112 },
+            { 402477551873128, 1206353712079331, 1931900782149571, 353151698548753, 227661813611943 },
+        },
+        {
+            { 790360882582618, 1193039775906918, 457074437270605, 1880772252763311, 1647664574467171 },
+            { 1267345491545277, 1040955582161709, 944602568432597, 589216616145824, 2176282068300736 },
+            { 1801318854301087, 529217444026518, 41439150499132, 1819497139150034, 1914318279506430 },
+        },
+        {
+            { 1401592520352142, 2119290268348413, 1662789932544495, 1461053630461698, 1761023449047587 },
+            { 114244238715052, 1711673966360604, 27096215850346, 649231795386780, 1751566257090632 },
+            { 1892648843913435, 1079776332626104, 1111039290977790, 1827479485396386, 859677304170245 },
+        },
+        {
+            { 1955745180210476, 1703319703537271, 2019166049085294, 1111446728934944, 1621319325065514 },
+            { 1631515565881337, 74820660423111, 1234156086642234, 902000684785159, 479946197517415 },
+            { 1700391063795585, 361747633083750, 1216968456947850, 1993842710713264, 601267006969711 },
+        },
+        {
+            { 1335348453199749, 440896739279346, 991468498763434, 1958567111536423, 1194502970771976 },
+            { 421687194725601, 1452210447909774, 1972718778338361, 2245279220138677, 197097958178703 },
+            { 1656217138482787, 491628805607466, 1679451179466805, 970181505842258, 1534105889461948 },
+        },
+        {
+            { 1051919605857270, 437958703079032, 943831089706606, 69819660973933, 1445811115388040 },
+            { 1953169811593624, 587935880863229, 808215721544276, 1172930642871056, 933712923663396 },
+            { 1160289603260459, 1956223108351205, 1733312353955470, 208731931777063, 2163609865075088 },
+        },
+        {
+            { 353960863214443, 267136175486224, 1655039766011589, 100906939435905, 1606429966007504 },
+            { 1668322680159809, 1164890095728715, 2146980235097167, 1096904483609062, 290681949797038 },
+            { 1142834714776341, 85770505106288, 713866520631433, 440023537352050, 178697006218663 },
+        },
+        {
+            { 1815823837273367, 310953977328321, 1539789395052837, 1395950066391658, 1631063017998021 },
+            { 866175525108893, 724819292219605, 2068366674175907, 2097483603288131, 549017403202089 },
+            { 534961844628464, 1393583055120721, 1748351260324708, 1375538226727024, 2193309623120304 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 356468809648877, 782373916933152, 1718002439402870, 1392222252219254, 663171266061951 },
+            { 759628738230460, 1012693474275852, 353780233086498, 246080061387552, 2030378857679162 },
+            { 2040672435071076, 888593182036908, 1298443657189359, 1804780278521327, 354070726137060 },
+        },
+        {
+            { 1894938527423184, 1463213041477277, 474410505497651, 247294963033299, 877975941029128 },
+            { 207937160991127, 12966911039119, 820997788283092, 1010440472205286, 1701372890140810 },
+            { 218882774543183, 533427444716285, 1233243976733245, 435054256891319, 1509568989549904 },
+        },
+        {
+            { 1888838535711826, 1052177758340622, 1213553803324135, 169182009127332, 463374268115872 },
+            { 299137589460312, 1594371588983567, 868058494039073, 257771590636681, 1805012993142921 },
+            { 1806842755664364, 2098896946025095, 1356630998422878, 1458279806348064, 347755825962072 },
+        },
+        {
+            { 1402334161391744, 1560083671046299, 1008585416617747, 1147797150908892, 1420416683642459 },
+            { 665506704253369, 273770475169863, 799236974202630, 848328990077558, 1811448782807931 },
+            { 1468412523962641, 771866649897997, 1931766110147832, 799561180078482, 524837559150077 },
+        },
+        {
+            { 2223212657821850, 630416247363666, 2144451165500328, 816911130947791, 1024351058410032 },
+            { 1266603897524861, 156378408858100, 1275649024228779, 447738405888420, 253186462063095 },
+            { 2022215964509735, 136144366993649, 1800716593296582, 1193970603800203, 871675847064218 },
+        },
+        {
+            { 1862751661970328, 851596246739884, 1519315554814041, 1542798466547449, 1417975335901520 },
+            { 1228168094547481, 334133883362894, 587567568420081, 433612590281181, 603390400373205 },
+            { 121893973206505, 1843345804916664, 1703118377384911, 497810164760654, 101150811654673 },
+        },
+        {
+            { 458346255946468, 290909935619344, 1452768413850679, 550922875254215, 1537286854336538 },
+            { 584322311184395, 380661238802118, 114839394528060, 655082270500073, 2111856026034852 },
+            { 996965581008991, 2148998626477022, 1012273164934654, 1073876063914522, 1688031788934939 },
+        },
+        {
+            { 923487018849600, 2085106799623355, 528082801620136, 1606206360876188, 735907091712524 },
+            { 1697697887804317, 1335343703828273, 831288615207040, 949416685250051, 288760277392022 },
+            { 1419122478109648, 1325574567803701, 602393874111094, 2107893372601700, 1314159682671307 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 2219813055094868, 1499254289481425, 764148091645989, 790564725975557, 2174498914560537 },
+            { 787174142558441, 290213816892411, 217164218175754, 1829516411753589, 1841606552724103 },
+            { 1346839273131020, 1947175237418499, 2130499171815608, 841760904333801, 793011313347544 },
+        },
+        {
+            { 453885616355922, 1931337763813344, 1867986078235466, 963301853857219, 951744845930641 },
+            { 1638299625437402, 933125827264344, 1274558365788714, 1878405715151006, 1891383856643984 },
+            { 548016394257586, 1770170736821935, 883041007523403, 1244492123782548, 1874837894534970 },
+        },
+        {
+            { 70945323518187, 1460279620768174, 1656136902347806, 1063047643279494, 95490716967124 },
+            { 1603429813077590, 1647330982585325, 847233104774912, 784486507741078, 513088596765826 },
+            { 1585044732618145, 79674660750176, 2047172033863331, 558016866726219, 1811700039750197 },
+        },
+        {
+            { 1980868732324310, 208050273598170, 1500353534094478, 1977074025846907, 686785408890947 },
+            { 651709082505144, 1321036933983907, 1168392824733552, 893454319309249, 367099342904064 },
+            { 1977199595236300, 927859862391871, 2045825765550850, 1189431662969386, 451125616133550 },
+        },
+        {
+            { 1981177153373343, 1776706813610008, 704834493083627, 2113399644330230, 364175990188877 },
+            { 2013159093575690, 134013672952691, 219590094356753, 1935987407298499, 2018410453134649 },
+            { 1473984112024647, 2212143402178000, 1913009700964560, 489799262080055, 1390546130501803 },
+        },
+        {
+            { 1444538190324287, 44700923154239, 1483385825107722, 732704435299560, 1841400996159655 },
+            { 113833143783930, 517123070721070, 942959239637170, 1594788400320543, 181248812170436 },
+            { 781495195344331, 819872919567170, 2058369589741763, 131552040816437, 1143952030551876 },
+        },
+        {
+            { 1632591054957810, 1584029964350608, 1679919371947982, 1160578263030985, 320556257845570 },
+            { 1541799253522024, 1022364869435484, 1285406421903341, 449471132701656, 2242535465576863 },
+            { 118276417181988, 2048136038162801, 1736078553924029, 677257986431580, 711847529279284 },
+        },
+        {
+            { 1322932513703416, 348483708721842, 625435238632922, 1647316986471087, 1495874784707614 },
+            { 1382315411654289, 1155328561290128, 746170398588834, 1242063022588681, 1283807594473873 },
+            { 889518489432828, 1216748566987677, 2027061052060458, 268044074097160, 1539610510772867 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 2201150872731804, 2180241023425241, 97663456423163, 1633405770247824, 848945042443986 },
+            { 1173339555550611, 818605084277583, 47521504364289, 924108720564965, 735423405754506 },
+            { 830104860549448, 1886653193241086, 1600929509383773, 1475051275443631, 286679780900937 },
+        },
+        {
+            { 1577111294832995, 1030899169768747, 144900916293530, 1964672592979567, 568390100955250 },
+            { 278388655910247, 487143369099838, 927762205508727, 181017540174210, 1616886700741287 },
+            { 1191033906638969, 940823957346562, 1606870843663445, 861684761499847, 658674867251089 },
+        },
+        {
+            { 1875032594195546, 1427106132796197, 724736390962158, 901860512044740, 635268497268760 },
+            { 622869792298357, 1903919278950367, 1922588621661629, 1520574711600434, 1087100760174640 },
+            { 25465949416618, 1693639527318811, 1526153382657203, 125943137857169, 145276964043999 },
+        },
+        {
+            { 214739857969358, 920212862967915, 1939901550972269, 1211862791775221, 85097515720120 },
+            { 2006245852772938, 734762734836159, 254642929763427, 1406213292755966, 239303749517686 },
+            { 1619678837192149, 1919424032779215, 1357391272956794, 1525634040073113, 1310226789796241 },
+        },
+        {
+            { 1040763709762123, 1704449869235352, 605263070456329, 1998838089036355, 1312142911487502 },
+            { 1996723311435669, 1844342766567060, 985455700466044, 1165924681400960, 311508689870129 },
+            { 43173156290518, 2202883069785309, 1137787467085917, 1733636061944606, 1394992037553852 },
+        },
+        {
+            { 670078326344559, 555655025059356, 471959386282438, 2141455487356409, 849015953823125 },
+            { 2197214573372804, 794254097241315, 1030190060513737, 267632515541902, 2040478049202624 },
+            { 1812516004670529, 1609256702920783, 1706897079364493, 258549904773295, 996051247540686 },
+        },
+        {
+            { 1540374301420584, 1764656898914615, 1810104162020396, 923808779163088, 664390074196579 },
+            { 1323460699404750, 1262690757880991, 871777133477900, 1060078894988977, 1712236889662886 },
+            { 1696163952057966, 1391710137550823, 608793846867416, 1034391509472039, 1780770894075012 },
+        },
+        {
+            { 1367603834210841, 2131988646583224, 890353773628144, 1908908219165595, 270836895252891 },
+            { 597536315471731, 40375058742586, 1942256403956049, 1185484645495932, 312666282024145 },
+            { 1919411405316294, 1234508526402192, 1066863051997083, 1008444703737597, 1348810787701552 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 177691828723780, 1283094434250488, 1065039300161912, 1977830055676077, 423980805911273 },
+            { 748747339297832, 1135609155306207, 1823617401704634, 2112890298604997, 1132880422123891 },
+            { 2176454779743876, 931093459142961, 2244697379845986, 723779257225747, 962795008037376 },
+        },
+        {
+            { 1861517597691605, 1772481620932890, 377676625275392, 454027945773073, 2107910124630171 },
+            { 1912837811596353, 1062706188835521, 151816288759714, 1928975341682546, 1204168782841137 },
+            { 683279446283480, 2167544438614321, 1975855992985379, 780955320484514, 780910621778643 },
+        },
+        {
+            { 434558441289919, 1927951543046986, 247887434587243, 1241163995738961, 526331455331708 },
+            { 1703744445643093, 2206438520188924, 1360590793044037, 2093233444244748, 605362476106795 },
+            { 1074884828909420, 432905047961772, 1185537826254838, 52144045776742, 1826277929133963 },
+        },
+        {
+            { 2156715047802986, 1276772803921323, 128433708852190, 1960794365816569, 428584705572025 },
+            { 1180853732303989, 373577860927933, 170608019599358, 101879149800615, 226385074242609 },
+            { 1862177374063425, 1873700738552432, 308885709393483, 2100622082080360, 1104535253282502 },
+        },
+        {
+            { 1459840872562735, 421582154826229, 2220646689506683, 1208894292386914, 2152820272048462 },
+            { 1679349250090669, 2002629885813715, 2159329725118112, 1827787758857312, 351765134384947 },
+            { 1565335522994081, 54406341126738, 599331788389250, 1486039135212823, 940991227185565 },
+        },
+        {
+            { 1597264402054136, 1749721095022851, 1211432053366671, 1390398927836990, 1030072339730422 },
+            { 2146657684344428, 426155031380951, 1700774487052680, 2241243783258638, 801862184492916 },
+            { 225800753248600, 1001289196776939, 1570695157447337, 474142387326152, 1860241406570283 },
+        },
+        {
+            { 1052973111938531, 571717070295127, 662638871434015, 487194242940400, 563864123356551 },
+            { 313768325663018, 1096387612893633, 232711817872390, 926931708861688, 2208373716341324 },
+            { 823857549390635, 2207592640971793, 1855512257490888, 1911413747439725, 1853809846918105 },
+        },
+        {
+            { 2036109024667906, 788786007664495, 529185570326229, 1970818175728285, 716638820776172 },
+            { 1691119362383073, 1374233162940119, 1499830893630563, 2225901026600973, 949304629739203 },
+            { 695616701038646, 20368455765111, 619664083096696, 723635083382804, 1023760209767255 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 2102881477513865, 1570274565945361, 1573617900503708, 18662635732583, 2232324307922098 },
+            { 1853931367696942, 8107973870707, 350214504129299, 775206934582587, 1752317649166792 },
+            { 1417148368003523, 721357181628282, 505725498207811, 373232277872983, 261634707184480 },
+        },
+        {
+            { 2186733281493267, 2250694917008620, 1014829812957440, 479998161452389, 83566193876474 },
+            { 1268116367301224, 560157088142809, 802626839600444, 2210189936605713, 1129993785579988 },
+            { 615183387352312, 917611676109240, 878893615973325, 978940963313282, 938686890583575 },
+        },
+        {
+            { 522024729211672, 1045059315315808, 1892245413707790, 1907891107684253, 2059998109500714 },
+            { 1799679152208884, 912132775900387, 25967768040979, 432130448590461, 274568990261996 },
+            { 98698809797682, 2144627600856209, 1907959298569602, 811491302610148, 1262481774981493 },
+        },
+        {
+            { 1791451399743152, 1713538728337276, 118349997257490, 1882306388849954, 158235232210248 },
+            { 1217809823321928, 2173947284933160, 1986927836272325, 1388114931125539, 12686131160169 },
+            { 1650875518872272, 1136263858253897, 1732115601395988, 734312880662190, 1252904681142109 },
+        },
+        {
+            { 372986456113865, 525430915458171, 2116279931702135, 501422713587815, 1907002872974925 },
+            { 803147181835288, 868941437997146, 316299302989663, 943495589630550, 571224287904572 },
+            { 227742695588364, 1776969298667369, 628602552821802, 457210915378118, 2041906378111140 },
+        },
+        {
+            { 815000523470260, 913085688728307, 1052060118271173, 1345536665214223, 541623413135555 },
+            { 1580216071604333, 1877997504342444, 857147161260913, 703522726778478, 2182763974211603 },
+            { 1870080310923419, 71988220958492, 1783225432016732, 615915287105016, 1035570475990230 },
+        },
+        {
+            { 730987750830150, 857613889540280, 1083813157271766, 1002817255970169, 1719228484436074 },
+            { 377616581647602, 1581980403078513, 804044118130621, 2034382823044191, 643844048472185 },
+            { 176957326463017, 1573744060478586, 528642225008045, 1816109618372371, 1515140189765006 },
+        },
+        {
+            { 1888911448245718, 1387110895611080, 1924503794066429, 1731539523700949, 2230378382645454 },
+            { 443392177002051, 233793396845137, 2199506622312416, 1011858706515937, 974676837063129 },
+            { 1846351103143623, 1949984838808427, 671247021915253, 1946756846184401, 1929296930380217 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1895408474337392, 1335954976788533, 985141721217292, 126921816462693, 1461766309882915 },
+            { 1770583362798948, 2134249174371107, 1845225536958177, 623900187867507, 1068565274816080 },
+            { 1291953286798969, 2102679466898679, 1596002078575263, 1387588817990761, 2143444637427225 },
+        },
+        {
+            { 520696289105719, 665438838768697, 1731727230740743, 2247887220248582, 2143609474706149 },
+            { 1493094934626749, 1179627985066790, 395613897622098, 353090108066162, 1901192209543475 },
+            { 923819152192005, 1415712944791087, 1125410698033067, 788009900900011, 869993295869018 },
+        },
+        {
+            { 204956829392967, 809094375604991, 1507634607850626, 191005950079242, 567228983531913 },
+            { 283196041868811, 1147008544955674, 10027312539148, 1481998462876797, 693990283152694 },
+            { 1757819380032415, 1458259160758992, 404747119062789, 1242483165113555, 1521264843142355 },
+        },
+        {
+            { 1177246463904127, 236633799581924, 76678394799500, 1550430756969068, 92809245758469 },
+            { 2205646414116132, 1924280510925419, 2153130381296311, 1685372119895441, 1251264911209213 },
+            { 1519155588261854, 483899768651806, 1235345257217886, 467640517750393, 1224438957323827 },
+        },
+        {
+            { 1246208485680505, 596853707740558, 164605439945753, 825810788485280, 831805919056410 },
+            { 599003802691435, 876671109601912, 1297741729017769, 22078932608097, 214763902213405 },
+            { 2045656886162419, 2245569838876242, 1361334406977685, 1370170063372453, 1784586163491838 },
+        },
+        {
+            { 737891874041407, 199889941827640, 720930115890536, 1153163677723625, 379353551150416 },
+            { 52463875264865, 1027608038151042, 1805698129344579, 3415274007095, 896582555813622 },
+            { 1021578499394252, 2003506226907156, 1906928204664703, 617432881327189, 487770381544088 },
+        },
+        {
+            { 1808240492311676, 683215352347115, 534275688826885, 532862053072503, 1665651319154875 },
+            { 520415614422942, 2212224482950458, 350858843094642, 1799526358920016, 1790044102967755 },
+            { 956648481954026, 2096247164218896, 1027480742584033, 928233599700570, 2122240338574709 },
+        },
+        {
+            { 629205712253447, 696219141060254, 2240941577462355, 167573388134812, 430353727713638 },
+            { 126346605636302, 787953954157654, 1019044033937394, 2068877580663841, 1651025896417965 },
+            { 948811544154236, 95827271348811, 971972540788513, 1752656910961976, 1577613288465037 },
+        },
+    },
+#endif
+    {
+        {
+            { 849646212452002, 1410198775302919, 73767886183695, 1641663456615812, 762256272452411 },
+            { 692017667358279, 723305578826727, 1638042139863265, 748219305990306, 334589200523901 },
+            { 22893968530686, 2235758574399251, 1661465835630252, 925707319443452, 1203475116966621 },
+        },
+        {
+            { 801299035785166, 1733292596726131, 1664508947088596, 467749120991922, 1647498584535623 },
+            { 903105258014366, 427141894933047, 561187017169777, 1884330244401954, 1914145708422219 },
+            { 1344191060517578, 1960935031767890, 1518838929955259, 1781502350597190, 1564784025565682 },
+        },
+        {
+            { 673723351748086, 1979969272514923, 1175287312495508, 1187589090978666, 1881897672213940 },
+            { 1917185587363432, 1098342571752737, 5935801044414, 2000527662351839, 1538640296181569 },
+            { 2495540013192, 678856913479236, 224998292422872, 219635787698590, 1972465269000940 },
+        },
+        {
+            { 271413961212179, 1353052061471651, 344711291283483, 2014925838520662, 2006221033113941 },
+            { 194583029968109, 514316781467765, 829677956235672, 1676415686873082, 810104584395840 },
+            { 1980510813313589, 1948645276483975, 152063780665900, 129968026417582, 256984195613935 },
+        },
+        {
+            { 1860190562533102, 1936576191345085, 461100292705964, 1811043097042830, 957486749306835 },
+            { 796664815624365, 1543160838872951, 1500897791837765, 1667315977988401, 599303877030711 },
+            { 1151480509533204, 2136010406720455, 738796060240027, 319298003765044, 1150614464349587 },
+        },
+        {
+            { 1731069268103150, 735642447616087, 1364750481334268, 417232839982871, 927108269127661 },
+            { 1017222050227968, 1987716148359, 2234319589635701, 621282683093392, 2132553131763026 },
+            { 1567828528453324, 1017807205202360, 565295260895298, 829541698429100, 307243822276582 },
+        },
+        {
+            { 249079270936248, 1501514259790706, 947909724204848, 944551802437487, 552658763982480 },
+            { 2089966982947227, 1854140343916181, 2151980759220007, 2139781292261749, 158070445864917 },
+            { 1338766321464554, 1906702607371284, 1519569445519894, 115384726262267, 1393058953390992 },
+        },
+        {
+            { 1364621558265400, 1512388234908357, 1926731583198686, 2041482526432505, 920401122333774 },
+            { 1884844597333588, 601480070269079, 620203503079537, 1079527400117915, 1202076693132015 },
+            { 840922919763324, 727955812569642, 1303406629750194, 522898432152867, 294161410441865 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1370912655100576, 28079262268111, 1535348789227131, 2242808749632369, 809642652295670 },
+            { 635991163691045, 570696406791013, 1609311709579718, 2034994939683182, 109989835041421 },
+            { 2128769772677977, 2142654242576520, 2016094652496998, 2132031230853467, 725434888027655 },
+        },
+        {
+            { 2135073895739904, 1220642636112600, 1493509767807811, 1591839321329741, 1420071562059335 },
+            { 174203991396502, 770330841919696, 114371198672236, 1881281468795601, 79711356135445 },
+            { 1420603492551010, 679640550295814, 1617533903828801, 780154362635607, 1319780020899258 },
+        },
+        {
+            { 1443775398367956, 342649786021856, 491131145750945, 1161286236132679, 93221155048400 },
+            { 1685268313866105, 1091225057981324, 34738159867818, 1271578597078582, 933514586691351 },
+            { 194815921686333, 1256736762545940, 1408742447743650, 304562218341097, 2021464306176092 },
+        },
+        {
+            { 507963256544514, 472375505174555, 779257878153691, 1179390009947662, 709717330654464 },
+            { 960423152600264, 1015052059094369, 2084933873716193, 291273183388512, 2172369805610215 },
+            { 440075250919582, 694825884103652, 2159700403414911, 116894270435230, 1425927073727904 },
+        },
+        {
+            { 1064910415642974, 843807375901846, 1657172039814805, 2189460887246834, 1354043476687700 },
+            { 338355685925370, 1209957286868136, 2053636093096173, 1439317061430810, 795252190234667 },
+            { 1262675707031055, 1219816744922490, 519257628155087, 1497570437960201, 1372594887264798 },
+        },
+        {
+            { 1063725449602752, 943900907578118, 1225723797770692, 1930871244203904, 445682144726228 },
+            { 962494844837664, 508979718880083, 157427748727256, 2183002842632564, 1716275464667336 },
+            { 1933555860608921, 1275569655188916, 234812135397482, 96042287368239, 386392083574324 },
+        },
+        {
+            { 579973362868757, 1613196187629395, 143763356623236, 2090271503443449, 1893990359510416 },
+            { 1067678167743074, 178288898625733, 2088017980569773, 352652372368412, 720689178534569 },
+            { 1681588555670186, 980191207008201, 2154581399538671, 540872424183046, 1943954489289499 },
+        },
+        {
+            { 111282977120126, 1990957989315238, 417960004432922, 1082016561159722, 1325118659202749 },
+            { 1473525133658734, 34732346162721, 1029920254545173, 1228101358414801, 152805623267113 },
+            { 183359648873960, 382111728086623, 1969766109298473, 2071169946252387, 242935538497060 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 353760790835310, 1598361541848743, 1122905698202299, 1922533590158905, 419107700666580 },
+            { 359856369838236, 180914355488683, 861726472646627, 218807937262986, 575626773232501 },
+            { 755467689082474, 909202735047934, 730078068932500, 936309075711518, 2007798262842972 },
+        },
+        {
+            { 1609384177904073, 362745185608627, 1335318541768201, 800965770436248, 547877979267412 },
+            { 984339177776787, 815727786505884, 1645154585713747, 1659074964378553, 1686601651984156 },
+            { 1697863093781930, 599794399429786, 1104556219769607, 830560774794755, 12812858601017 },
+        },
+        {
+            { 1168737550514982, 897832437380552, 463140296333799, 302564600022547, 2008360505135501 },
+            { 1856930662813910, 678090852002597, 1920179140755167, 1259527833759868, 55540971895511 },
+            { 1158643631044921, 476554103621892, 178447851439725, 1305025542653569, 103433927680625 },
+        },
+        {
+            { 2176793111709008, 1576725716350391, 2009350167273523, 2012390194631546, 2125297410909580 },
+            { 825403285195098, 2144208587560784, 1925552004644643, 1915177840006985, 1015952128947864 },
+            { 1807108316634472, 1534392066433717, 347342975407218, 1153820745616376, 7375003497471 },
+        },
+        {
+            { 983061001799725, 431211889901241, 2201903782961093, 817393911064341, 2214616493042167 },
+            { 228567918409756, 865093958780220, 358083886450556, 159617889659320, 1360637926292598 },
+            { 234147501399755, 2229469128637390, 2175289352258889, 1397401514549353, 1885288963089922 },
+        },
+        {
+            { 1111762412951562, 252849572507389, 1048714233823341, 146111095601446, 1237505378776770 },
+            { 1113790697840279, 1051167139966244, 1045930658550944, 2011366241542643, 1686166824620755 },
+            { 1054097349305049, 1872495070333352, 182121071220717, 1064378906787311, 100273572924182 },
+        },
+        {
+            { 1306410853171605, 1627717417672447, 50983221088417, 1109249951172250, 870201789081392 },
+            { 104233794644221, 1548919791188248, 2224541913267306, 2054909377116478, 1043803389015153 },
+            { 216762189468802, 707284285441622, 190678557969733, 973969342604308, 1403009538434867 },
+        },
+        {
+            { 1279024291038477, 344776835218310, 273722096017199, 1834200436811442, 634517197663804 },
+            { 343805853118335, 1302216857414201, 566872543223541, 2051138939539004, 321428858384280 },
+            { 470067171324852, 1618629234173951, 2000092177515639, 7307679772789, 1117521120249968 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 2216608521812979, 1133671267609171, 1886801270451833, 693723450681229, 2177664326279079 },
+            { 1217176410618852, 1156758041567635, 584945597615208, 401700658526440, 188718999318719 },
+            { 2233307833752057, 720411965215730, 1519169695491573, 1249545629073374, 42274079495163 },
+        },
+        {
+            { 1028220431149045, 1318628129209811, 867598555050648, 391516159010623, 618793687544686 },
+            { 785648940778980, 1566075695368470, 2205885851017647, 372501423919883, 2042694981038794 },
+            { 354305362086679, 1512134460741612, 359672307646707, 182487842123724, 70434142068276 },
+        },
+        {
+            { 1024824838093574, 182044951578079, 539066115399189, 1963658167580139, 888614446782442 },
+            { 1693757839885659, 836292189541753, 950751758815067, 982651358735092, 221102476905845 },
+            { 46706548238824, 1986500518838735, 2027136585204085, 1143580830274421, 237034819567290 },
+        },
+        {
+            { 1210457740468652, 2215903401275260, 1545855048122212, 1560256833448838, 235678314205821 },
+            { 1677629762901748, 541583930343398, 1383717393793391, 951594759624156, 166785376717098 },
+            { 1032532177573683, 1507169914894481, 893954872249259, 1464210961075811, 2248024514969267 },
+        },
+        {
+            { 2215196432839229, 1453988298479780, 911159768469061, 1417180860727486, 1916001465630095 },
+            { 266073750133030, 1063660218646657, 2001496173067453, 1054570510340478, 1787320193554613 },
+            { 1593076635649167, 613414152324278, 1398118686752976, 1550186634066418, 2024312475795755 },
+        },
+        {
+            { 1611115816843085, 1564686497935112, 379643685080005, 291591976378398, 1070282314438177 },
+            { 20428272805067, 344278789324198, 839609851549831, 358979365865884, 847000176814724 },
+            { 1370619542022553, 13593976629245, 670888839522668, 29909561835083, 1113994299778657 },
+        },
+        {
+            { 210667856729798, 832581000901195, 979195344857408, 761623507948939, 102316955504785 },
+            { 743880451641798, 738115538583549, 1701458888198429, 1737802518950586, 1702048374090090 },
+            { 1653806661942935, 798938977173667, 1204504651898865, 2012775328403335, 959133953735021 },
+        },
+        {
+            { 1056291284182974, 186371978807430, 666572176305850, 2221533064225315, 1302577527793701 },
+            { 484740628192045, 1747162484279003, 1958227960728501, 2029226260228924, 1872489756569532 },
+            { 2246982488380161, 704048527252770, 449031029656446, 2000971659049725, 1830758195793359 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 278151578291475, 1810282338562947, 1771599529530998, 1383659409671631, 685373414471841 },
+            { 577009397403102, 1791440261786291, 2177643735971638, 174546149911960, 1412505077782326 },
+            { 893719721537457, 1201282458018197, 1522349501711173, 58011597740583, 1130406465887139 },
+        },
+        {
+            { 412607348255453, 1280455764199780, 2233277987330768, 14180080401665, 331584698417165 },
+            { 262483770854550, 990511055108216, 526885552771698, 571664396646158, 354086190278723 },
+            { 1820352417585487, 24495617171480, 1547899057533253, 10041836186225, 480457105094042 },
+        },
+        {
+            { 2023310314989233, 637905337525881, 2106474638900687, 557820711084072, 1687858215057826 },
+            { 1144168702609745, 604444390410187, 1544541121756138, 1925315550126027, 626401428894002 },
+            { 1922168257351784, 2018674099908659, 1776454117494445, 956539191509034, 36031129147635 },
+        },
+        {
+            { 544644538748041, 1039872944430374, 876750409130610, 710657711326551, 1216952687484972 },
+            { 58242421545916, 2035812695641843, 2118491866122923, 1191684463816273, 46921517454099 },
+            { 272268252444639, 1374166457774292, 2230115177009552, 1053149803909880, 1354288411641016 },
+        },
+        {
+            { 1857910905368338, 1754729879288912, 885945464109877, 1516096106802166, 1602902393369811 },
+            { 1193437069800958, 901107149704790, 999672920611411, 477584824802207, 364239578697845 },
+            { 886299989548838, 1538292895758047, 1590564179491896, 1944527126709657, 837344427345298 },
+        },
+        {
+            { 754558365378305, 1712186480903618, 1703656826337531, 750310918489786, 518996040250900 },
+            { 1309847803895382, 1462151862813074, 211370866671570, 1544595152703681, 1027691798954090 },
+            { 803217563745370, 1884799722343599, 1357706345069218, 2244955901722095, 730869460037413 },
+        },
+        {
+            { 689299471295966, 1831210565161071, 1375187341585438, 1106284977546171, 1893781834054269 },
+            { 696351368613042, 1494385251239250, 738037133616932, 636385507851544, 927483222611406 },
+            { 1949114198209333, 1104419699537997, 783495707664463, 1747473107602770, 2002634765788641 },
+        },
+        {
+            { 1607325776830197, 530883941415333, 1451089452727895, 1581691157083423, 496100432831154 },
+            { 1068900648804224, 2006891997072550, 1134049269345549, 1638760646180091, 2055396084625778 },
+            { 2222475519314561, 1870703901472013, 1884051508440561, 1344072275216753, 1318025677799069 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 477207916553285, 1488064260202941, 1661453866463954, 1141228074051855, 672072650786576 },
+            { 2069770607401591, 1225367702112866, 1538953132048656, 2188401482212846, 128593173278991 },
+            { 916404312971536, 1000014350915647, 1498754584389763, 67530592482209, 1667646385756724 },
+        },
+        {
+            { 810369747020183, 2237618141036509, 30441627290829, 396142955464533, 62356642942044 },
+            { 1586711819320142, 815259294495906, 1356055059989454, 14254368880198, 988334017759084 },
+            { 498205650210982, 2029447832739442, 1287708517665602, 2063154761502015, 592549403529808 },
+        },
+        {
+            { 1466752538541859, 2035538193320560, 138132610685025, 1256421706559322, 180051141994433 },
+            { 346572978148656, 361056717169822, 29214517564329, 1186024799767424, 308874981183664 },
+            { 1297525937307453, 1360474818962172, 1057976529132470, 481516036122456, 1284896343639676 },
+        },
+        {
+            { 394133855270478, 1022205784206132, 404819328296271, 1746214054851431, 801232833816448 },
+            { 1273141653286537, 600137967440787, 1108281665285822, 1607794127357251, 276080397056360 },
+            { 1625278703177771, 652272403287866, 1130860155562117, 1467718191751280, 170296377586353 },
+        },
+        {
+            { 1002349488419280, 981103429321237, 1398184721429428, 1349462663749659, 1811127006517843 },
+            { 590619446413372, 1231475507877741, 1102722867835777, 1502259606006997, 1928305723681151 },
+            { 1577778325058339, 2215369962281551, 1331723269758849, 1939632256423674, 52886968354553 },
+        },
+        {
+            { 477277816347755, 1888615867921889, 44593588327886, 839924021249032, 1005736290727363 },
+            { 429588372211149, 588893739892884, 1104635921931672, 713807697140284, 993807113279127 },
+            { 1035587952296453, 772571610990610, 1703146381743864, 447715678256778, 1714287687955168 },
+        },
+        {
+            { 134507668377148, 240967146617558, 971317535064000, 2019271157069067, 1502539203059821 },
+            { 750961823664047, 2079840268263426, 1582320466692507, 586009665713156, 1009573205681089 },
+            { 1328811798417377, 1232170334974369, 1723370191641238, 2166559558468187, 1898556240276951 },
+        },
+        {
+            { 1386180360119611, 1021274801195911, 1729880193705624, 2228606406348098, 1592392117444361 },
+            { 1689247777141059, 1987892221330336, 2238604025082286, 2061272829606697, 166862139432161 },
+            { 419731549689034, 1989626747750813, 1591278351630992, 1092786235861584, 177178675215960 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 155711679280656, 681100400509288, 389811735211209, 2135723811340709, 408733211204125 },
+            { 7813206966729, 194444201427550, 2071405409526507, 1065605076176312, 1645486789731291 },
+            { 16625790644959, 1647648827778410, 1579910185572704, 436452271048548, 121070048451050 },
+        },
+        {
+            { 1037263028552531, 568385780377829, 297953104144430, 1558584511931211, 2238221839292471 },
+            { 190565267697443, 672855706028058, 338796554369226, 337687268493904, 853246848691734 },
+            { 1763863028400139, 766498079432444, 1321118624818005, 69494294452268, 858786744165651 },
+        },
+        {
+            { 1292056768563024, 1456632109855638, 1100631247050184, 1386133165675321, 1232898350193752 },
+            { 366253102478259, 525676242508811, 1449610995265438, 1183300845322183, 185960306491545 },
+            { 28315355815982, 460422265558930, 1799675876678724, 1969256312504498, 1051823843138725 },
+        },
+        {
+            { 156914999361983, 1606148405719949, 1665208410108430, 317643278692271, 1383783705665320 },
+            { 54684536365732, 2210010038536222, 1194984798155308, 535239027773705, 1516355079301361 },
+            { 1484387703771650, 198537510937949, 2186282186359116, 617687444857508, 647477376402122 },
+        },
+        {
+            { 2147715541830533, 500032538445817, 646380016884826, 352227855331122, 1488268620408052 },
+            { 159386186465542, 1877626593362941, 618737197060512, 1026674284330807, 1158121760792685 },
+            { 1744544377739822, 1964054180355661, 1685781755873170, 2169740670377448, 1286112621104591 },
+        },
+        {
+            { 81977249784993, 1667943117713086, 1668983819634866, 1605016835177615, 1353960708075544 },
+            { 1602253788689063, 439542044889886, 2220348297664483, 657877410752869, 157451572512238 },
+            { 1029287186166717, 65860128430192, 525298368814832, 1491902500801986, 1461064796385400 },
+        },
+        {
+            { 408216988729246, 2121095722306989, 913562102267595, 1879708920318308, 241061448436731 },
+            { 1185483484383269, 1356339572588553, 584932367316448, 102132779946470, 1792922621116791 },
+            { 1966196870701923, 2230044620318636, 1425982460745905, 261167817826569, 46517743394330 },
+        },
+        {
+            { 107077591595359, 884959942172345, 27306869797400, 2224911448949390, 964352058245223 },
+            { 1730194207717538, 431790042319772, 1831515233279467, 1372080552768581, 1074513929381760 },
+            { 1450880638731607, 1019861580989005, 1229729455116861, 1174945729836143, 826083146840706 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1185838263017961, 1658025814770644, 412614687917606, 2015508295646823, 715217716364667 },
+            { 1481646966443338, 466715278381335, 1774539570883972, 288554375125960, 1219982066342679 },
+            { 1569664128884381, 407663338845983, 2002256010544711, 671085899312035, 984282527793076 },
+        },
+        {
+            { 322516746875165, 79424149775986, 290872190809355, 923053834242184, 852824612935969 },
+            { 1837729354575368, 1806927222817205, 772071460769486, 1075261054203712, 272300877743610 },
+            { 946711433665760, 2239987349934557, 803861660898522, 2156551410386926, 1502787654920122 },
+        },
+        {
+            { 1002763931894790, 2216555692070697, 1092592077852813, 2095372815347837, 831620519830306 },
+            { 933979342100663, 1447579579388357, 744931334263945, 1922902624484262, 1957904221232842 },
+            { 2050669866355306, 2190774465449013, 2058969733807763, 270320273862327, 1870514939355617 },
+        },
+        {
+            { 1975814150439887, 898075979342335, 1261444197722907, 508629827289513, 1552966352555280 },
+            { 652257990405769, 2146188399812219, 991910114432277, 1441046103324288, 269464123586741 },
+            { 1633514016507671, 758793436105214, 1666766843388618, 1223902548045585, 233185566290059 },
+        },
+        {
+            { 117175990536680, 205242142019633, 1624416971413677, 563819279426049, 1423562576573628 },
+            { 1832224409155062, 1433153761769974, 2221777649495288, 403216383897423, 1835854244426528 },
+            { 2039348563488973, 248927546652694, 729506739622176, 397171022735714, 1644628056647629 },
+        },
+        {
+            { 282843384358242, 819262945764986, 1435968129823677, 594097030236782, 2123224284522922 },
+            { 922213134544802, 1558729975805415, 545733826452503, 1871955716617573, 1112039957894281 },
+            { 1869384197190792, 1569592234203114, 2196362163965849, 1717386471659459, 39685498183014 },
+        },
+        {
+            { 1421109370612225, 24542237345030, 1620731107586927, 264254102429506, 1357365806509466 },
+            { 131935548103652, 101931348851158, 1207001294934204, 367655431725731, 1256859454639685 },
+            { 985026127753438, 120648499984234, 3776067837201, 1121956503069595, 1317952564469757 },
+        },
+        {
+            { 339460334668018, 1004239686397252, 1203428024902644, 1634973881827916, 77943558028425 },
+            { 19371390465932, 184228893567174, 1200073564252783, 688999569396420, 535206532329522 },
+            { 1781496335107774, 734939096367772, 1979958937781877, 860043149833798, 2198713547814584 },
+        },
+    },
+#endif
+    {
+        {
+            { 1899935429242705, 1602068751520477, 940583196550370, 82431069053859, 1540863155745696 },
+            { 2136688454840028, 2099509000964294, 1690800495246475, 1217643678575476, 828720645084218 },
+            { 765548025667841, 462473984016099, 998061409979798, 546353034089527, 2212508972466858 },
+        },
+        {
+            { 46575283771160, 892570971573071, 1281983193144090, 1491520128287375, 75847005908304 },
+            { 1801436127943107, 1734436817907890, 1268728090345068, 167003097070711, 2233597765834956 },
+            { 1997562060465113, 1048700225534011, 7615603985628, 1855310849546841, 2242557647635213 },
+        },
+        {
+            { 1161017320376250, 492624580169043, 2169815802355237, 976496781732542, 1770879511019629 },
+            { 1357044908364776, 729130645262438, 1762469072918979, 1365633616878458, 181282906404941 },
+            { 1080413443139865, 1155205815510486, 1848782073549786, 622566975152580, 124965574467971 },
+        },
+        {
+            { 1184526762066993, 247622751762817, 692129017206356, 820018689412496, 2188697339828085 },
+            { 2020536369003019, 202261491735136, 1053169669150884, 2056531979272544, 778165514694311 },
+            { 237404399610207, 1308324858405118, 1229680749538400, 720131409105291, 1958958863624906 },
+        },
+        {
+            { 515583508038846, 17656978857189, 1717918437373989, 1568052070792483, 46975803123923 },
+            { 281527309158085, 36970532401524, 866906920877543, 2222282602952734, 1289598729589882 },
+            { 1278207464902042, 494742455008756, 1262082121427081, 1577236621659884, 1888786707293291 },
+        },
+        {
+            { 353042527954210, 1830056151907359, 1111731275799225, 174960955838824, 404312815582675 },
+            { 2064251142068628, 1666421603389706, 1419271365315441, 468767774902855, 191535130366583 },
+            { 1716987058588002, 1859366439773457, 1767194234188234, 64476199777924, 1117233614485261 },
+        },
+        {
+            { 984292135520292, 135138246951259, 2220652137473167, 1722843421165029, 190482558012909 },
+            { 298845952651262, 1166086588952562, 1179896526238434, 1347812759398693, 1412945390096208 },
+            { 1143239552672925, 906436640714209, 2177000572812152, 2075299936108548, 325186347798433 },
+        },
+        {
+            { 721024854374772, 684487861263316, 1373438744094159, 2193186935276995, 1387043709851261 },
+            { 418098668140962, 715065997721283, 1471916138376055, 2168570337288357, 937812682637044 },
+            { 1043584187226485, 2143395746619356, 2209558562919611, 482427979307092, 847556718384018 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 997854281022512, 371412096455343, 385221936050652, 1659016544729114, 609442868038809 },
+            { 283947992808316, 906854516558219, 2004968339980078, 682646947000673, 252088188293511 },
+            { 1619428378651736, 1579845830028655, 3625310117685, 170605089295866, 1149673757755609 },
+        },
+        {
+            { 1431189333362745, 270437001637520, 1841157954619917, 132664511521572, 105906730937715 },
+            { 1519560400510514, 757016839193621, 962011066300527, 1331491453807482, 366291408709403 },
+            { 437646608465794, 2094793895484999, 1468162389698058, 248477625893392, 1999708435919408 },
+        },
+        {
+            { 151762711386453, 1479291836708385, 28706304084431, 693677176641407, 1695373042660191 },
+            { 1082895706686204, 1560404104136121, 13895968573391, 1567209158255015, 940533344707601 },
+            { 11430723322929, 1391830113841252, 1337273140327877, 418617211527096, 2156223821909844 },
+        },
+        {
+            { 2057796043232663, 11608799675559, 1596783085458033, 1729533403820748, 911191922916278 },
+            { 1223062248495683, 1630657229329984, 493822228052059, 1371287517681447, 1729125662506463 },
+            { 43999776827657, 989331901442862, 147120313740048, 495021300047603, 2007031690017476 },
+        },
+        {
+            { 166834800897826, 1397178447208358, 1512008134852982, 1267945553334007, 639821707720737 },
+            { 65710973169109, 1680768177148666, 1133523754569866, 2202997497332408, 1347205872907513 },
+            { 1308871835809784, 2116706717414875, 56029465436904, 467188187972025, 1826981082270550 },
+        },
+        {
+            { 1956939819397260, 1563769450095983, 1153022458216287, 176747536292706, 223633771534996 },
+            { 2218297806122503, 133016207658508, 881158740655112, 1061346067421084, 2078729038976858 },
+            { 277297371046776, 1016671322777094, 1912173712739697, 1941234701885292, 1286651577841525 },
+        },
+        {
+            { 428801425089691, 761018381922151, 982093819501259, 710728397015565, 1856525231801054 },
+            { 1012626817547322, 1612612958334034, 1065746063212436, 1593166025781229, 1733591622804967 },
+            { 634704084825404, 2129536576841980, 1242863233687290, 1573321106629022, 128474589505663 },
+        },
+        {
+            { 129496500081800, 1790297098324227, 1302842166366374, 1122296729486616, 917050154500647 },
+            { 2209800470133809, 1185162704121958, 1319971255383218, 1371435139486267, 1231465623037748 },
+            { 627678063257079, 716314893721428, 1223825394014331, 504272345435927, 1599415310067837 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 1248731221520759, 1465200936117687, 540803492710140, 52978634680892, 261434490176109 },
+            { 1057329623869501, 620334067429122, 461700859268034, 2012481616501857, 297268569108938 },
+            { 1055352180870759, 1553151421852298, 1510903185371259, 1470458349428097, 1226259419062731 },
+        },
+        {
+            { 1492988790301668, 790326625573331, 1190107028409745, 1389394752159193, 1620408196604194 },
+            { 47000654413729, 1004754424173864, 1868044813557703, 173236934059409, 588771199737015 },
+            { 30498470091663, 1082245510489825, 576771653181956, 806509986132686, 1317634017056939 },
+        },
+        {
+            { 420308055751555, 1493354863316002, 165206721528088, 1884845694919786, 2065456951573059 },
+            { 1115636332012334, 1854340990964155, 83792697369514, 1972177451994021, 457455116057587 },
+            { 1698968457310898, 1435137169051090, 1083661677032510, 938363267483709, 340103887207182 },
+        },
+        {
+            { 1995325341336574, 911500251774648, 164010755403692, 855378419194762, 1573601397528842 },
+            { 241719380661528, 310028521317150, 1215881323380194, 1408214976493624, 2141142156467363 },
+            { 1315157046163473, 727368447885818, 1363466668108618, 1668921439990361, 1398483384337907 },
+        },
+        {
+            { 75029678299646, 1015388206460473, 1849729037055212, 1939814616452984, 444404230394954 },
+            { 2053597130993710, 2024431685856332, 2233550957004860, 2012407275509545, 872546993104440 },
+            { 1217269667678610, 599909351968693, 1390077048548598, 1471879360694802, 739586172317596 },
+        },
+        {
+            { 1718318639380794, 1560510726633958, 904462881159922, 1418028351780052, 94404349451937 },
+            { 2132502667405250, 214379346175414, 1502748313768060, 1960071701057800, 1353971822643138 },
+            { 319394212043702, 2127459436033571, 717646691535162, 663366796076914, 318459064945314 },
+        },
+        {
+            { 405989424923593, 1960452633787083, 667349034401665, 1492674260767112, 1451061489880787 },
+            { 947085906234007, 323284730494107, 1485778563977200, 728576821512394, 901584347702286 },
+            { 1575783124125742, 2126210792434375, 1569430791264065, 1402582372904727, 1891780248341114 },
+        },
+        {
+            { 838432205560695, 1997703511451664, 1018791879907867, 1662001808174331, 78328132957753 },
+            { 739152638255629, 2074935399403557, 505483666745895, 1611883356514088, 628654635394878 },
+            { 1822054032121349, 643057948186973, 7306757352712, 577249257962099, 284735863382083 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1912748982362695, 1220789150721713, 704177718050401, 723618635926708, 1539793845278548 },
+            { 797199596391742, 1640579499587252, 2249382671495029, 1509816099416416, 1287100489183999 },
+            { 2120957025321772, 1416788979770990, 1248163529640000, 1057479098339217, 1345904049070916 },
+        },
+        {
+            { 1020723204932740, 925702577219623, 993238884888760, 1734688533140183, 2122148469059677 },
+            { 91831374297454, 1526227336126975, 1355766749788798, 604694865815954, 179753894501239 },
+            { 1672839208916523, 1716495024680343, 1707076061183264, 765180466790910, 2017432747304428 },
+        },
+        {
+            { 162252707744707, 1593372837632109, 419105697539909, 1656407715094130, 112109013318476 },
+            { 1845211281712630, 314796716337139, 1084733734214267, 2030481699162822, 408225771371226 },
+            { 192171151121229, 1275967732855104, 1864584199775891, 1693406950762857, 451756333138903 },
+        },
+        {
+            { 1612422054090644, 2236845889213344, 111947795252003, 1594023725720587, 709352663553385 },
+            { 223618880166307, 2227771290802404, 11281894918949, 2094951662727146, 841799884322096 },
+            { 1485832258557624, 680071864680695, 1288498699771584, 258483455916573, 1782424270254224 },
+        },
+        {
+            { 647490509851052, 2148582833270036, 2054273108926092, 313943912817170, 1518458853723030 },
+            { 1894112062784127, 1572664741529768, 192687866894783, 1178316066106795, 1208441649045751 },
+            { 1953522143805027, 882595907666496, 958109305864079, 1523427692628869, 1741273556819203 },
+        },
+        {
+            { 2177453523879316, 1467829313324954, 1578609310805206, 994852944077857, 1948868370865273 },
+            { 1572831344762996, 512136862546134, 1301968357947975, 107109430993572, 579378548975220 },
+            { 2160967413246114, 497546389595616, 235866284515227, 1209326819476215, 385381334474653 },
+        },
+        {
+            { 542288404046276, 1674021500357050, 1716132449579059, 599992304591102, 1525214981711194 },
+            { 1670695238902619, 2242739208774836, 1995667789637381, 2142826736425494, 36512784261153 },
+            { 2143663924692386, 1851559468934078, 1845266597269129, 477022990956902, 2179267609261901 },
+        },
+        {
+            { 1958983221377553, 2178877734404748, 1849996731612977, 1835657059247969, 2041180109654311 },
+            { 506164232017347, 1310600048415123, 805017935693660, 858678127951771, 552614740457634 },
+            { 724524272708234, 661221141789934, 1298795839460575, 1322772218421097, 837427426454482 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 1366558556363930, 1448606567552086, 1478881020944768, 165803179355898, 1115718458123498 },
+            { 204146226972102, 1630511199034723, 2215235214174763, 174665910283542, 956127674017216 },
+            { 1562934578796716, 1070893489712745, 11324610642270, 958989751581897, 2172552325473805 },
+        },
+        {
+            { 1770564423056027, 735523631664565, 1326060113795289, 1509650369341127, 65892421582684 },
+            { 623682558650637, 1337866509471512, 990313350206649, 1314236615762469, 1164772974270275 },
+            { 223256821462517, 723690150104139, 1000261663630601, 933280913953265, 254872671543046 },
+        },
+        {
+            { 1969087237026041, 624795725447124, 1335555107635969, 2069986355593023, 1712100149341902 },
+            { 1236103475266979, 1837885883267218, 1026072585230455, 1025865513954973, 1801964901432134 },
+            { 1115241013365517, 1712251818829143, 2148864332502771, 2096001471438138, 2235017246626125 },
+        },
+        {
+            { 1299268198601632, 2047148477845621, 2165648650132450, 1612539282026145, 514197911628890 },
+            { 118352772338543, 1067608711804704, 1434796676193498, 1683240170548391, 230866769907437 },
+            { 1850689576796636, 1601590730430274, 1139674615958142, 1954384401440257, 76039205311 },
+        },
+        {
+            { 1723387471374172, 997301467038410, 533927635123657, 20928644693965, 1756575222802513 },
+            { 2146711623855116, 503278928021499, 625853062251406, 1109121378393107, 1033853809911861 },
+            { 571005965509422, 2005213373292546, 1016697270349626, 56607856974274, 914438579435146 },
+        },
+        {
+            { 1346698876211176, 2076651707527589, 1084761571110205, 265334478828406, 1068954492309671 },
+            { 1769967932677654, 1695893319756416, 1151863389675920, 1781042784397689, 400287774418285 },
+            { 1851867764003121, 403841933237558, 820549523771987, 761292590207581, 1743735048551143 },
+        },
+        {
+            { 410915148140008, 2107072311871739, 1004367461876503, 99684895396761, 1180818713503224 },
+            { 285945406881439, 648174397347453, 1098403762631981, 1366547441102991, 1505876883139217 },
+            { 672095903120153, 1675918957959872, 636236529315028, 1569297300327696, 2164144194785875 },
+        },
+        {
+            { 1902708175321798, 1035343530915438, 1178560808893263, 301095684058146, 1280977479761118 },
+            { 1615357281742403, 404257611616381, 2160201349780978, 1160947379188955, 1578038619549541 },
+            { 2013087639791217, 822734930507457, 1785668418619014, 1668650702946164, 389450875221715 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1638260469631934, 1786040878698661, 906589425735481, 1583514814511733, 161900944868234 },
+            { 821091239344879, 1029728218242611, 1785130220912361, 134891303686179, 1146812607647243 },
+            { 960395712488566, 1090263312831733, 1493488072165035, 718337273853885, 140550395520083 },
+        },
+        {
+            { 582009322268611, 1462939149444616, 1699035707213512, 1260336843200283, 22744545971108 },
+            { 66233320680397, 481500577921291, 1593046392900201, 1567890828749600, 494668490181439 },
+            { 447501697246828, 643764017641830, 598739660833153, 477276555234445, 722964385617133 },
+        },
+        {
+            { 1468688697571051, 679132917145459, 729559654398033, 216030070311676, 1572642054261960 },
+            { 1240274286914554, 1067294500855911, 1808099303249661, 2078686383903322, 1106012145326576 },
+            { 601523810297856, 895074627148937, 773977692709653, 1905383167427875, 1540507530397039 },
+        },
+        {
+            { 399548058429350, 1239727848347326, 910155210437028, 460253616151978, 1473384781489285 },
+            { 649661364881903, 490692502811334, 1079509849353758, 1289782120135506, 536543674034462 },
+            { 1148448246837183, 1915539016170074, 727268432049334, 838952046766961, 1100979659516489 },
+        },
+        {
+            { 549684439104063, 1308243333207399, 849363374624769, 650751688271388, 1782136170508092 },
+            { 2061989082911795, 1479591773633681, 978076246857124, 838517167558357, 354474530763849 },
+            { 1354449553272043, 1085110494903468, 2224048655022783, 1932600057639272, 200912869737304 },
+        },
+        {
+            { 768379161979195, 698528958407689, 1384131174334607, 573310211564337, 5045987379232 },
+            { 1737002989059736, 802467700141916, 1002869782075529, 704293791948409, 2201857958628929 },
+            { 1328818899805024, 1356396048253838, 60665341223248, 1567700157316511, 290562887661571 },
+        },
+        {
+            { 2083771618977947, 1607978129046189, 1586868936731179, 268756465778504, 2196980677006700 },
+            { 286239024641757, 487000093964479, 1365236543743062, 952492668921998, 305066005571225 },
+            { 1179288489475667, 394266093483806, 2023843107238627, 906600297586329, 1987935808498095 },
+        },
+        {
+            { 2190648163527070, 1182302286459911, 1698709705179966, 606253946341655, 512030280417032 },
+            { 348777384482283, 2016426622766719, 1222199716068557, 1918283401506759, 2245473746651968 },
+            { 1766029976663583, 578113072554872, 1407762358462124, 1251410333318914, 1519685697291309 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 453918449698368, 106406819929001, 2072540975937135, 308588860670238, 1304394580755385 },
+            { 1295082798350326, 2091844511495996, 1851348972587817, 3375039684596, 789440738712837 },
+            { 2083069137186154, 848523102004566, 993982213589257, 1405313299916317, 1532824818698468 },
+        },
+        {
+            { 1495961298852430, 1397203457344779, 1774950217066942, 139302743555696, 66603584342787 },
+            { 1782411379088302, 1096724939964781, 27593390721418, 542241850291353, 1540337798439873 },
+            { 693543956581437, 171507720360750, 1557908942697227, 1074697073443438, 1104093109037196 },
+        },
+        {
+            { 345288228393419, 1099643569747172, 134881908403743, 1740551994106740, 248212179299770 },
+            { 231429562203065, 1526290236421172, 2021375064026423, 1520954495658041, 806337791525116 },
+            { 1079623667189886, 872403650198613, 766894200588288, 2163700860774109, 2023464507911816 },
+        },
+        {
+            { 854645372543796, 1936406001954827, 151460662541253, 825325739271555, 1554306377287556 },
+            { 1497138821904622, 1044820250515590, 1742593886423484, 1237204112746837, 849047450816987 },
+            { 667962773375330, 1897271816877105, 1399712621683474, 1143302161683099, 2081798441209593 },
+        },
+        {
+            { 127147851567005, 1936114012888110, 1704424366552046, 856674880716312, 716603621335359 },
+            { 1072409664800960, 2146937497077528, 1508780108920651, 935767602384853, 1112800433544068 },
+            { 333549023751292, 280219272863308, 2104176666454852, 1036466864875785, 536135186520207 },
+        },
+        {
+            { 373666279883137, 146457241530109, 304116267127857, 416088749147715, 1258577131183391 },
+            { 1186115062588401, 2251609796968486, 1098944457878953, 1153112761201374, 1791625503417267 },
+            { 1870078460219737, 2129630962183380, 852283639691142, 292865602592851, 401904317342226 },
+        },
+        {
+            { 1361070124828035, 815664541425524, 1026798897364671, 1951790935390647, 555874891834790 },
+            { 1546301003424277, 459094500062839, 1097668518375311, 1780297770129643, 720763293687608 },
+            { 1212405311403990, 1536693382542438, 61028431067459, 1863929423417129, 1223219538638038 },
+        },
+        {
+            { 1294303766540260, 1183557465955093, 882271357233093, 63854569425375, 2213283684565087 },
+            { 339050984211414, 601386726509773, 413735232134068, 966191255137228, 1839475899458159 },
+            { 235605972169408, 2174055643032978, 1538335001838863, 1281866796917192, 1815940222628465 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1595188599035679, 1464526558278044, 1898228983618218, 1360237543176202, 561355623244020 },
+            { 1624984233972943, 1175602927768556, 2008613229958363, 860666473258130, 8855064843107 },
+            { 427225699371050, 88989906931284, 374954954790275, 1891881595245671, 72849256625193 },
+        },
+        {
+            { 84040170431047, 1931214780001053, 1443891068193482, 1666635094108942, 143074570822442 },
+            { 1665011381698399, 1378754749747507, 487038326296225, 1599334628314079, 304382055379555 },
+            { 487618024041635, 1610635862259296, 1930277174961405, 2060246530132043, 471988063294585 },
+        },
+        {
+            { 2223680929791699, 3895789171725, 2223372744379625, 329958323306502, 1157672051964720 },
+            { 701077051295997, 1498973766670763, 965619022184082, 600210618912150, 946632765773793 },
+            { 1191620799152162, 584262428445493, 1654487633336816, 80589900150873, 1778885798645876 },
+        },
+        {
+            { 1025432551730846, 1648743746278575, 16684771081519, 347896520603035, 1136469383570497 },
+            { 1553077072086479, 778919053728455, 581206537360082, 2100029769810002, 192766048046100 },
+            { 437947250844137, 170970937295705, 294909197597269, 2210849722009323, 1802271999575202 },
+        },
+        {
+            { 201073881439011, 931718652949941, 973211343795092, 1530254508436787, 2236389510678133 },
+            { 1726185346943403, 2193387419422952, 1890097848201710, 1860939486991039, 469851139316624 },
+            { 1718640585909930, 289464657861405, 256448940553760, 1840710967168708, 1367355358576031 },
+        },
+        {
+            { 845231506816104, 1497801914137387, 179661962670609, 2145415545771871, 1633953832787249 },
+            { 2166294423799637, 1610366344712604, 1808984605923163, 1918368870787446, 953302106671412 },
+            { 1855071951306216, 234835319416374, 608676288546844, 311106921331784, 1424607004261872 },
+        },
+        {
+            { 875790924532156, 356110076454187, 625984861031329, 898713331800149, 1867577233264451 },
+            { 1031287607922522, 452313692528250, 2184482840358932, 653471947427836, 1295546328991203 },
+            { 865238419718368, 2167660602098967, 849033435333870, 1879862001988212, 2194604163295964 },
+        },
+        {
+            { 345774063281888, 1248680369566159, 993767719430878, 632344407656797, 494002909476340 },
+            { 525302074276141, 241111491449954, 1218402302345939, 567375174674023, 525859655102473 },
+            { 1262037831799441, 1761445988918060, 1818282615037362, 643977010061831, 1670449776207217 },
+        },
+    },
+#endif
+    {
+        {
+            { 1632352921721536, 1833328609514701, 2092779091951987, 1923956201873226, 2210068022482919 },
+            { 35271216625062, 1712350667021807, 983664255668860, 98571260373038, 1232645608559836 },
+            { 1998172393429622, 1798947921427073, 784387737563581, 1589352214827263, 1589861734168180 },
+        },
+        {
+            { 1733739258725305, 31715717059538, 201969945218860, 992093044556990, 1194308773174556 },
+            { 846415389605137, 746163495539180, 829658752826080, 592067705956946, 957242537821393 },
+            { 1758148849754419, 619249044817679, 168089007997045, 1371497636330523, 1867101418880350 },
+        },
+        {
+            { 326633984209635, 261759506071016, 1700682323676193, 1577907266349064, 1217647663383016 },
+            { 1714182387328607, 1477856482074168, 574895689942184, 2159118410227270, 1555532449716575 },
+            { 853828206885131, 998498946036955, 1835887550391235, 207627336608048, 258363815956050 },
+        },
+        {
+            { 141141474651677, 1236728744905256, 643101419899887, 1646615130509173, 1208239602291765 },
+            { 1501663228068911, 1354879465566912, 1444432675498247, 897812463852601, 855062598754348 },
+            { 714380763546606, 1032824444965790, 1774073483745338, 1063840874947367, 1738680636537158 },
+        },
+        {
+            { 1640635546696252, 633168953192112, 2212651044092396, 30590958583852, 368515260889378 },
+            { 1171650314802029, 1567085444565577, 1453660792008405, 757914533009261, 1619511342778196 },
+            { 420958967093237, 971103481109486, 2169549185607107, 1301191633558497, 1661514101014240 },
+        },
+        {
+            { 907123651818302, 1332556122804146, 1824055253424487, 1367614217442959, 1982558335973172 },
+            { 1121533090144639, 1021251337022187, 110469995947421, 1511059774758394, 2110035908131662 },
+            { 303213233384524, 2061932261128138, 352862124777736, 40828818670255, 249879468482660 },
+        },
+        {
+            { 856559257852200, 508517664949010, 1378193767894916, 1723459126947129, 1962275756614521 },
+            { 1445691340537320, 40614383122127, 402104303144865, 485134269878232, 1659439323587426 },
+            { 20057458979482, 1183363722525800, 2140003847237215, 2053873950687614, 2112017736174909 },
+        },
+        {
+            { 2228654250927986, 1483591363415267, 1368661293910956, 1076511285177291, 526650682059608 },
+            { 709481497028540, 531682216165724, 316963769431931, 1814315888453765, 258560242424104 },
+            { 1053447823660455, 1955135194248683, 1010900954918985, 1182614026976701, 1240051576966610 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 2143318224651032, 733385627315851, 254705425241603, 246670488543148, 1442295963272082 },
+            { 1951027410316907, 776338288529184, 1414670155467203, 355995586863836, 1209606780078452 },
+            { 2200224066087308, 1167051805827953, 161446888552827, 1516422365939770, 1942535836845300 },
+        },
+        {
+            { 1230426392539272, 997104644926831, 1053774819732819, 2147764348670691, 1676514761128454 },
+            { 668289581572433, 277229536066558, 512862571267843, 1966556713706538, 794475628136672 },
+            { 1628314393858778, 1997743320994668, 1561201521750924, 1869590045554733, 1810714681142288 },
+        },
+        {
+            { 1675422916543613, 420608931102229, 507417335369419, 640362125760162, 547806107918848 },
+            { 177854791944349, 1181810088365991, 667731284331731, 2129076819445302, 821127077179399 },
+            { 1484872832783728, 72255685107270, 1098972476164964, 1732914770170238, 145186792002379 },
+        },
+        {
+            { 1372652207334635, 280088467298730, 1519487391303038, 6992513325161, 640671581341508 },
+            { 1683583627473543, 470109912280877, 1910006662061487, 346619407103075, 53117372144724 },
+            { 156581553787681, 307978851206907, 1451582278870485, 442722234791876, 662472042575165 },
+        },
+        {
+            { 2082652078388962, 493846157816801, 43960882916728, 111049106953707, 118614369521774 },
+            { 614940244711006, 1241836004262404, 149137396399876, 870877804496097, 2195700460595074 },
+            { 1712668510139487, 784271226274642, 827073136956465, 1001465329762964, 1662630974562798 },
+        },
+        {
+            { 818080711416948, 1360095872859392, 283891848994117, 834642121756558, 787978368976316 },
+            { 652575947450972, 2107702224275112, 718520440691947, 141932352843721, 172644594071659 },
+            { 1509857525874286, 1496970584948645, 399828714647739, 1863753979948441, 2149707660031809 },
+        },
+        {
+            { 700395318544234, 1093768336629146, 1768906295222690, 2025477905414216, 743793294293786 },
+            { 1893066183933410, 836260013095430, 2186488905733469, 211412087780179, 1358659880821660 },
+            { 1951144383031056, 1085048452592587, 499199223423315, 2055889411465929, 698006601614245 },
+        },
+        {
+            { 700816495675260, 1165569165048171, 2172597164236109, 1071655796287173, 140828680192945 },
+            { 1932164408348001, 314265512109288, 1717210254999343, 1391381349870857, 1425970078148568 },
+            { 1862104717906915, 1752261107932084, 1874923294613947, 1008681858018398, 628821150989939 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 1957943897155497, 1788667368028035, 137692910029106, 1039519607062, 826404763313028 },
+            { 1848942433095597, 1582009882530495, 1849292741020143, 1068498323302788, 2001402229799484 },
+            { 1528282417624269, 2142492439828191, 2179662545816034, 362568973150328, 1591374675250271 },
+        },
+        {
+            { 160026679434388, 232341189218716, 2149181472355545, 598041771119831, 183859001910173 },
+            { 2013278155187349, 662660471354454, 793981225706267, 411706605985744, 804490933124791 },
+            { 2051892037280204, 488391251096321, 2230187337030708, 930221970662692, 679002758255210 },
+        },
+        {
+            { 1530723630438670, 875873929577927, 341560134269988, 449903119530753, 1055551308214179 },
+            { 1461835919309432, 1955256480136428, 180866187813063, 1551979252664528, 557743861963950 },
+            { 359179641731115, 1324915145732949, 902828372691474, 294254275669987, 1887036027752957 },
+        },
+        {
+            { 2043271609454323, 2038225437857464, 1317528426475850, 1398989128982787, 2027639881006861 },
+            { 2072902725256516, 312132452743412, 309930885642209, 996244312618453, 1590501300352303 },
+            { 1397254305160710, 695734355138021, 2233992044438756, 1776180593969996, 1085588199351115 },
+        },
+        {
+            { 440567051331029, 254894786356681, 493869224930222, 1556322069683366, 1567456540319218 },
+            { 1950722461391320, 1907845598854797, 1822757481635527, 2121567704750244, 73811931471221 },
+            { 387139307395758, 2058036430315676, 1220915649965325, 1794832055328951, 1230009312169328 },
+        },
+        {
+            { 1765973779329517, 659344059446977, 19821901606666, 1301928341311214, 1116266004075885 },
+            { 1127572801181483, 1224743760571696, 1276219889847274, 1529738721702581, 1589819666871853 },
+            { 2181229378964934, 2190885205260020, 1511536077659137, 1246504208580490, 668883326494241 },
+        },
+        {
+            { 437866655573314, 669026411194768, 81896997980338, 523874406393178, 245052060935236 },
+            { 1975438052228868, 1071801519999806, 594652299224319, 1877697652668809, 1489635366987285 },
+            { 958592545673770, 233048016518599, 851568750216589, 567703851596087, 1740300006094761 },
+        },
+        {
+            { 2014540178270324, 192672779514432, 213877182641530, 2194819933853411, 1716422829364835 },
+            { 1540769606609725, 2148289943846077, 1597804156127445, 1230603716683868, 815423458809453 },
+            { 1738560251245018, 1779576754536888, 1783765347671392, 1880170990446751, 1088225159617541 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 944214205150673, 113579352686446, 1305491360151613, 710549772492770, 1508433893219248 },
+            { 181463710138863, 324899312232426, 748437826404564, 1442893546327651, 882055388832311 },
+            { 99837384801727, 2128746966172064, 1728087272474317, 1660968164341303, 2094478837305487 },
+        },
+        {
+            { 1045092786794937, 922156857253434, 571265958550934, 1028247394751676, 400144133024675 },
+            { 556217026906589, 2242519046221962, 731336075742219, 560401179364011, 169768611612000 },
+            { 1350540322092981, 428507123444697, 863081413402232, 950089447398951, 118865435494230 },
+        },
+        {
+            { 1863120758931548, 363455748508989, 294830767865354, 1329441793127641, 1244078294695462 },
+            { 182272565770359, 734294835564241, 1742364616598960, 2088189023592845, 952744900119070 },
+            { 317239144147936, 1378693805440304, 1613995646839215, 1790616997152168, 1664744641804674 },
+        },
+        {
+            { 910278956134402, 894183083609573, 830213734772943, 1343060696486484, 611721765217825 },
+            { 664779139067617, 1109839789271330, 140453904417500, 1571861604864808, 1784338148265262 },
+            { 220994375354681, 1633125608855915, 2233079832150828, 144297568151940, 217868145580028 },
+        },
+        {
+            { 2185253522527409, 1722061079589371, 929518249744037, 221372430121949, 1175414668689858 },
+            { 1891204165383711, 1628768707650559, 563598116936137, 1060040405961115, 1250875073838129 },
+            { 579681536856473, 1962714631533051, 518559321779053, 971489356480100, 509262501560864 },
+        },
+        {
+            { 1528432877912367, 135699980342021, 780855157188914, 1744928736206446, 1837149863417515 },
+            { 1673313678131884, 345643119065179, 43736965486584, 1315834285030270, 2054079925795780 },
+            { 1612827416827303, 1149821613065205, 1844912308905994, 429769677786205, 1866058244678788 },
+        },
+        {
+            { 1087967203355487, 1504313118437159, 1271975234407042, 2125305808015759, 1278369242007838 },
+            { 820369788540377, 503902269054747, 1799301074563172, 1789926653723236, 316108959484144 },
+            { 2109491846902798, 1459244188614787, 1145316246074802, 537401043713173, 2076110035136585 },
+        },
+        {
+            { 291256384752389, 1431181693384326, 1492922137755707, 301469885232977, 1110919820832195 },
+            { 916743892302278, 663940551107639, 723671180823208, 1605702843269381, 586953762179027 },
+            { 641798503068060, 129975789967638, 2167736719761015, 31631641435626, 350785183214734 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 659303913929492, 1956447718227573, 1830568515922666, 841069049744408, 1669607124206368 },
+            { 1143465490433355, 1532194726196059, 1093276745494697, 481041706116088, 2121405433561163 },
+            { 1686424298744462, 1451806974487153, 266296068846582, 1834686947542675, 1720762336132256 },
+        },
+        {
+            { 889217026388959, 1043290623284660, 856125087551909, 1669272323124636, 1603340330827879 },
+            { 1206396181488998, 333158148435054, 1402633492821422, 1120091191722026, 1945474114550509 },
+            { 766720088232571, 1512222781191002, 1189719893490790, 2091302129467914, 2141418006894941 },
+        },
+        {
+            { 419663647306612, 1998875112167987, 1426599870253707, 1154928355379510, 486538532138187 },
+            { 938160078005954, 1421776319053174, 1941643234741774, 180002183320818, 1414380336750546 },
+            { 398001940109652, 1577721237663248, 1012748649830402, 1540516006905144, 1011684812884559 },
+        },
+        {
+            { 1653276489969630, 6081825167624, 1921777941170836, 1604139841794531, 861211053640641 },
+            { 996661541407379, 1455877387952927, 744312806857277, 139213896196746, 1000282908547789 },
+            { 1450817495603008, 1476865707053229, 1030490562252053, 620966950353376, 1744760161539058 },
+        },
+        {
+            { 559728410002599, 37056661641185, 2038622963352006, 1637244893271723, 1026565352238948 },
+            { 962165956135846, 1116599660248791, 182090178006815, 1455605467021751, 196053588803284 },
+            { 796863823080135, 1897365583584155, 420466939481601, 2165972651724672, 932177357788289 },
+        },
+        {
+            { 877047233620632, 1375632631944375, 643773611882121, 660022738847877, 19353932331831 },
+            { 2216943882299338, 394841323190322, 2222656898319671, 558186553950529, 1077236877025190 },
+            { 801118384953213, 1914330175515892, 574541023311511, 1471123787903705, 1526158900256288 },
+        },
+        {
+            { 949617889087234, 2207116611267331, 912920039141287, 501158539198789, 62362560771472 },
+            { 1474518386765335, 1760793622169197, 1157399790472736, 1622864308058898, 165428294422792 },
+            { 1961673048027128, 102619413083113, 1051982726768458, 1603657989805485, 1941613251499678 },
+        },
+        {
+            { 1401939116319266, 335306339903072, 72046196085786, 862423201496006, 850518754531384 },
+            { 1234706593321979, 1083343891215917, 898273974314935, 1640859118399498, 157578398571149 },
+            { 1143483057726416, 1992614991758919, 674268662140796, 1773370048077526, 674318359920189 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1051236049852089, 838236098838683, 1401529863477899, 819561906490618, 1695547314615010 },
+            { 906923277717385, 1205267497856625, 1482990850447715, 814292408880760, 1285504246425383 },
+            { 342012360452061, 1887029215668228, 1155449753977691, 310762800506541, 1868750527042639 },
+        },
+        {
+            { 446777329491613, 1182111476573108, 361578732926394, 969051558291558, 551871149504900 },
+            { 1502211512267751, 522814637298393, 2125300438723032, 2018782704272556, 1170472673030354 },
+            { 883746203814773, 276737323512287, 2229390196673160, 2155663378443822, 635390057802745 },
+        },
+        {
+            { 840689961188280, 666855865921493, 2236632145763388, 553161305644429, 770093598280661 },
+            { 1845357083269366, 283024454100284, 1261058990950787, 83148423763794, 1614274061088985 },
+            { 1649953183870355, 2176771717569818, 1233096109604549, 1152511702037810, 560573824644263 },
+        },
+        {
+            { 1027653299140521, 430869933716354, 39439958469758, 1392853852430383, 1280424544026220 },
+            { 1374992270629118, 886701324738892, 997915444084346, 1696807732220344, 949943622938188 },
+            { 380965098906693, 835788132761480, 2232989119976139, 2205277179143298, 1175904351372329 },
+        },
+        {
+            { 1276840412816828, 519369712833844, 2136012615148104, 180094089822217, 1217611106137227 },
+            { 584819573993171, 924094872480204, 796197507715680, 731723549536055, 1969026109607883 },
+            { 2073239372536943, 30649016949678, 644492521678981, 305840627193069, 109901429265295 },
+        },
+        {
+            { 1192657509706017, 254094871160624, 304298342555628, 57611730819281, 1820864150951983 },
+            { 636107730675348, 185072076823130, 2101052688617099, 1881041993651043, 1584751668557586 },
+            { 1002466072624564, 1231676492638173, 1795061881446222, 564780581799518, 2025621015597595 },
+        },
+        {
+            { 1115844988064971, 1502804280456612, 1751381457602880, 166909719550833, 1630322347022899 },
+            { 355092532084366, 1733818571083951, 265012342377874, 819197490530921, 144646279720813 },
+            { 374714050779396, 405289438859672, 1963133877676048, 2112584561135192, 1143185401022561 },
+        },
+        {
+            { 1926650836092769, 1141267952622767, 1136176853749112, 2038056869767014, 1320936551384977 },
+            { 1594911994296225, 1802592071832, 643263241942676, 120105560381493, 1062009661984977 },
+            { 283489509389185, 614480115735096, 278795579529276, 1166609138076060, 1715497286463476 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 1835401379538542, 173900035308392, 818247630716732, 1762100412152786, 1021506399448291 },
+            { 1506632088156630, 2127481795522179, 513812919490255, 140643715928370, 442476620300318 },
+            { 2056683376856736, 219094741662735, 2193541883188309, 1841182310235800, 556477468664293 },
+        },
+        {
+            { 1315019427910827, 1049075855992603, 2066573052986543, 266904467185534, 2040482348591520 },
+            { 94096246544434, 922482381166992, 24517828745563, 2139430508542503, 2097139044231004 },
+            { 537697207950515, 1399352016347350, 1563663552106345, 2148749520888918, 549922092988516 },
+        },
+        {
+            { 1747985413252434, 680511052635695, 1809559829982725, 594274250930054, 201673170745982 },
+            { 323583936109569, 1973572998577657, 1192219029966558, 79354804385273, 1374043025560347 },
+            { 213277331329947, 416202017849623, 1950535221091783, 1313441578103244, 2171386783823658 },
+        },
+        {
+            { 189088804229831, 993969372859110, 895870121536987, 1547301535298256, 1477373024911350 },
+            { 1620578418245010, 541035331188469, 2235785724453865, 2154865809088198, 1974627268751826 },
+            { 1346805451740245, 1350981335690626, 942744349501813, 2155094562545502, 1012483751693409 },
+        },
+        {
+            { 2107080134091762, 1132567062788208, 1824935377687210, 769194804343737, 1857941799971888 },
+            { 1074666112436467, 249279386739593, 1174337926625354, 1559013532006480, 1472287775519121 },
+            { 1872620123779532, 1892932666768992, 1921559078394978, 1270573311796160, 1438913646755037 },
+        },
+        {
+            { 837390187648199, 1012253300223599, 989780015893987, 1351393287739814, 328627746545550 },
+            { 1028328827183114, 1711043289969857, 1350832470374933, 1923164689604327, 1495656368846911 },
+            { 1900828492104143, 430212361082163, 687437570852799, 832514536673512, 1685641495940794 },
+        },
+        {
+            { 842632847936398, 605670026766216, 290836444839585, 163210774892356, 2213815011799645 },
+            { 1176336383453996, 1725477294339771, 12700622672454, 678015708818208, 162724078519879 },
+            { 1448049969043497, 1789411762943521, 385587766217753, 90201620913498, 832999441066823 },
+        },
+        {
+            { 516086333293313, 2240508292484616, 1351669528166508, 1223255565316488, 750235824427138 },
+            { 1263624896582495, 1102602401673328, 526302183714372, 2152015839128799, 1483839308490010 },
+            { 442991718646863, 1599275157036458, 1925389027579192, 899514691371390, 350263251085160 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 708933751359100, 2107676482823116, 1657279889267301, 1609984394439769, 1082526754413784 },
+            { 1606753372548095, 1940797730019702, 2170465741030982, 557319246680918, 1999867966032864 },
+            { 1823622181083017, 408967151178094, 2033143529389867, 2209724434343478, 918118538477317 },
+        },
+        {
+            { 590468521603508, 1888183319191452, 1440689086131057, 1677336684221251, 1925080943820196 },
+            { 1585117306142537, 1612495744818187, 2023976907380213, 2224019669007289, 182352658157013 },
+            { 463491021439363, 1750609461077078, 1169967881279297, 474253519600450, 901070375860211 },
+        },
+        {
+            { 1234176672107405, 1118156106770039, 1401308706374344, 49246839018891, 129899069235955 },
+            { 2148892609267637, 156091090159501, 219195676377608, 1764671763402282, 1450853793183865 },
+            { 288029433804634, 1918327772711516, 1858109617364668, 1548745667412753, 1635036158704975 },
+        },
+        {
+            { 1915560744141480, 968144533182421, 1684794323668365, 813038486884416, 485174716721005 },
+            { 396318558702260, 1083473990827737, 904833535607248, 1965475057496774, 806903729265008 },
+            { 131383425958682, 1726194406199626, 1195125520329959, 1269440178344704, 1934708138886976 },
+        },
+        {
+            { 2185121667669569, 1115206785572251, 704158439711004, 2133851508118048, 1251130304627637 },
+            { 309139531546063, 2049522628380760, 1821330378737221, 2189050579333957, 379745028034240 },
+            { 1895230235031468, 1896812472261458, 768470747222158, 1996242383935516, 1420798451369434 },
+        },
+        {
+            { 1579856931436900, 195251954153981, 616268009970342, 1688893962924789, 2116170079089324 },
+            { 1336195493856024, 616151775822139, 132656637077528, 800859950704494, 523331976590323 },
+            { 556211501812000, 449190026847667, 2036295767110360, 128995208617458, 1118467502984960 },
+        },
+        {
+            { 1146590809115000, 1820230761045333, 438948341893375, 844036154978819, 278417404664415 },
+            { 1098861443862149, 1056118674042928, 602217524379356, 1351672530126771, 1647296273265328 },
+            { 1878982227582804, 1431346083601994, 1534977024077189, 2155113334662581, 1782950372830762 },
+        },
+        {
+            { 352512930664620, 200908289136568, 978667112601609, 2118488738947709, 52678658272637 },
+            { 194062342816527, 1511332321457621, 529868032979417, 655355508011806, 156865380492922 },
+            { 1390885694073460, 1816639772663275, 1066627353945560, 1454561122724455, 848860562366790 },
+        },
+    },
+#endif
+    {
+        {
+            { 1689713572022143, 593854559254373, 978095044791970, 1985127338729499, 1676069120347625 },
+            { 1557207018622683, 340631692799603, 1477725909476187, 614735951619419, 2033237123746766 },
+            { 968764929340557, 1225534776710944, 662967304013036, 1155521416178595, 791142883466590 },
+        },
+        {
+            { 1487081286167458, 993039441814934, 1792378982844640, 698652444999874, 2153908693179754 },
+            { 1123181311102823, 685575944875442, 507605465509927, 1412590462117473, 568017325228626 },
+            { 560258797465417, 2193971151466401, 1824086900849026, 579056363542056, 1690063960036441 },
+        },
+        {
+            { 1918407319222416, 353767553059963, 1930426334528099, 1564816146005724, 1861342381708096 },
+            { 2131325168777276, 1176636658428908, 1756922641512981, 1390243617176012, 1966325177038383 },
+            { 2063958120364491, 2140267332393533, 699896251574968, 273268351312140, 375580724713232 },
+        },
+        {
+            { 2024297515263178, 416959329722687, 1079014235017302, 171612225573183, 1031677520051053 },
+            { 2033900009388450, 1744902869870788, 2190580087917640, 1949474984254121, 231049754293748 },
+            { 343868674606581, 550155864008088, 1450580864229630, 481603765195050, 896972360018042 },
+        },
+        {
+            { 2151139328380127, 314745882084928, 59756825775204, 1676664391494651, 2048348075599360 },
+            { 1528930066340597, 1605003907059576, 1055061081337675, 1458319101947665, 1234195845213142 },
+            { 830430507734812, 1780282976102377, 1425386760709037, 362399353095425, 2168861579799910 },
+        },
+        {
+            { 1155762232730333, 980662895504006, 2053766700883521, 490966214077606, 510405877041357 },
+            { 1683750316716132, 652278688286128, 1221798761193539, 1897360681476669, 319658166027343 },
+            { 618808732869972, 72755186759744, 2060379135624181, 1730731526741822, 48862757828238 },
+        },
+        {
+            { 1463171970593505, 1143040711767452, 614590986558883, 1409210575145591, 1882816996436803 },
+            { 2230133264691131, 563950955091024, 2042915975426398, 827314356293472, 672028980152815 },
+            { 264204366029760, 1654686424479449, 2185050199932931, 2207056159091748, 506015669043634 },
+        },
+        {
+            { 1784446333136569, 1973746527984364, 334856327359575, 1156769775884610, 1023950124675478 },
+            { 2065270940578383, 31477096270353, 306421879113491, 181958643936686, 1907105536686083 },
+            { 1496516440779464, 1748485652986458, 872778352227340, 818358834654919, 97932669284220 },
+        },
+    },
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 432661147328404, 1458149898387512, 1783966662497693, 1338383483986408, 1938129546538183 },
+            { 1362667331125037, 555463793483067, 2233240717963474, 1482036091634425, 897559387782686 },
+            { 40033251972751, 73885946378640, 1935473366247146, 1461619709267546, 1211799649582059 },
+        },
+        {
+            { 49425255395021, 2184860938031359, 21532237643300, 1704804667098003, 1911735781256473 },
+            { 746857581688692, 2121876522621080, 578602395071792, 691986710522145, 2051278946864590 },
+            { 2217303387266656, 2227853943602075, 1384266551040407, 847818056628355, 1874126181291960 },
+        },
+        {
+            { 511808424110958, 95001800636962, 793507020418793, 1893958852943479, 1490859261541415 },
+            { 724572331868085, 321008899798181, 315092682951313, 1732195053250012, 1362839778971948 },
+            { 247688480299164, 1512873113726713, 1351630747308477, 937439467136054, 1030677695284257 },
+        },
+        {
+            { 995506859453010, 174069429422226, 370685091406527, 2040657700179410, 1450858492090282 },
+            { 1421908854362862, 161715173892682, 1729749930861440, 1836384830865689, 48949287445656 },
+            { 1636572211186580, 2000987144770729, 1893417472062746, 196779160527558, 1557344243161357 },
+        },
+        {
+            { 58206435040451, 1647962485872619, 571343575850786, 2192050419207498, 1818655878772515 },
+            { 1990326951571735, 39942429932174, 1220931917762756, 1377401564086862, 638375379383762 },
+            { 1024434193686880, 2242250021719251, 564307645117404, 690001361734624, 239056809198959 },
+        },
+        {
+            { 1465308832663009, 1832715868509754, 1560251908961280, 1684888211341315, 1618372056987552 },
+            { 209420286242178, 1876428619982435, 524425257737618, 1202135167308774, 1054762770895410 },
+            { 1877409538331051, 337692456674055, 879114692044355, 2186377676371749, 1343387843321657 },
+        },
+        {
+            { 1417716756510978, 2121969005742830, 1652467606544375, 446235034197272, 1024151721460437 },
+            { 1890392837498603, 1272921445931038, 1342905285585414, 1707354168475339, 909422283336391 },
+            { 535664786267626, 858000264335400, 1392803193793530, 460772165692459, 1244185301942167 },
+        },
+        {
+            { 1495731174651295, 280947107652162, 2156800382632015, 1987445924091844, 1196317565653296 },
+            { 2250306499911260, 1939747202154883, 1217632366505406, 177514286663808, 968879985948762 },
+            { 483117633444291, 1721449975252800, 2014677970681898, 2079902425951169, 117285229800651 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 471636015770351, 672455402793577, 1804995246884103, 1842309243470804, 1501862504981682 },
+            { 1013216974933691, 538921919682598, 1915776722521558, 1742822441583877, 1886550687916656 },
+            { 2094270000643336, 303971879192276, 40801275554748, 649448917027930, 1818544418535447 },
+        },
+        {
+            { 2241737709499165, 549397817447461, 838180519319392, 1725686958520781, 1705639080897747 },
+            { 1216074541925116, 50120933933509, 1565829004133810, 721728156134580, 349206064666188 },
+            { 948617110470858, 346222547451945, 1126511960599975, 1759386906004538, 493053284802266 },
+        },
+        {
+            { 1454933046815146, 874696014266362, 1467170975468588, 1432316382418897, 2111710746366763 },
+            { 2105387117364450, 1996463405126433, 1303008614294500, 851908115948209, 1353742049788635 },
+            { 750300956351719, 1487736556065813, 15158817002104, 1511998221598392, 971739901354129 },
+        },
+        {
+            { 1874648163531693, 2124487685930551, 1810030029384882, 918400043048335, 586348627300650 },
+            { 1235084464747900, 1166111146432082, 1745394857881591, 1405516473883040, 4463504151617 },
+            { 1663810156463827, 327797390285791, 1341846161759410, 1964121122800605, 1747470312055380 },
+        },
+        {
+            { 660005247548233, 2071860029952887, 1358748199950107, 911703252219107, 1014379923023831 },
+            { 2206641276178231, 1690587809721504, 1600173622825126, 2156096097634421, 1106822408548216 },
+            { 1344788193552206, 1949552134239140, 1735915881729557, 675891104100469, 1834220014427292 },
+        },
+        {
+            { 1920949492387964, 158885288387530, 70308263664033, 626038464897817, 1468081726101009 },
+            { 622221042073383, 1210146474039168, 1742246422343683, 1403839361379025, 417189490895736 },
+            { 22727256592983, 168471543384997, 1324340989803650, 1839310709638189, 504999476432775 },
+        },
+        {
+            { 1313240518756327, 1721896294296942, 52263574587266, 2065069734239232, 804910473424630 },
+            { 1337466662091884, 1287645354669772, 2018019646776184, 652181229374245, 898011753211715 },
+            { 1969792547910734, 779969968247557, 2011350094423418, 1823964252907487, 1058949448296945 },
+        },
+        {
+            { 207343737062002, 1118176942430253, 758894594548164, 806764629546266, 1157700123092949 },
+            { 1273565321399022, 1638509681964574, 759235866488935, 666015124346707, 897983460943405 },
+            { 1717263794012298, 1059601762860786, 1837819172257618, 1054130665797229, 680893204263559 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1271231670673207, 572836852528616, 143342018841698, 770528850757884, 250108126336533 },
+            { 721508221232856, 1746185362187777, 649848024809540, 1643484536323064, 1179347009186690 },
+            { 722866669050453, 648025000876863, 272387785321835, 1191578896340587, 133025146298323 },
+        },
+        {
+            { 82857304500618, 1554338034359360, 760468202446199, 93034647782207, 688719719651552 },
+            { 2178219113942829, 1024549486604539, 1632802890914011, 1790174780762258, 1653222380589718 },
+            { 2128452325542740, 952454207454828, 1516099560539414, 1362377470631451, 1181280467630705 },
+        },
+        {
+            { 1234316951156125, 523003930516900, 786537036458099, 587803232898987, 1645722164542235 },
+            { 1626105811055763, 1108425817222319, 1368577262542202, 1305824653124397, 1291284997707495 },
+            { 894237486099210, 1516039905189318, 1740044048087400, 593444525063043, 2109764897178862 },
+        },
+        {
+            { 1482109974932762, 1512691293799179, 1056618842237051, 1669766513116243, 1645628848588889 },
+            { 1373561144490400, 1204823121475578, 1535466087890943, 1654057093724213, 1457988383716911 },
+            { 134048702591674, 1512942576919112, 1666722043826583, 1830910766776036, 90483195207340 },
+        },
+        {
+            { 242638196481708, 1432383122970499, 1373327814736372, 1764585753875764, 464067108961610 },
+            { 1510449339451312, 916047817203617, 516663857623252, 1445637979382315, 1580153534770815 },
+            { 914153294895020, 1485178337004016, 1172992438642136, 742396957515979, 1460451697085215 },
+        },
+        {
+            { 629876504002066, 875797994426523, 1680974550469384, 379692973243407, 2080467460645230 },
+            { 1041541771776987, 410986020624753, 1173847847203529, 1599676982141034, 684152561028988 },
+            { 1084836891982052, 405373371974756, 392292573225522, 1228291428535054, 196706224397467 },
+        },
+        {
+            { 2181085219797589, 186467806208455, 1398091257339580, 1543623638852333, 24079936812708 },
+            { 919366765858854, 1265998847343319, 1239257288722888, 846012957753740, 594713398434214 },
+            { 1451708073273912, 640663458576442, 472967005176057, 1940369909273489, 1650816055376110 },
+        },
+        {
+            { 604257425371268, 1647914007806880, 1178627125851434, 1025033951888023, 1528786153297882 },
+            { 1271992142776406, 306128060193141, 1814967755510541, 1676050795259182, 1038924484586542 },
+            { 1406590024268518, 1220852036090080, 364949301397175, 1654716393716139, 143122595639438 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 4
+    {
+        {
+            { 2237039662793603, 2249022333361206, 2058613546633703, 149454094845279, 2215176649164582 },
+            { 79472182719605, 1851130257050174, 1825744808933107, 821667333481068, 781795293511946 },
+            { 755822026485370, 152464789723500, 1178207602290608, 410307889503239, 156581253571278 },
+        },
+        {
+            { 1418185496130297, 484520167728613, 1646737281442950, 1401487684670265, 1349185550126961 },
+            { 1495380034400429, 325049476417173, 46346894893933, 1553408840354856, 828980101835683 },
+            { 1280337889310282, 2070832742866672, 1640940617225222, 2098284908289951, 450929509534434 },
+        },
+        {
+            { 407703353998781, 126572141483652, 286039827513621, 1999255076709338, 2030511179441770 },
+            { 1254958221100483, 1153235960999843, 942907704968834, 637105404087392, 1149293270147267 },
+            { 894249020470196, 400291701616810, 406878712230981, 1599128793487393, 1145868722604026 },
+        },
+        {
+            { 1497955250203334, 110116344653260, 1128535642171976, 1900106496009660, 129792717460909 },
+            { 452487513298665, 1352120549024569, 1173495883910956, 1999111705922009, 367328130454226 },
+            { 1717539401269642, 1475188995688487, 891921989653942, 836824441505699, 1885988485608364 },
+        },
+        {
+            { 1241784121422547, 187337051947583, 1118481812236193, 428747751936362, 30358898927325 },
+            { 2022432361201842, 1088816090685051, 1977843398539868, 1854834215890724, 564238862029357 },
+            { 938868489100585, 1100285072929025, 1017806255688848, 1957262154788833, 152787950560442 },
+        },
+        {
+            { 867319417678923, 620471962942542, 226032203305716, 342001443957629, 1761675818237336 },
+            { 1295072362439987, 931227904689414, 1355731432641687, 922235735834035, 892227229410209 },
+            { 1680989767906154, 535362787031440, 2136691276706570, 1942228485381244, 1267350086882274 },
+        },
+        {
+            { 366018233770527, 432660629755596, 126409707644535, 1973842949591662, 645627343442376 },
+            { 535509430575217, 546885533737322, 1524675609547799, 2138095752851703, 1260738089896827 },
+            { 1159906385590467, 2198530004321610, 714559485023225, 81880727882151, 1484020820037082 },
+        },
+        {
+            { 1377485731340769, 2046328105512000, 1802058637158797, 62146136768173, 1356993908853901 },
+            { 2013612215646735, 1830770575920375, 536135310219832, 609272325580394, 270684344495013 },
+            { 1237542585982777, 2228682050256790, 1385281931622824, 593183794882890, 493654978552689 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1941635877650350, 41136794015779, 802548087270427, 553714331402352, 386035892408446 },
+            { 1253759950575250, 1509487323905258, 578311512025850, 212916427969408, 1753384794452412 },
+            { 1415499622184076, 11739232724558, 1448526577403933, 77973485783393, 148463223858677 },
+        },
+        {
+            { 311441914860102, 648657507285395, 2021653799300721, 1829986640373467, 1684057546885166 },
+            { 1304756256783871, 1600981150400111, 901595917857192, 242747876317930, 1279035873929757 },
+            { 531432570362576, 1071513573823369, 449672118652203, 98547521251379, 260579416510065 },
+        },
+        {
+            { 2098297300858722, 1637995723173513, 2132191683177015, 592134746032938, 1044637126699087 },
+            { 861603135516889, 972543469096648, 1889740426619698, 70421560213036, 2102944079771845 },
+            { 607038018090674, 1768950085932612, 1176147243379098, 1239851308662055, 1164850159859507 },
+        },
+        {
+            { 50302027267574, 423806012475259, 1179614475371999, 273291038306754, 1591101869035053 },
+            { 2041024517366388, 906640306630802, 1870667933915535, 1018654973521110, 670144050027407 },
+            { 67986117053250, 143032219413988, 187059126532888, 1606721935579222, 2108737133289470 },
+        },
+        {
+            { 1710358734492362, 700744440434795, 97008718346940, 1206596703084633, 1537007452608631 },
+            { 1222422916724904, 1472245300303381, 1263783142962994, 1924355287951999, 1022145560776167 },
+            { 63942543002426, 322070337950512, 1601643046070686, 1223905889282175, 1741111665223434 },
+        },
+        {
+            { 608607226436064, 1177142915116464, 893340840255623, 1733521080031483, 935074982514089 },
+            { 812295789681636, 324775898964235, 2192210973050135, 1489710278245695, 1388601324428403 },
+            { 731527977617797, 464892677638406, 850380242165564, 1707297435867315, 797914062581028 },
+        },
+        {
+            { 2200385186612531, 1578280621009878, 1080513122912467, 1819075993402942, 1445221323523098 },
+            { 2229646033936081, 1942975612354649, 213884528061573, 951329811597823, 1522941440963823 },
+            { 1808087344592199, 1917986815291197, 1736625562156353, 1691009053422774, 699554104203468 },
+        },
+        {
+            { 51064528108022, 111517112206598, 1559429527589512, 2124275860379685, 1685170275648173 },
+            { 545023831723124, 1093783076745175, 1713278174184402, 137023744208400, 408433093622657 },
+            { 567087552892581, 1562927351866469, 299640978917608, 868196882482839, 81953139898216 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING <= 2
+    {
+        {
+            { 47341488007760, 1891414891220257, 983894663308928, 176161768286818, 1126261115179708 },
+            { 1694030170963455, 502038567066200, 1691160065225467, 949628319562187, 275110186693066 },
+            { 1124515748676336, 1661673816593408, 1499640319059718, 1584929449166988, 558148594103306 },
+        },
+        {
+            { 1784525599998356, 1619698033617383, 2097300287550715, 258265458103756, 1905684794832758 },
+            { 1288941072872766, 931787902039402, 190731008859042, 2006859954667190, 1005931482221702 },
+            { 1465551264822703, 152905080555927, 680334307368453, 173227184634745, 666407097159852 },
+        },
+        {
+            { 2111017076203943, 1378760485794347, 1248583954016456, 1352289194864422, 1895180776543896 },
+            { 171348223915638, 662766099800389, 462338943760497, 466917763340314, 656911292869115 },
+            { 488623681976577, 866497561541722, 1708105560937768, 1673781214218839, 1506146329818807 },
+        },
+        {
+            { 160425464456957, 950394373239689, 430497123340934, 711676555398832, 320964687779005 },
+            { 988979367990485, 1359729327576302, 1301834257246029, 294141160829308, 29348272277475 },
+            { 1434382743317910, 100082049942065, 221102347892623, 186982837860588, 1305765053501834 },
+        },
+        {
+            { 2205916462268190, 499863829790820, 961960554686616, 158062762756985, 1841471168298305 },
+            { 1191737341426592, 1847042034978363, 1382213545049056, 1039952395710448, 788812858896859 },
+            { 1346965964571152, 1291881610839830, 2142916164336056, 786821641205979, 1571709146321039 },
+        },
+        {
+            { 787164375951248, 202869205373189, 1356590421032140, 1431233331032510, 786341368775957 },
+            { 492448143532951, 304105152670757, 1761767168301056, 233782684697790, 1981295323106089 },
+            { 665807507761866, 1343384868355425, 895831046139653, 439338948736892, 1986828765695105 },
+        },
+        {
+            { 756096210874553, 1721699973539149, 258765301727885, 1390588532210645, 1212530909934781 },
+            { 852891097972275, 1816988871354562, 1543772755726524, 1174710635522444, 202129090724628 },
+            { 1205281565824323, 22430498399418, 992947814485516, 1392458699738672, 688441466734558 },
+        },
+        {
+            { 1050627428414972, 1955849529137135, 2171162376368357, 91745868298214, 447733118757826 },
+            { 1287181461435438, 622722465530711, 880952150571872, 741035693459198, 311565274989772 },
+            { 1003649078149734, 545233927396469, 1849786171789880, 1318943684880434, 280345687170552 },
+        },
+    },
+#endif
+#if ED25519_BASE_SPACING == 1
+    {
+        {
+            { 1650059244213943, 1415687339027798, 1500141786956787, 2204874486713657, 1294277876097258 },
+            { 137033802346169, 2184552721577514, 539064280617532, 2076540099477398, 2066610116555437 },
+            { 1247200432261975, 265507035905438, 1620404126253617, 117362009527087, 1746435297969059 },
+        },
+        {
+            { 1068629703061668, 984762690851450, 1229949103789232, 2110232841828031, 1092532788851750 },
+            { 837136640501665, 1043670615489504, 2155335349713680, 1236566668693657, 1494720534426543 },
+            { 1306097687903586, 1372543655508231, 1658076721821581, 2200003583698537, 780636112677937 },
+        },
+        {
+            { 814536290823781, 63061116467332, 804840198178091, 8292666531281, 2073254466378785 },
+            { 722478309804879, 1188829196206039, 1185414523406556, 1657025426781102, 1841660092890563 },
+            { 479894784370716, 1925880613677947, 2183487522494884, 625094381313712, 854845126872293 },
+        },
+        {
+            { 817093479351430, 1836962122101804, 919916971324812, 476742058422480, 1520644895959803 },
+            { 694018530392140, 2181664308275944, 1008881841276548, 1869175821107034, 1331662548691003 },
+            { 1207982418891449, 1577854720087533, 2009037012572541, 1476807775109585, 764858983320152 },
+        },
+        {
+            { 292623621294190, 1087309087737456, 321655784028745, 859400146466929, 313265906579808 },
+            { 140152580198083, 1925625273063552, 465551876178050, 1812104517839551, 1575877311322463 },
+            { 1960514462005953, 1030291725190195, 357278058611993, 503261352420903, 409647200988996 },
+        },
+        {
+            { 1640564024541742, 1198304966395870, 1372955845260038, 236154098509699, 1964015174577550 },
+            { 1885636610741691, 1508783391782587, 1311104907831964, 1427543553470043, 1292851863616546 },
+            { 1832104727099167, 996069167520846, 1100729754186688, 1771584084767106, 2117261745027080 },
+        },
+        {
+            { 1199122074926019, 270259320717536, 397875262207323, 868065793065420, 1432109594857766 },
+            { 2179220822379819, 1000095666499659, 49992398096602, 1767660763649070, 328419317743688 },
+            { 1875633950147766, 1109790076082089, 897660652998513, 1428078707156757, 908826481148722 },
+        },
+        {
+            { 382218292636378, 253308433944437, 874541765087370, 2016974307899051, 1468999769476078 },
+            { 550413608250370, 875252643681210, 2041453659475649, 2067699249466175, 837158492223667 },
+            { 2013224690617610, 881120726963113, 2087874148443678, 930634847072563, 2100154549645766 },
+        },
+    },
+#endif
+};
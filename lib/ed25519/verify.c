@@ -2,6 +2,7 @@
 #include "sha512.h"
 #include "ge.h"
 #include "sc.h"
+#include <string.h>
 
 static int consttime_equal(const unsigned char *x, const unsigned char *y) {
     unsigned char r = 0;
@@ -44,21 +45,12 @@ static int consttime_equal(const unsigned char *x, const unsigned char *y) {
     return !r;
 }
 
-int ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+static int verify_with_point(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key, const ge_p3 *A, ge_cached Ai[8]) {
     unsigned char h[64];
     unsigned char checker[32];
     sha512_context hash;
-    ge_p3 A;
     ge_p2 R;
 
-    if (signature[63] & 224) {
-        return 0;
-    }
-
-    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
-        return 0;
-    }
-
     sha512_init(&hash);
     sha512_update(&hash, signature, 32);
     sha512_update(&hash, public_key, 32);
@@ -66,7 +58,7 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
     sha512_final(&hash, h);
     
     sc_reduce(h);
-    ge_double_scalarmult_vartime(&R, h, &A, signature + 32);
+    ge_double_scalarmult_vartime_table(&R, h, A, Ai, signature + 32);
     ge_tobytes(checker, &R);
 
     if (!consttime_equal(checker, signature)) {
@@ -75,3 +67,110 @@ int ed25519_verify(const unsigned char *signature, const unsigned char *message,
 
     return 1;
 }
+
+int ed25519_verify(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    ge_p3 A;
+    ge_cached Ai[8];
+
+    if (!sc_is_canonical(signature + 32)) {
+        return 0;
+    }
+
+    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
+        return 0;
+    }
+
+    return verify_with_point(signature, message, message_len, public_key, &A, Ai);
+}
+
+/*
+    Decompressing the public key (ge_frombytes_negate_vartime: a square root, ie. an exponentiation) is a large
+    part of each verify, and the same few signers account for most of what a node checks, so the most recently used
+    decompressed keys can be kept (196 bytes each), least recently used evicted. A key is only cached once a
+    signature by it has verified, so junk can't flush the keys of real signers.
+    The odd multiples table of the key (1280 bytes) is built in a static scratch area too, rather than on the stack,
+    so ed25519_verify_cached() isn't reentrant.
+    Opt-in: without ED25519_KEY_CACHE_SIZE, ed25519_verify_cached() is just ed25519_verify().
+*/
+#ifndef ED25519_KEY_CACHE_SIZE
+    #define ED25519_KEY_CACHE_SIZE 0
+#endif
+
+#if ED25519_KEY_CACHE_SIZE > 0
+
+typedef struct {
+    unsigned char public_key[32];
+    ge_p3 A;                    /* negated, as from ge_frombytes_negate_vartime() */
+    uint32_t last_used;         /* 0 = empty */
+} key_cache_entry;
+
+static key_cache_entry key_cache[ED25519_KEY_CACHE_SIZE];
+static uint32_t key_cache_counter = 0;
+static ge_cached key_table[8];
+
+static const ge_p3 *find_key(const unsigned char *public_key) {
+    key_cache_entry *e;
+    int i;
+
+    for (i = 0; i < ED25519_KEY_CACHE_SIZE; i++) {
+        e = &key_cache[i];
+        if (e->last_used != 0 && memcmp(e->public_key, public_key, 32) == 0) {
+            e->last_used = ++key_cache_counter;
+            return &e->A;
+        }
+    }
+    return NULL;
+}
+
+static void remember_key(const unsigned char *public_key, const ge_p3 *A) {
+    key_cache_entry *lru = &key_cache[0];
+    int i;
+
+    for (i = 1; i < ED25519_KEY_CACHE_SIZE; i++) {
+        if (key_cache[i].last_used < lru->last_used) {
+            lru = &key_cache[i];
+        }
+    }
+    memcpy(lru->public_key, public_key, 32);
+    lru->A = *A;
+    lru->last_used = ++key_cache_counter;
+}
+
+int ed25519_verify_cached(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    const ge_p3 *cached;
+    ge_p3 A;
+
+    if (!sc_is_canonical(signature + 32)) {
+        return 0;
+    }
+
+    cached = find_key(public_key);
+    if (cached != NULL) {
+        return verify_with_point(signature, message, message_len, public_key, cached, key_table);
+    }
+
+    if (ge_frombytes_negate_vartime(&A, public_key) != 0) {
+        return 0;
+    }
+    if (!verify_with_point(signature, message, message_len, public_key, &A, key_table)) {
+        return 0;
+    }
+    remember_key(public_key, &A);
+    return 1;
+}
+
+void ed25519_verify_cache_clear(void) {
+    memset(key_cache, 0, sizeof(key_cache));
+    key_cache_counter = 0;
+}
+
+#else
+
+int ed25519_verify_cached(const unsigned char *signature, const unsigned char *message, size_t message_len, const unsigned char *public_key) {
+    return ed25519_verify(signature, message, message_len, public_key);
+}
+
+void ed25519_verify_cache_clear(void) {
+}
+
+#endif
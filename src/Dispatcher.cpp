@@ -12,6 +12,12 @@ namespace mesh {
 #define MIN_TX_BUDGET_RESERVE_MS   100    // min budget (ms) required before allowing next TX
 #define MIN_TX_BUDGET_AIRTIME_DIV  2      // require at least 1/N of estimated airtime as budget before TX
 
+#ifdef NODE_ID
+  #define TX_PREFIX_LEN   1   // sender's NODE_ID
+#else
+  #define TX_PREFIX_LEN   0
+#endif
+
 #ifndef NOISE_FLOOR_CALIB_INTERVAL
   #define NOISE_FLOOR_CALIB_INTERVAL   2000     // 2 seconds
 #endif
@@ -192,6 +198,7 @@ void Dispatcher::checkRecv() {
             pkt = NULL;  
           } else {
             memcpy(pkt->payload, &raw[i], pkt->payload_len);
+            pkt->invalidateHash();
 
             pkt->_snr = _radio->getLastSNR() * 4.0f;
             score = _radio->packetScore(_radio->getLastSNR(), len);
@@ -211,10 +218,8 @@ void Dispatcher::checkRecv() {
             pkt->getRawLength(), pkt->getPayloadType(), pkt->isRouteDirect() ? "D" : "F", pkt->payload_len,
             (int)pkt->getSNR(), (int)_radio->getLastRSSI(), (int)(score*1000), air_time);
 
-    static uint8_t packet_hash[MAX_HASH_SIZE];
-    pkt->calculatePacketHash(packet_hash);
     Serial.print(" hash=");
-    mesh::Utils::printHex(Serial, packet_hash, MAX_HASH_SIZE);
+    mesh::Utils::printHex(Serial, pkt->getPacketHash(), MAX_HASH_SIZE);
 
     if (pkt->getPayloadType() == PAYLOAD_TYPE_PATH || pkt->getPayloadType() == PAYLOAD_TYPE_REQ
         || pkt->getPayloadType() == PAYLOAD_TYPE_RESPONSE || pkt->getPayloadType() == PAYLOAD_TYPE_TXT_MSG) {
@@ -294,26 +299,21 @@ void Dispatcher::checkSend() {
 
   outbound = _mgr->getNextOutbound(_ms->getMillis());
   if (outbound) {
-    int len = 0;
-    uint8_t raw[MAX_TRANS_UNIT];
-
-#ifdef NODE_ID
-    raw[len++] = NODE_ID;
-#endif
-    raw[len++] = outbound->header;
-    if (outbound->hasTransportCodes()) {
-      memcpy(&raw[len], &outbound->transport_codes[0], 2); len += 2;
-      memcpy(&raw[len], &outbound->transport_codes[1], 2); len += 2;
-    }
-    raw[len++] = outbound->path_len;
-    memcpy(&raw[len], outbound->path, outbound->path_len); len += outbound->path_len;
-
-    if (len + outbound->payload_len > MAX_TRANS_UNIT) {
-      MESH_DEBUG_PRINTLN("%s Dispatcher::checkSend(): FATAL: Invalid packet queued... too long, len=%d", getLogDateTime(), len + outbound->payload_len);
+    if (TX_PREFIX_LEN + outbound->getRawLength() > MAX_TRANS_UNIT) {
+      MESH_DEBUG_PRINTLN("%s Dispatcher::checkSend(): FATAL: Invalid packet queued... too long, len=%d", getLogDateTime(), TX_PREFIX_LEN + outbound->getRawLength());
       _mgr->free(outbound);
       outbound = NULL;
     } else {
-      memcpy(&raw[len], outbound->payload, outbound->payload_len); len += outbound->payload_len;
+      int len;
+      uint8_t tmp[MAX_TRANS_UNIT];
+      uint8_t* raw = outbound->prepareWireImage(TX_PREFIX_LEN, len);   // transmit straight from the Packet
+      if (raw == NULL) {   // long path, no room to build image in place
+        raw = tmp;
+        len = TX_PREFIX_LEN + outbound->writeTo(&tmp[TX_PREFIX_LEN]);
+      }
+#ifdef NODE_ID
+      raw[0] = NODE_ID;
+#endif
 
       uint32_t max_airtime = _radio->getEstAirtimeFor(len)*3/2;
       outbound_start = _ms->getMillis();
@@ -351,6 +351,7 @@ Packet* Dispatcher::obtainNewPacket() {
   } else {
     pkt->payload_len = pkt->path_len = 0;
     pkt->_snr = 0;
+    pkt->invalidateHash();
   }
   return pkt;
 }
@@ -368,6 +369,15 @@ void Dispatcher::sendPacket(Packet* packet, uint8_t priority, uint32_t delay_mil
   }
 }
 
+int Dispatcher::getNextDueIn() const {
+  uint32_t now = _ms->getMillis();
+  int out_due = _mgr->getOutboundDueIn(now);
+  int in_due = _mgr->getInboundDueIn(now);
+  if (out_due < 0) return in_due;
+  if (in_due < 0) return out_due;
+  return out_due < in_due ? out_due : in_due;
+}
+
 // Utility function -- handles the case where millis() wraps around back to zero
 //   2's complement arithmetic will handle any unsigned subtraction up to HALF the word size (32-bits in this case)
 bool Dispatcher::millisHasNowPassed(unsigned long timestamp) const {
@@ -89,12 +89,15 @@ public:
 
   virtual void queueOutbound(Packet* packet, uint8_t priority, uint32_t scheduled_for) = 0;
   virtual Packet* getNextOutbound(uint32_t now) = 0;    // by priority
-  virtual int getOutboundCount(uint32_t now) const = 0;
+  virtual int getOutboundCount(uint32_t now) const = 0;   // due at 'now'
+  virtual int getOutboundTotal() const = 0;    // everything queued, due or not
+  virtual int getOutboundDueIn(uint32_t now) const = 0;   // millis until the next is due (0 if one is), -1 if none
   virtual int getFreeCount() const = 0;
   virtual Packet* getOutboundByIdx(int i) = 0;
   virtual Packet* removeOutboundByIdx(int i) = 0;
   virtual void queueInbound(Packet* packet, uint32_t scheduled_for) = 0;
   virtual Packet* getNextInbound(uint32_t now) = 0;
+  virtual int getInboundDueIn(uint32_t now) const = 0;   // as getOutboundDueIn()
 };
 
 typedef uint32_t  DispatcherAction;
@@ -183,7 +186,9 @@ public:
   uint32_t getNumSentDirect() const { return n_sent_direct; }
   uint32_t getNumRecvFlood() const { return n_recv_flood; }
   uint32_t getNumRecvDirect() const { return n_recv_direct; }
-  void resetStats() {
+  uint16_t getErrFlags() const { return _err_flags; }
+  int getNextDueIn() const;   // millis until a queued packet (inbound or outbound) is due, 0 if one is, -1 if none
+  virtual void resetStats() {
     n_sent_flood = n_sent_direct = n_recv_flood = n_recv_direct = 0;
     _err_flags = 0;
   }
@@ -140,4 +140,53 @@ void LocalIdentity::calcSharedSecret(uint8_t* secret, const uint8_t* other_pub_k
   ed25519_key_exchange(secret, other_pub_key, prv_key);
 }
 
+SharedSecretCache::SharedSecretCache() {
+  memset(_self_pub_key, 0, sizeof(_self_pub_key));
+  _hits = _misses = 0;
+  clear();
+}
+
+void SharedSecretCache::clear() {
+  memset(_entries, 0, sizeof(_entries));   // zeroise secrets
+  _counter = 0;
+}
+
+bool SharedSecretCache::get(const LocalIdentity& self, const uint8_t* other_pub_key, uint8_t* secret) {
+  if (memcmp(self.pub_key, _self_pub_key, PUB_KEY_SIZE) != 0) {   // our identity has changed
+    clear();
+    memcpy(_self_pub_key, self.pub_key, PUB_KEY_SIZE);
+  }
+  for (int i = 0; i < SHARED_SECRET_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->last_used != 0 && memcmp(e->pub_key, other_pub_key, PUB_KEY_SIZE) == 0) {
+      e->last_used = ++_counter;
+      memcpy(secret, e->secret, PUB_KEY_SIZE);
+      _hits++;
+      return true;
+    }
+  }
+  _misses++;
+  return false;
+}
+
+void SharedSecretCache::put(const LocalIdentity& self, const uint8_t* other_pub_key, const uint8_t* secret) {
+  if (memcmp(self.pub_key, _self_pub_key, PUB_KEY_SIZE) != 0) {
+    clear();
+    memcpy(_self_pub_key, self.pub_key, PUB_KEY_SIZE);
+  }
+  auto lru = &_entries[0];
+  for (int i = 0; i < SHARED_SECRET_CACHE_SIZE; i++) {
+    auto e = &_entries[i];
+    if (e->last_used != 0 && memcmp(e->pub_key, other_pub_key, PUB_KEY_SIZE) == 0) {
+      lru = e;   // already present, just refresh
+      break;
+    }
+    if (e->last_used < lru->last_used) lru = e;
+  }
+  memset(lru, 0, sizeof(*lru));   // zeroise evicted secret
+  memcpy(lru->pub_key, other_pub_key, PUB_KEY_SIZE);
+  memcpy(lru->secret, secret, PUB_KEY_SIZE);
+  lru->last_used = ++_counter;
+}
+
 }
\ No newline at end of file
@@ -90,5 +90,45 @@ public:
   void readFrom(const uint8_t* src, size_t len);
 };
 
+#ifndef SHARED_SECRET_CACHE_SIZE
+  #define SHARED_SECRET_CACHE_SIZE  16
+#endif
+
+/**
+ * \brief  A small LRU cache of ECDH shared secrets (LocalIdentity::calcSharedSecret() results), keyed by the other party's
+ *         public key. For senders which aren't in any peer table (eg. anonymous requests, logins), so that retries and
+ *         repeat requests don't each need a scalar multiplication. Evicted entries are zeroed.
+*/
+class SharedSecretCache {
+  struct Entry {
+    uint8_t pub_key[PUB_KEY_SIZE];
+    uint8_t secret[PUB_KEY_SIZE];
+    uint32_t last_used;   // 0 = empty
+  };
+  Entry _entries[SHARED_SECRET_CACHE_SIZE];
+  uint8_t _self_pub_key[PUB_KEY_SIZE];   // the LocalIdentity which the cached secrets are for
+  uint32_t _counter, _hits, _misses;
+
+public:
+  SharedSecretCache();
+
+  /**
+   * \brief  looks up the shared secret between 'self' and 'other_pub_key'
+   * \returns  true if found, and copied to 'secret' (PUB_KEY_SIZE bytes)
+  */
+  bool get(const LocalIdentity& self, const uint8_t* other_pub_key, uint8_t* secret);
+
+  /**
+   * \brief  adds a secret (eg. once it has been shown to decrypt something), evicting least recently used entry if full
+  */
+  void put(const LocalIdentity& self, const uint8_t* other_pub_key, const uint8_t* secret);
+
+  void clear();
+
+  uint32_t getNumHits() const { return _hits; }
+  uint32_t getNumMisses() const { return _misses; }
+  void resetStats() { _hits = _misses = 0; }
+};
+
 }
 
@@ -157,50 +157,61 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
 
             // Mask out route type bits — they are set after encryption and vary per hop.
             uint8_t assoc[3] = { (uint8_t)(pkt->header & ~PH_ROUTE_MASK), dest_hash, src_hash };
-            int len = 0;
-            bool decoded_aead = false;
-            bool decoded_session = false;
 
-            // Session key decode path: try session key(s) first if available
+            // keys/modes to try, in default order
+            uint8_t modes[4];
+            const uint8_t* keys[4];
+            int num_modes = 0;
             const uint8_t* sess_key = getPeerSessionKey(j);
             if (sess_key) {
-              len = Utils::aeadDecrypt(sess_key, data, macAndData, macAndDataLen, assoc, 3, dest_hash, src_hash);
-              if (len > 0) {
-                decoded_session = true;
-                decoded_aead = true;
-              } else {
-                // Try prev_session_key (dual-decode window)
-                const uint8_t* prev_key = getPeerPrevSessionKey(j);
-                if (prev_key) {
-                  len = Utils::aeadDecrypt(prev_key, data, macAndData, macAndDataLen, assoc, 3, dest_hash, src_hash);
-                  if (len > 0) {
-                    decoded_session = true;
-                    decoded_aead = true;
-                  }
-                }
-              }
-              if (!decoded_session) {
-                // Session key failed — try static ECDH, then ECB
-                len = Utils::aeadDecrypt(secret, data, macAndData, macAndDataLen, assoc, 3, dest_hash, src_hash);
-                if (len > 0) {
-                  decoded_aead = true;
-                } else {
-                  len = Utils::MACThenDecrypt(secret, data, macAndData, macAndDataLen);
-                }
-              }
+              // Session key decode path: try session key(s) first, then static ECDH, then ECB
+              modes[num_modes] = DECODE_MODE_SESSION; keys[num_modes++] = sess_key;
+              const uint8_t* prev_key = getPeerPrevSessionKey(j);   // dual-decode window
+              if (prev_key) { modes[num_modes] = DECODE_MODE_PREV_SESSION; keys[num_modes++] = prev_key; }
+              modes[num_modes] = DECODE_MODE_AEAD; keys[num_modes++] = secret;
+              modes[num_modes] = DECODE_MODE_ECB; keys[num_modes++] = secret;
             } else if (getPeerFlags(j) & CONTACT_FLAG_AEAD) {
               // No session key — standard AEAD-first decode for AEAD-capable peers
-              len = Utils::aeadDecrypt(secret, data, macAndData, macAndDataLen, assoc, 3, dest_hash, src_hash);
-              if (len > 0) decoded_aead = true;
-              else len = Utils::MACThenDecrypt(secret, data, macAndData, macAndDataLen);
+              modes[num_modes] = DECODE_MODE_AEAD; keys[num_modes++] = secret;
+              modes[num_modes] = DECODE_MODE_ECB; keys[num_modes++] = secret;
             } else {
               // Legacy ECB-first decode
-              len = Utils::MACThenDecrypt(secret, data, macAndData, macAndDataLen);
-              if (len <= 0) {
-                len = Utils::aeadDecrypt(secret, data, macAndData, macAndDataLen, assoc, 3, dest_hash, src_hash);
-                if (len > 0) decoded_aead = true;
+              modes[num_modes] = DECODE_MODE_ECB; keys[num_modes++] = secret;
+              modes[num_modes] = DECODE_MODE_AEAD; keys[num_modes++] = secret;
+            }
+
+            // ...but whichever last worked for this peer goes first, within its tier (the AEAD modes, then ECB).
+            // The tiers are never reordered: ECB's 2-byte MAC must not be tried ahead of AEAD for a peer which has it.
+            uint8_t hint = getPeerDecodeHint(j);
+            for (int k = 1; k < num_modes; k++) {
+              if (modes[k] == hint) {
+                int first = 0;
+                while ((modes[first] == DECODE_MODE_ECB) != (hint == DECODE_MODE_ECB)) first++;
+                const uint8_t* key = keys[k];
+                for (; k > first; k--) { modes[k] = modes[k - 1]; keys[k] = keys[k - 1]; }
+                modes[first] = hint; keys[first] = key;
+                break;
+              }
+            }
+
+            int len = 0;
+            uint8_t mode = DECODE_MODE_NONE;
+            for (int k = 0; k < num_modes && len <= 0; k++) {
+              n_decrypt_trials++;
+              if (modes[k] == DECODE_MODE_ECB) {
+                len = Utils::MACThenDecrypt(keys[k], data, macAndData, macAndDataLen);
+              } else {
+                len = Utils::aeadDecrypt(keys[k], data, macAndData, macAndDataLen, assoc, 3, dest_hash, src_hash);
+              }
+              if (len > 0) {
+                mode = modes[k];
+              } else {
+                n_decrypt_fails++;
               }
             }
+            bool decoded_session = (mode == DECODE_MODE_SESSION || mode == DECODE_MODE_PREV_SESSION);
+            bool decoded_aead = decoded_session || mode == DECODE_MODE_AEAD;
+            if (len > 0 && mode != hint) setPeerDecodeHint(j, mode);
             if (len > 0) {  // success!
               if (decoded_session) onSessionKeyDecryptSuccess(j);
               else if (decoded_aead) onPeerAeadDetected(j);
@@ -252,19 +263,25 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
           Identity sender(sender_pub_key);
 
           uint8_t secret[PUB_KEY_SIZE];
-          self_id.calcSharedSecret(secret, sender);
+          bool cached = _anon_secrets.get(self_id, sender_pub_key, secret);
+          if (!cached) self_id.calcSharedSecret(secret, sender);
 
           uint8_t data[MAX_PACKET_PAYLOAD];
           int macAndDataLen = pkt->payload_len - i;
 
           // Try ECB first (Phase 1), then AEAD-4 fallback.
           // Phase 2 MUST swap to AEAD-first (see peer message comment above).
+          n_decrypt_trials++;
           int len = Utils::MACThenDecrypt(secret, data, macAndData, macAndDataLen);
           if (len <= 0) {
+            n_decrypt_fails++;
+            n_decrypt_trials++;
             uint8_t assoc[2] = { (uint8_t)(pkt->header & ~PH_ROUTE_MASK), dest_hash };
             len = Utils::aeadDecrypt(secret, data, macAndData, macAndDataLen, assoc, 2, dest_hash, 0);
+            if (len <= 0) n_decrypt_fails++;
           }
           if (len > 0) {  // success!
+            if (!cached) _anon_secrets.put(self_id, sender_pub_key, secret);   // only once proven, so junk can't evict real senders
             onAnonDataRecv(pkt, secret, sender, data, len);
             pkt->markDoNotRetransmit();
           }
@@ -295,10 +312,26 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
           // Note: group channels share a key, so nonce collisions across senders can leak
           // P1 XOR P2 for colliding message pairs (no key recovery). Bounded risk, mainly
           // worthwhile for public/hashtag channels where the PSK is already widely known.
-          int len = Utils::MACThenDecrypt(channels[j].secret, data, macAndData, macAndDataLen);
-          if (len <= 0) {
-            uint8_t assoc[2] = { (uint8_t)(pkt->header & ~PH_ROUTE_MASK), channel_hash };
-            len = Utils::aeadDecrypt(channels[j].secret, data, macAndData, macAndDataLen, assoc, 2, channel_hash, 0);
+          // (unless AEAD last worked for this channel hash, then that first)
+          uint8_t assoc[2] = { (uint8_t)(pkt->header & ~PH_ROUTE_MASK), channel_hash };
+          uint8_t hint_mask = 1 << (channel_hash & 7);
+          bool aead_first = (_channel_aead_hints[channel_hash >> 3] & hint_mask) != 0;
+          int len = 0;
+          for (int k = 0; k < 2 && len <= 0; k++) {
+            n_decrypt_trials++;
+            bool aead = (k == 0) == aead_first;
+            if (aead) {
+              len = Utils::aeadDecrypt(channels[j].secret, data, macAndData, macAndDataLen, assoc, 2, channel_hash, 0);
+            } else {
+              len = Utils::MACThenDecrypt(channels[j].secret, data, macAndData, macAndDataLen);
+            }
+            if (len <= 0) {
+              n_decrypt_fails++;
+            } else if (aead) {
+              _channel_aead_hints[channel_hash >> 3] |= hint_mask;
+            } else {
+              _channel_aead_hints[channel_hash >> 3] &= ~hint_mask;
+            }
           }
           if (len > 0) {  // success!
             onGroupDataRecv(pkt, pkt->getPayloadType(), channels[j], data, len);
@@ -396,15 +429,7 @@ DispatcherAction Mesh::onRecvPacket(Packet* pkt) {
 void Mesh::removeSelfFromPath(Packet* pkt) {
   // remove our hash from 'path'
   pkt->path_len -= PATH_HASH_SIZE;
-#if 0
-  memcpy(pkt->path, &pkt->path[PATH_HASH_SIZE], pkt->path_len);
-#elif PATH_HASH_SIZE == 1
-  for (int k = 0; k < pkt->path_len; k++) {  // shuffle bytes by 1
-    pkt->path[k] = pkt->path[k + 1];
-  }
-#else
-  #error "need path remove impl"
-#endif
+  memmove(pkt->path, &pkt->path[PATH_HASH_SIZE], pkt->path_len);
 }
 
 DispatcherAction Mesh::routeRecvPacket(Packet* packet) {
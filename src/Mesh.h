@@ -10,6 +10,13 @@ public:
   uint8_t secret[PUB_KEY_SIZE];
 };
 
+// how a peer's packet was decrypted, see Mesh::getPeerDecodeHint()
+#define DECODE_MODE_NONE           0
+#define DECODE_MODE_SESSION        1   // current session key, AEAD
+#define DECODE_MODE_PREV_SESSION   2   // previous session key, AEAD (dual-decode window)
+#define DECODE_MODE_AEAD           3   // static ECDH secret, AEAD
+#define DECODE_MODE_ECB            4   // static ECDH secret, legacy ECB + HMAC
+
 /**
  * An abstraction of the data tables needed to be maintained
 */
@@ -27,6 +34,9 @@ class Mesh : public Dispatcher {
   RTCClock* _rtc;
   RNG* _rng;
   MeshTables* _tables;
+  uint32_t n_decrypt_trials, n_decrypt_fails;
+  SharedSecretCache _anon_secrets;   // for ANON_REQ senders
+  uint8_t _channel_aead_hints[256/8];   // bit per channel hash: AEAD last worked, so try it before ECB
 
   void removeSelfFromPath(Packet* packet);
   void routeDirectRecvAcks(Packet* packet, uint32_t delay_millis);
@@ -90,6 +100,12 @@ protected:
   virtual const uint8_t* getPeerSessionKey(int peer_idx) { return NULL; }
   virtual const uint8_t* getPeerPrevSessionKey(int peer_idx) { return NULL; }
   virtual void onSessionKeyDecryptSuccess(int peer_idx) { }
+
+  /**
+   * \returns  the DECODE_MODE_ which last decrypted a packet from this peer (tried first, within its tier), or DECODE_MODE_NONE
+   */
+  virtual uint8_t getPeerDecodeHint(int peer_idx) { return DECODE_MODE_NONE; }
+  virtual void setPeerDecodeHint(int peer_idx, uint8_t mode) { }
   // Encryption key/nonce for outgoing messages to peer (session key with static ECDH fallback)
   virtual const uint8_t* getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) { return static_secret; }
   virtual uint16_t getPeerEncryptionNonce(int peer_idx) { return getPeerNextAeadNonce(peer_idx); }
@@ -179,6 +195,8 @@ protected:
   Mesh(Radio& radio, MillisecondClock& ms, RNG& rng, RTCClock& rtc, PacketManager& mgr, MeshTables& tables)
     : Dispatcher(radio, ms, mgr), _rng(&rng), _rtc(&rtc), _tables(&tables)
   {
+    n_decrypt_trials = n_decrypt_fails = 0;
+    memset(_channel_aead_hints, 0, sizeof(_channel_aead_hints));
   }
 
   MeshTables* getTables() const { return _tables; }
@@ -192,6 +210,20 @@ public:
   RNG* getRNG() const { return _rng; }
   RTCClock* getRTCClock() const { return _rtc; }
 
+  /**
+   * \brief  stats for decrypting incoming peer, anon and group packets. Each key/mode tried is a 'trial', and each that didn't
+   *         decrypt (the expected outcome for packets meant for others with a colliding hash) is a 'fail'.
+   */
+  uint32_t getNumDecryptTrials() const { return n_decrypt_trials; }
+  uint32_t getNumDecryptFails() const { return n_decrypt_fails; }
+  uint32_t getNumAnonSecretHits() const { return _anon_secrets.getNumHits(); }
+  uint32_t getNumAnonSecretMisses() const { return _anon_secrets.getNumMisses(); }
+  void resetStats() override {
+    Dispatcher::resetStats();
+    n_decrypt_trials = n_decrypt_fails = 0;
+    _anon_secrets.resetStats();
+  }
+
   Packet* createAdvert(const LocalIdentity& id, const uint8_t* app_data=NULL, size_t app_data_len=0);
   Packet* createDatagram(uint8_t type, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t len, uint16_t aead_nonce=0);
   Packet* createAnonDatagram(uint8_t type, const LocalIdentity& sender, const Identity& dest, const uint8_t* secret, const uint8_t* data, size_t data_len);
@@ -1,13 +1,19 @@
 #include "Packet.h"
 #include <string.h>
+#include <stddef.h>
+#include <type_traits>
 #include <SHA256.h>
 
 namespace mesh {
 
+static_assert(std::is_standard_layout<Packet>::value, "Packet must be standard-layout, for offsetof() below");
+static_assert(offsetof(Packet, payload) == offsetof(Packet, path) + MAX_PATH_SIZE, "Packet::payload must directly follow Packet::path");
+
 Packet::Packet() {
   header = 0;
   path_len = 0;
   payload_len = 0;
+  invalidateHash();
 }
 
 int Packet::getRawLength() const {
@@ -25,6 +31,17 @@ void Packet::calculatePacketHash(uint8_t* hash) const {
   sha.finalize(hash, MAX_HASH_SIZE);
 }
 
+const uint8_t* Packet::getPacketHash() const {
+  uint8_t t = getPayloadType();
+  if (t != _hash_type || payload_len != _hash_payload_len || (t == PAYLOAD_TYPE_TRACE && path_len != _hash_path_len)) {
+    calculatePacketHash(_hash);
+    _hash_type = t;
+    _hash_payload_len = payload_len;
+    _hash_path_len = path_len;
+  }
+  return _hash;
+}
+
 uint8_t Packet::writeTo(uint8_t dest[]) const {
   uint8_t i = 0;
   dest[i++] = header;
@@ -38,8 +55,26 @@ uint8_t Packet::writeTo(uint8_t dest[]) const {
   return i;
 }
 
+uint8_t* Packet::prepareWireImage(int extra, int& len) {
+  int prefix_len = extra + 2 + (hasTransportCodes() ? 4 : 0) + path_len;
+  if (path_len + prefix_len > MAX_PATH_SIZE) return NULL;  // would overlap the path itself
+
+  uint8_t* dest = &path[MAX_PATH_SIZE - prefix_len];   // ie. payload - prefix_len
+  int i = extra;
+  dest[i++] = header;
+  if (hasTransportCodes()) {
+    memcpy(&dest[i], &transport_codes[0], 2); i += 2;
+    memcpy(&dest[i], &transport_codes[1], 2); i += 2;
+  }
+  dest[i++] = path_len;
+  memcpy(&dest[i], path, path_len);
+  len = prefix_len + payload_len;
+  return dest;
+}
+
 bool Packet::readFrom(const uint8_t src[], uint8_t len) {
   if (len < 2) return false;  // minimum: header + path_len
+  invalidateHash();
   uint8_t i = 0;
   header = src[i++];
   if (hasTransportCodes()) {
@@ -38,6 +38,8 @@ namespace mesh {
 
 /**
  * \brief  The fundamental transmission unit.
+ *        NOTE: must stay standard-layout (no private/protected data members, no virtuals), so that the layout of
+ *        'path' and 'payload' is well defined, see prepareWireImage().
 */
 class Packet {
 public:
@@ -47,7 +49,7 @@ public:
   uint16_t payload_len, path_len;
   uint16_t transport_codes[2];
   uint8_t path[MAX_PATH_SIZE];
-  uint8_t payload[MAX_PACKET_PAYLOAD];
+  uint8_t payload[MAX_PACKET_PAYLOAD];   // NOTE: must directly follow 'path', see prepareWireImage()
   int8_t _snr;
 
   /**
@@ -56,6 +58,16 @@ public:
    */
   void calculatePacketHash(uint8_t* dest_hash) const;
 
+  /**
+   * \brief  same hash as calculatePacketHash(), but only calculated once, then cached.
+   *        A change of payload type or length (or path_len, for TRACE) is detected, but any other change
+   *        to 'payload' after the hash has been used needs an invalidateHash().
+   * \returns  the hash (MAX_HASH_SIZE bytes)
+   */
+  const uint8_t* getPacketHash() const;
+
+  void invalidateHash() { _hash_type = 0xFF; }
+
   /**
    * \returns  one of ROUTE_ values
    */
@@ -93,12 +105,26 @@ public:
    */
   uint8_t writeTo(uint8_t dest[]) const;
 
+  /**
+   * \brief  build the wire format in place, by laying out header, transport codes and path in the unused tail of 'path',
+   *        directly in front of 'payload'. Saves copying the payload to transmit it.
+   * \param  extra  number of bytes to leave free at the start of the image, for the caller to fill
+   * \param  len  (OUT) length of the image, including 'extra'
+   * \returns  start of the image, or NULL if the path is too long to leave room (use writeTo() instead)
+   */
+  uint8_t* prepareWireImage(int extra, int& len);
+
   /**
    * \brief  restore this packet from a blob (as created using writeTo())
    * \param  src  (IN) buffer containing blob
    * \param  len  the packet length (as returned by writeTo())
    */
   bool readFrom(const uint8_t src[], uint8_t len);
+
+  // internal: getPacketHash() cache. (public only to keep Packet standard-layout)
+  mutable uint8_t _hash[MAX_HASH_SIZE];
+  mutable uint8_t _hash_type;   // payload type the hash was calculated for, or 0xFF if none
+  mutable uint16_t _hash_payload_len, _hash_path_len;
 };
 
 }
@@ -8,6 +8,14 @@
   #include <Arduino.h>
 #endif
 
+#ifndef HMAC_CACHE_SIZE
+  #define HMAC_CACHE_SIZE   8
+#endif
+
+#ifndef AES_CACHE_SIZE
+  #define AES_CACHE_SIZE   8
+#endif
+
 namespace mesh {
 
 uint32_t RNG::nextInt(uint32_t _min, uint32_t _max) {
@@ -29,12 +37,146 @@ void Utils::sha256(uint8_t *hash, size_t hash_len, const uint8_t* frag1, int fra
   sha.finalize(hash, hash_len);
 }
 
+struct HMACPads {
+  uint8_t key[PUB_KEY_SIZE];
+  uint8_t key_len;      // zero if slot unused
+  uint32_t last_used;
+  SHA256 inner, outer;  // midstates, after hashing the (key ^ ipad) and (key ^ opad) blocks
+};
+
+static HMACPads hmac_cache[HMAC_CACHE_SIZE];
+static uint32_t hmac_cache_tick = 0;
+
+static void clearHMACPads(HMACPads* p) {
+  p->inner.clear();
+  p->outer.clear();
+  memset(p->key, 0, sizeof(p->key));
+  p->key_len = 0;
+  p->last_used = 0;
+}
+
+static const HMACPads* getHMACPads(const uint8_t* key, int key_len) {
+  HMACPads* oldest = &hmac_cache[0];
+  for (int i = 0; i < HMAC_CACHE_SIZE; i++) {
+    auto p = &hmac_cache[i];
+    if (p->key_len == key_len && memcmp(p->key, key, key_len) == 0) {
+      p->last_used = ++hmac_cache_tick;
+      return p;
+    }
+    if (p->key_len == 0 || (oldest->key_len != 0 && p->last_used < oldest->last_used)) oldest = p;
+  }
+
+  // not cached, replace least recently used
+  clearHMACPads(oldest);
+  Utils::hmacPrepare(oldest->inner, oldest->outer, key, key_len);
+  memcpy(oldest->key, key, key_len);
+  oldest->key_len = key_len;
+  oldest->last_used = ++hmac_cache_tick;
+  return oldest;
+}
+
+void Utils::hmacPrepare(SHA256& inner, SHA256& outer, const uint8_t* key, int key_len) {
+  inner.resetHMAC(key, key_len);
+
+  // resetHMAC() hashes (key ^ ipad), so feed it a full block key, pre-XOR'd such that the result is (key ^ opad)
+  uint8_t blk[64];
+  memset(blk, 0, sizeof(blk));
+  memcpy(blk, key, key_len);
+  for (int i = 0; i < sizeof(blk); i++) blk[i] ^= (0x36 ^ 0x5C);
+  outer.resetHMAC(blk, sizeof(blk));
+  memset(blk, 0, sizeof(blk));
+}
+
+void Utils::hmacFinish(uint8_t* mac, size_t mac_len, const SHA256& inner, const SHA256& outer, const uint8_t* msg, int msg_len,
+                       const uint8_t* msg2, int msg2_len) {
+  uint8_t inner_hash[32];
+  SHA256 sha = inner;
+  sha.update(msg, msg_len);
+  if (msg2) sha.update(msg2, msg2_len);
+  sha.finalize(inner_hash, sizeof(inner_hash));
+
+  sha = outer;
+  sha.update(inner_hash, sizeof(inner_hash));
+  sha.finalize(mac, mac_len);
+  memset(inner_hash, 0, sizeof(inner_hash));
+}
+
+void Utils::hmacSHA256(uint8_t* mac, size_t mac_len, const uint8_t* key, int key_len, const uint8_t* msg, int msg_len,
+                       const uint8_t* msg2, int msg2_len) {
+  if (key_len <= 0 || key_len > PUB_KEY_SIZE) {   // not cacheable, do it the long way
+    SHA256 sha;
+    sha.resetHMAC(key, key_len);
+    sha.update(msg, msg_len);
+    if (msg2) sha.update(msg2, msg2_len);
+    sha.finalizeHMAC(key, key_len, mac, mac_len);
+    return;
+  }
+  auto pads = getHMACPads(key, key_len);
+  hmacFinish(mac, mac_len, pads->inner, pads->outer, msg, msg_len, msg2, msg2_len);
+}
+
+struct AESKeySchedule {
+  uint8_t key[CIPHER_KEY_SIZE];
+  bool in_use;
+  uint32_t last_used;
+  AES128 aes;    // NOTE: not copyable (holds a pointer to its own schedule), so only ever handed out by reference
+};
+
+static AESKeySchedule aes_cache[AES_CACHE_SIZE];
+static uint32_t aes_cache_tick = 0;
+
+static void clearKeySchedule(AESKeySchedule* p) {
+  p->aes.clear();
+  memset(p->key, 0, sizeof(p->key));
+  p->in_use = false;
+  p->last_used = 0;
+}
+
+AES128& Utils::getCipher(const uint8_t* shared_secret) {
+  AESKeySchedule* oldest = &aes_cache[0];
+  for (int i = 0; i < AES_CACHE_SIZE; i++) {
+    auto p = &aes_cache[i];
+    if (p->in_use && memcmp(p->key, shared_secret, CIPHER_KEY_SIZE) == 0) {
+      p->last_used = ++aes_cache_tick;
+      return p->aes;
+    }
+    if (!p->in_use || (oldest->in_use && p->last_used < oldest->last_used)) oldest = p;
+  }
+
+  // not cached, replace least recently used
+  clearKeySchedule(oldest);
+  oldest->aes.setKey(shared_secret, CIPHER_KEY_SIZE);
+  memcpy(oldest->key, shared_secret, CIPHER_KEY_SIZE);
+  oldest->in_use = true;
+  oldest->last_used = ++aes_cache_tick;
+  return oldest->aes;
+}
+
+void Utils::forgetKey(const uint8_t* key, int key_len) {
+  for (int i = 0; i < HMAC_CACHE_SIZE; i++) {
+    auto p = &hmac_cache[i];
+    if (p->key_len != 0 && p->key_len == key_len && memcmp(p->key, key, key_len) == 0) clearHMACPads(p);
+  }
+  if (key_len < CIPHER_KEY_SIZE) return;
+  for (int i = 0; i < AES_CACHE_SIZE; i++) {
+    auto p = &aes_cache[i];
+    if (p->in_use && memcmp(p->key, key, CIPHER_KEY_SIZE) == 0) clearKeySchedule(p);
+  }
+}
+
+void Utils::forgetAllKeys() {
+  for (int i = 0; i < HMAC_CACHE_SIZE; i++) clearHMACPads(&hmac_cache[i]);
+  for (int i = 0; i < AES_CACHE_SIZE; i++) clearKeySchedule(&aes_cache[i]);
+}
+
 int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
-  AES128 aes;
+  return decrypt(getCipher(shared_secret), dest, src, src_len);
+}
+
+int Utils::decrypt(AES128& aes, uint8_t* dest, const uint8_t* src, int src_len) {
   uint8_t* dp = dest;
   const uint8_t* sp = src;
 
-  aes.setKey(shared_secret, CIPHER_KEY_SIZE);
   while (sp - src < src_len) {
     aes.decryptBlock(dp, sp);
     dp += 16; sp += 16;
@@ -44,10 +186,12 @@ int Utils::decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* s
 }
 
 int Utils::encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
-  AES128 aes;
+  return encrypt(getCipher(shared_secret), dest, src, src_len);
+}
+
+int Utils::encrypt(AES128& aes, uint8_t* dest, const uint8_t* src, int src_len) {
   uint8_t* dp = dest;
 
-  aes.setKey(shared_secret, CIPHER_KEY_SIZE);
   while (src_len >= 16) {
     aes.encryptBlock(dp, src);
     dp += 16; src += 16; src_len -= 16;
@@ -65,10 +209,7 @@ int Utils::encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* s
 int Utils::encryptThenMAC(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len) {
   int enc_len = encrypt(shared_secret, dest + CIPHER_MAC_SIZE, src, src_len);
 
-  SHA256 sha;
-  sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-  sha.update(dest + CIPHER_MAC_SIZE, enc_len);
-  sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, dest, CIPHER_MAC_SIZE);
+  hmacSHA256(dest, CIPHER_MAC_SIZE, shared_secret, PUB_KEY_SIZE, dest + CIPHER_MAC_SIZE, enc_len);
 
   return CIPHER_MAC_SIZE + enc_len;
 }
@@ -77,12 +218,7 @@ int Utils::MACThenDecrypt(const uint8_t* shared_secret, uint8_t* dest, const uin
   if (src_len <= CIPHER_MAC_SIZE) return 0;  // invalid src bytes
 
   uint8_t hmac[CIPHER_MAC_SIZE];
-  {
-    SHA256 sha;
-    sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-    sha.update(src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
-    sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, hmac, CIPHER_MAC_SIZE);
-  }
+  hmacSHA256(hmac, CIPHER_MAC_SIZE, shared_secret, PUB_KEY_SIZE, src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
   if (secure_compare(hmac, src, CIPHER_MAC_SIZE)) {
     return decrypt(shared_secret, dest, src + CIPHER_MAC_SIZE, src_len - CIPHER_MAC_SIZE);
   }
@@ -138,10 +274,7 @@ int Utils::aeadEncrypt(const uint8_t* shared_secret,
   uint8_t msg_key[32];
   {
     uint8_t kdf_input[AEAD_NONCE_SIZE + 2] = { dest[0], dest[1], dest_hash, src_hash };
-    SHA256 sha;
-    sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-    sha.update(kdf_input, sizeof(kdf_input));
-    sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, msg_key, 32);
+    hmacSHA256(msg_key, 32, shared_secret, PUB_KEY_SIZE, kdf_input, sizeof(kdf_input));
   }
 
   // Build 12-byte IV from on-wire fields
@@ -179,10 +312,7 @@ int Utils::aeadDecrypt(const uint8_t* shared_secret,
   uint8_t msg_key[32];
   {
     uint8_t kdf_input[AEAD_NONCE_SIZE + 2] = { src[0], src[1], dest_hash, src_hash };
-    SHA256 sha;
-    sha.resetHMAC(shared_secret, PUB_KEY_SIZE);
-    sha.update(kdf_input, sizeof(kdf_input));
-    sha.finalizeHMAC(shared_secret, PUB_KEY_SIZE, msg_key, 32);
+    hmacSHA256(msg_key, 32, shared_secret, PUB_KEY_SIZE, kdf_input, sizeof(kdf_input));
   }
 
   // Build 12-byte IV from on-wire fields
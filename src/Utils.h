@@ -4,6 +4,9 @@
 #include <Stream.h>
 #include <string.h>
 
+class AES128;
+class SHA256;
+
 namespace mesh {
 
 class RNG {
@@ -28,12 +31,45 @@ public:
   */
   static void sha256(uint8_t *hash, size_t hash_len, const uint8_t* frag1, int frag1_len, const uint8_t* frag2, int frag2_len);
 
+  /**
+   * \brief  calculates HMAC-SHA256 of 'msg' (followed by 'msg2', if given), keyed by 'key', storing in 'mac' and truncating to 'mac_len' bytes.
+   *         The key's ipad/opad midstates are kept in a small LRU cache (HMAC_CACHE_SIZE), so a recently used key
+   *         costs only the message hashing. (keys longer than PUB_KEY_SIZE are not cached)
+  */
+  static void hmacSHA256(uint8_t* mac, size_t mac_len, const uint8_t* key, int key_len, const uint8_t* msg, int msg_len,
+                         const uint8_t* msg2 = NULL, int msg2_len = 0);
+
+  /**
+   * \brief  for callers which keep their own HMAC-SHA256 keys prepared (more than HMAC_CACHE_SIZE of them): hmacPrepare() sets
+   *         'inner' and 'outer' to the key's midstates, then hmacFinish() calculates the HMAC of a message from those,
+   *         same result as hmacSHA256(). (key_len must be at most 64)
+  */
+  static void hmacPrepare(SHA256& inner, SHA256& outer, const uint8_t* key, int key_len);
+  static void hmacFinish(uint8_t* mac, size_t mac_len, const SHA256& inner, const SHA256& outer, const uint8_t* msg, int msg_len,
+                         const uint8_t* msg2 = NULL, int msg2_len = 0);
+
+  /**
+   * \brief  removes 'key' from the HMAC and AES caches, zeroising its slots. Call when a key is no longer in use
+   *         (eg. contact removed, session key dropped), so that it doesn't linger in RAM until evicted.
+   *         forgetAllKeys() empties both caches (eg. when a whole contacts table is cleared).
+  */
+  static void forgetKey(const uint8_t* key, int key_len);
+  static void forgetAllKeys();
+
+  /**
+   * \brief  Gets an AES128 cipher keyed by 'shared_secret', with key length fixed at CIPHER_KEY_SIZE, for the encrypt()/decrypt()
+   *         overloads below. Expanded key schedules are kept in a small LRU cache (AES_CACHE_SIZE), so a recently used key
+   *         skips the key expansion. The cipher is only valid until the next getCipher() call, which may re-key it.
+  */
+  static AES128& getCipher(const uint8_t* shared_secret);
+
   /**
    * \brief  Encrypts the 'src' bytes using AES128 cipher, using 'shared_secret' as key, with key length fixed at CIPHER_KEY_SIZE.
    *         Final block is padded with zero bytes before encrypt. Result stored in 'dest'.
    * \returns  The length in bytes put into 'dest'. (rounded up to block size)
   */
   static int encrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len);
+  static int encrypt(AES128& cipher, uint8_t* dest, const uint8_t* src, int src_len);
 
   /**
    * \brief  Decrypt the 'src' bytes using AES128 cipher, using 'shared_secret' as key, with key length fixed at CIPHER_KEY_SIZE.
@@ -41,6 +77,7 @@ public:
    * \returns  The length in bytes put into 'dest'. (dest may contain trailing zero bytes in final block)
   */
   static int decrypt(const uint8_t* shared_secret, uint8_t* dest, const uint8_t* src, int src_len);
+  static int decrypt(AES128& cipher, uint8_t* dest, const uint8_t* src, int src_len);
 
   /**
    * \brief  encrypts bytes in src, then calculates MAC on ciphertext, inserting into leading bytes of 'dest'.
@@ -1,6 +1,5 @@
 #include <helpers/BaseChatMesh.h>
 #include <Utils.h>
-#include <SHA256.h>
 #include <ed_25519.h>
 
 #ifndef SERVER_RESPONSE_DELAY
@@ -35,6 +34,7 @@ bool BaseChatMesh::applyLoadedNonce(const uint8_t* pub_key_prefix, uint16_t nonc
 
 void BaseChatMesh::finalizeNonceLoad(bool needs_bump) {
   for (int i = 0; i < num_contacts; i++) {
+    nonce_at_last_persist[i] = contacts[i].aead_nonce;
     if (needs_bump) {
       uint16_t old = contacts[i].aead_nonce;
       contacts[i].aead_nonce += NONCE_BOOT_BUMP;
@@ -43,9 +43,8 @@ void BaseChatMesh::finalizeNonceLoad(bool needs_bump) {
         MESH_DEBUG_PRINTLN("AEAD nonce wrapped after boot bump for peer: %s", contacts[i].name);
       }
     }
-    nonce_at_last_persist[i] = contacts[i].aead_nonce;
   }
-  nonce_dirty = false;
+  nonce_dirty = needs_bump;   // the bumped nonces are yet to be persisted
 
   // Apply boot bump to session key nonces too
   if (needs_bump) {
@@ -145,6 +144,8 @@ ContactInfo* BaseChatMesh::allocateContactSlot() {
     }
     if (oldest_idx >= 0) {
       onContactOverwrite(contacts[oldest_idx].id.pub_key);
+      contacts[oldest_idx].forgetSharedSecret();
+      contact_index.remove(oldest_idx);   // caller re-adds, once new id is set
       return &contacts[oldest_idx];
     }
   }
@@ -176,15 +177,11 @@ void BaseChatMesh::onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id,
     return;
   }
 
-  ContactInfo* from = NULL;
-  for (int i = 0; i < num_contacts; i++) {
-    if (id.matches(contacts[i].id)) {  // is from one of our contacts
-      from = &contacts[i];
-      if (timestamp <= from->last_advert_timestamp) {  // check for replay attacks!!
-        MESH_DEBUG_PRINTLN("onAdvertRecv: Possible replay attack, name: %s", from->name);
-        return;
-      }
-      break;
+  ContactInfo* from = lookupContactByPubKey(id.pub_key, PUB_KEY_SIZE);
+  if (from) {  // is from one of our contacts
+    if (timestamp <= from->last_advert_timestamp) {  // check for replay attacks!!
+      MESH_DEBUG_PRINTLN("onAdvertRecv: Possible replay attack, name: %s", from->name);
+      return;
     }
   }
 
@@ -218,6 +215,7 @@ void BaseChatMesh::onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id,
     }
     
     populateContactFromAdvert(*from, id, parser, timestamp);  // seeds aead_nonce from RNG
+    contact_index.add(from - contacts);
     nonce_at_last_persist[from - contacts] = from->aead_nonce;
     from->sync_since = 0;
     from->shared_secret_valid = false;
@@ -242,13 +240,8 @@ void BaseChatMesh::onAdvertRecv(mesh::Packet* packet, const mesh::Identity& id,
 }
 
 int BaseChatMesh::searchPeersByHash(const uint8_t* hash) {
-  int n = 0;
-  for (int i = 0; i < num_contacts && n < MAX_SEARCH_RESULTS; i++) {
-    if (contacts[i].id.isHashMatch(hash)) {
-      matching_peer_indexes[n++] = i;  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
-    }
-  }
-  return n;
+  // store the INDEXES of matching contacts (for subsequent 'peer' methods)
+  return contact_index.findByHash(hash[0], matching_peer_indexes, MAX_SEARCH_RESULTS);
 }
 
 void BaseChatMesh::getPeerSharedSecret(uint8_t* dest_secret, int peer_idx) {
@@ -456,11 +449,10 @@ void BaseChatMesh::handleReturnPathRetry(const ContactInfo& contact, const uint8
 
 #ifdef MAX_GROUP_CHANNELS
 int BaseChatMesh::searchChannelsByHash(const uint8_t* hash, mesh::GroupChannel dest[], int max_matches) {
-  int n = 0;
-  for (int i = 0; i < MAX_GROUP_CHANNELS && n < max_matches; i++) {
-    if (channels[i].channel.hash[0] == hash[0]) {
-      dest[n++] = channels[i].channel;
-    }
+  int matches[MAX_GROUP_CHANNELS];
+  int n = channel_index.findByHash(hash[0], matches, max_matches < MAX_GROUP_CHANNELS ? max_matches : MAX_GROUP_CHANNELS);
+  for (int i = 0; i < n; i++) {
+    dest[i] = channels[matches[i]].channel;
   }
   return n;
 }
@@ -876,11 +868,8 @@ ContactInfo* BaseChatMesh::searchContactsByPrefix(const char* name_prefix) {
 }
 
 ContactInfo* BaseChatMesh::lookupContactByPubKey(const uint8_t* pub_key, int prefix_len) {
-  for (int i = 0; i < num_contacts; i++) {
-    auto c = &contacts[i];
-    if (memcmp(c->id.pub_key, pub_key, prefix_len) == 0) return c;
-  }
-  return NULL;  // not found
+  int i = contact_index.find(pub_key, prefix_len);
+  return i >= 0 ? &contacts[i] : NULL;  // NULL if not found
 }
 
 bool BaseChatMesh::addContact(const ContactInfo& contact) {
@@ -888,7 +877,9 @@ bool BaseChatMesh::addContact(const ContactInfo& contact) {
   if (dest) {
     int idx = dest - contacts;
     *dest = contact;
+    contact_index.add(idx);
     dest->shared_secret_valid = false; // mark shared_secret as needing calculation
+    dest->decode_hint = DECODE_MODE_NONE;
     dest->aead_nonce = (uint16_t)getRNG()->nextInt(NONCE_INITIAL_MIN, NONCE_INITIAL_MAX + 1);
     nonce_at_last_persist[idx] = dest->aead_nonce;
     return true;  // success
@@ -897,15 +888,14 @@ bool BaseChatMesh::addContact(const ContactInfo& contact) {
 }
 
 bool BaseChatMesh::removeContact(ContactInfo& contact) {
-  int idx = 0;
-  while (idx < num_contacts && !contacts[idx].id.matches(contact.id)) {
-    idx++;
-  }
-  if (idx >= num_contacts) return false;   // not found
+  int idx = contact_index.find(contact.id.pub_key, PUB_KEY_SIZE);
+  if (idx < 0) return false;   // not found
 
   removeSessionKey(contact.id.pub_key);  // also remove session key if any
+  contacts[idx].forgetSharedSecret();
 
   // remove from contacts array and parallel nonce tracking
+  contact_index.erase(idx);
   num_contacts--;
   while (idx < num_contacts) {
     contacts[idx] = contacts[idx + 1];
@@ -926,7 +916,9 @@ ChannelDetails* BaseChatMesh::addChannel(const char* name, const char* psk_base6
     memset(dest->channel.secret, 0, sizeof(dest->channel.secret));
     int len = decode_base64((unsigned char *) psk_base64, strlen(psk_base64), dest->channel.secret);
     if (len == 32 || len == 16) {
+      channel_index.remove(num_channels);
       mesh::Utils::sha256(dest->channel.hash, sizeof(dest->channel.hash), dest->channel.secret, len);
+      channel_index.add(num_channels);
       StrHelper::strncpy(dest->name, name, sizeof(dest->name));
       num_channels++;
       return dest;
@@ -945,12 +937,17 @@ bool BaseChatMesh::setChannel(int idx, const ChannelDetails& src) {
   static uint8_t zeroes[] = { 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
 
   if (idx >= 0 && idx < MAX_GROUP_CHANNELS) {
+    channel_index.remove(idx);
+    if (memcmp(channels[idx].channel.secret, src.channel.secret, sizeof(src.channel.secret)) != 0) {
+      mesh::Utils::forgetKey(channels[idx].channel.secret, PUB_KEY_SIZE);   // old key is no longer used
+    }
     channels[idx] = src;
     if (memcmp(&src.channel.secret[16], zeroes, 16) == 0) {
       mesh::Utils::sha256(channels[idx].channel.hash, sizeof(channels[idx].channel.hash), src.channel.secret, 16);  // 128-bit key
     } else {
       mesh::Utils::sha256(channels[idx].channel.hash, sizeof(channels[idx].channel.hash), src.channel.secret, 32);  // 256-bit key
     }
+    channel_index.add(idx);
     return true;
   }
   return false;
@@ -1208,12 +1205,7 @@ bool BaseChatMesh::handleSessionKeyResponse(ContactInfo& contact, const uint8_t*
   // Derive session_key = HMAC-SHA256(static_shared_secret, ephemeral_secret)
   const uint8_t* static_secret = contact.getSharedSecret(self_id);
   uint8_t new_session_key[SESSION_KEY_SIZE];
-  {
-    SHA256 sha;
-    sha.resetHMAC(static_secret, PUB_KEY_SIZE);
-    sha.update(ephemeral_secret, PUB_KEY_SIZE);
-    sha.finalizeHMAC(static_secret, PUB_KEY_SIZE, new_session_key, SESSION_KEY_SIZE);
-  }
+  mesh::Utils::hmacSHA256(new_session_key, SESSION_KEY_SIZE, static_secret, PUB_KEY_SIZE, ephemeral_secret, PUB_KEY_SIZE);
   memset(ephemeral_secret, 0, PUB_KEY_SIZE);
 
   // Activate session key
@@ -1247,12 +1239,7 @@ uint8_t BaseChatMesh::handleIncomingSessionKeyInit(ContactInfo& from, const uint
   // 3. Derive session_key = HMAC-SHA256(static_shared_secret, ephemeral_secret)
   const uint8_t* static_secret = from.getSharedSecret(self_id);
   uint8_t new_session_key[SESSION_KEY_SIZE];
-  {
-    SHA256 sha;
-    sha.resetHMAC(static_secret, PUB_KEY_SIZE);
-    sha.update(ephemeral_secret, PUB_KEY_SIZE);
-    sha.finalizeHMAC(static_secret, PUB_KEY_SIZE, new_session_key, SESSION_KEY_SIZE);
-  }
+  mesh::Utils::hmacSHA256(new_session_key, SESSION_KEY_SIZE, static_secret, PUB_KEY_SIZE, ephemeral_secret, PUB_KEY_SIZE);
   memset(ephemeral_secret, 0, PUB_KEY_SIZE);
 
   // 4. Store in pool (dual-decode: new key active, old key still valid)
@@ -1346,6 +1333,21 @@ const uint8_t* BaseChatMesh::getPeerPrevSessionKey(int peer_idx) {
   return nullptr;
 }
 
+uint8_t BaseChatMesh::getPeerDecodeHint(int peer_idx) {
+  int i = matching_peer_indexes[peer_idx];
+  if (i >= 0 && i < num_contacts) {
+    return contacts[i].decode_hint;
+  }
+  return DECODE_MODE_NONE;
+}
+
+void BaseChatMesh::setPeerDecodeHint(int peer_idx, uint8_t mode) {
+  int i = matching_peer_indexes[peer_idx];
+  if (i >= 0 && i < num_contacts) {
+    contacts[i].decode_hint = mode;
+  }
+}
+
 void BaseChatMesh::onSessionKeyDecryptSuccess(int peer_idx) {
   int i = matching_peer_indexes[peer_idx];
   if (i >= 0 && i < num_contacts) {
@@ -9,6 +9,7 @@
 
 #include "ContactInfo.h"
 #include "SessionKeyPool.h"
+#include "PubKeyIndex.h"
 
 #define MAX_SEARCH_RESULTS   8
 
@@ -32,6 +33,8 @@ class ContactsIterator {
   int next_idx = 0;
 public:
   bool hasNext(const BaseChatMesh* mesh, ContactInfo& dest);
+  int getPosition() const { return next_idx; }   // eg. for resuming later, with setPosition()
+  void setPosition(int idx) { next_idx = idx; }
 };
 
 #ifndef MAX_CONTACTS
@@ -61,12 +64,14 @@ class BaseChatMesh : public mesh::Mesh {
 
   ContactInfo contacts[MAX_CONTACTS];
   int num_contacts;
+  PubKeyIndex<MAX_CONTACTS> contact_index;
   int sort_array[MAX_CONTACTS];
   int matching_peer_indexes[MAX_SEARCH_RESULTS];
   unsigned long txt_send_timeout;
 #ifdef MAX_GROUP_CHANNELS
   ChannelDetails channels[MAX_GROUP_CHANNELS];
   int num_channels;  // only for addChannel()
+  PubKeyIndex<MAX_GROUP_CHANNELS, PATH_HASH_SIZE> channel_index;   // all slots, by channel.hash
 #endif
   mesh::Packet* _pendingLoopback;
   uint8_t temp_buf[MAX_TRANS_UNIT];
@@ -86,12 +91,16 @@ class BaseChatMesh : public mesh::Mesh {
 
 protected:
   BaseChatMesh(mesh::Radio& radio, mesh::MillisecondClock& ms, mesh::RNG& rng, mesh::RTCClock& rtc, mesh::PacketManager& mgr, mesh::MeshTables& tables)
-      : mesh::Mesh(radio, ms, rng, rtc, mgr, tables)
+      : mesh::Mesh(radio, ms, rng, rtc, mgr, tables), contact_index(contacts[0].id.pub_key, sizeof(ContactInfo))
+  #ifdef MAX_GROUP_CHANNELS
+      , channel_index(channels[0].channel.hash, sizeof(ChannelDetails))
+  #endif
   { 
     num_contacts = 0;
   #ifdef MAX_GROUP_CHANNELS
     memset(channels, 0, sizeof(channels));
     num_channels = 0;
+    for (int i = 0; i < MAX_GROUP_CHANNELS; i++) channel_index.add(i);
   #endif
     txt_send_timeout = 0;
     _pendingLoopback = NULL;
@@ -103,7 +112,11 @@ protected:
   }
 
   void bootstrapRTCfromContacts();
-  void resetContacts() { num_contacts = 0; }
+  void resetContacts() {
+    num_contacts = 0;
+    contact_index.clear();
+    mesh::Utils::forgetAllKeys();
+  }
   void populateContactFromAdvert(ContactInfo& ci, const mesh::Identity& id, const AdvertDataParser& parser, uint32_t timestamp);
   ContactInfo* allocateContactSlot(); // helper to find slot for new contact
 
@@ -140,6 +153,7 @@ protected:
   bool applyLoadedNonce(const uint8_t* pub_key_prefix, uint16_t nonce);
   void finalizeNonceLoad(bool needs_bump);
   bool getNonceEntry(int idx, uint8_t* pub_key_prefix, uint16_t* nonce);
+  bool isNonceEntryChanged(int idx) const { return idx < num_contacts && contacts[idx].aead_nonce != nonce_at_last_persist[idx]; }
   bool isNonceDirty() const { return nonce_dirty; }
   void clearNonceDirty() {
     for (int i = 0; i < num_contacts; i++) nonce_at_last_persist[i] = contacts[i].aead_nonce;
@@ -186,6 +200,8 @@ protected:
   const uint8_t* getPeerSessionKey(int peer_idx) override;
   const uint8_t* getPeerPrevSessionKey(int peer_idx) override;
   void onSessionKeyDecryptSuccess(int peer_idx) override;
+  uint8_t getPeerDecodeHint(int peer_idx) override;
+  void setPeerDecodeHint(int peer_idx, uint8_t mode) override;
   const uint8_t* getPeerEncryptionKey(int peer_idx, const uint8_t* static_secret) override;
   uint16_t getPeerEncryptionNonce(int peer_idx) override;
   void onPeerDataRecv(mesh::Packet* packet, uint8_t type, int sender_idx, const uint8_t* secret, uint8_t* data, size_t len) override;
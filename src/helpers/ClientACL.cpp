@@ -1,7 +1,8 @@
 #include "ClientACL.h"
 #include <MeshCore.h>
-#include <SHA256.h>
 #include <ed_25519.h>
+#include <stddef.h>
+#include <helpers/RecordReader.h>
 
 static File openWrite(FILESYSTEM* _fs, const char* filename) {
   #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
@@ -14,9 +15,251 @@ static File openWrite(FILESYSTEM* _fs, const char* filename) {
   #endif
 }
 
+static uint16_t bumpNonce(uint16_t nonce, const uint8_t* pub_key) {
+  uint16_t old = nonce;
+  nonce += NONCE_BOOT_BUMP;
+  if (nonce == 0) nonce = 1;
+  if (nonce < old) {
+    MESH_DEBUG_PRINTLN("AEAD nonce wrapped after boot bump for client: %02x%02x%02x%02x",
+      pub_key[0], pub_key[1], pub_key[2], pub_key[3]);
+  }
+  return nonce;
+}
+
+static void copyStatus(ClientStatus& dest, const ClientInfo& c) {
+  dest.pending_ack = c.extra.room.pending_ack;
+  dest.last_activity = c.last_activity;
+  dest.permissions = c.permissions;
+  dest.flags = c.flags;
+}
+
+#define NONCE_LOG_FILE     "/s_nonce_log"
+#define NONCE_LEGACY_FILE  "/s_nonces"   // older format: the whole set, rewritten on every save
+#define NONCE_REC_SIZE     6             // [pub_prefix:4][nonce:2]
+
+static bool appendNonce(RecordLog& log, File& file, const uint8_t* pub_key, uint16_t nonce) {
+  uint8_t rec[NONCE_REC_SIZE];
+  memcpy(rec, pub_key, 4);
+  memcpy(&rec[4], &nonce, 2);
+  return log.append(file, rec) >= 0;
+}
+
+#if ACL_HOT_CLIENTS > 0
+
+#define ACL_PAGES_FILE      "/s_acl_pages"
+#define ACL_PAGE_SIZE       (sizeof(ClientInfo) + 2)   // ClientInfo, then its nonce_at_last_persist
+#define PAGE_NONCE_OFS      offsetof(ClientInfo, aead_nonce)
+#define PAGE_PERSISTED_OFS  sizeof(ClientInfo)
+
+static File openReadACL(FILESYSTEM* fs, const char* filename) {
+#if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+  return fs->open(filename, FILE_O_READ);
+#elif defined(RP2040_PLATFORM)
+  return fs->open(filename, "r");
+#else
+  return fs->open(filename, "r", false);
+#endif
+}
+
+// open for seek() and read/write, without truncating
+static File openPages(FILESYSTEM* _fs) {
+  #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+    return _fs->open(ACL_PAGES_FILE, FILE_O_WRITE);
+  #elif defined(RP2040_PLATFORM)
+    return _fs->open(ACL_PAGES_FILE, "r+");
+  #else
+    return _fs->open(ACL_PAGES_FILE, "r+", false);
+  #endif
+}
+
+static bool readPageField(File& file, int slot, int ofs, void* dest, int len) {
+  return file.seek(slot * ACL_PAGE_SIZE + ofs) && file.read((uint8_t *) dest, len) == len;
+}
+
+static bool writePageField(File& file, int slot, int ofs, const void* src, int len) {
+  return file.seek(slot * ACL_PAGE_SIZE + ofs) && file.write((const uint8_t *) src, len) == len;
+}
+
+static bool readPage(File& file, int slot, ClientInfo* c, uint16_t* persisted_nonce) {
+  return readPageField(file, slot, 0, c, sizeof(ClientInfo))
+      && file.read((uint8_t *) persisted_nonce, 2) == 2;
+}
+
+static bool writePage(File& file, int slot, const ClientInfo* c, uint16_t persisted_nonce) {
+  return writePageField(file, slot, 0, c, sizeof(ClientInfo))
+      && file.write((uint8_t *) &persisted_nonce, 2) == 2;
+}
+
+void ClientACL::resetResident() {
+  for (int i = 0; i < ACL_HOT_CLIENTS; i++) {
+    hot_slot[i] = -1;
+    hot_last_used[i] = 0;
+  }
+  hot_tick = 0;
+}
+
+int ClientACL::findResident(int slot) const {
+  for (int i = 0; i < ACL_HOT_CLIENTS; i++) {
+    if (hot_slot[i] == slot) return i;
+  }
+  return -1;
+}
+
+void ClientACL::writePage(int hot_idx) {
+  if (hot_slot[hot_idx] < 0) return;
+  copyStatus(client_status[hot_slot[hot_idx]], clients[hot_idx]);
+  if (!_fs) return;
+  File file = openPages(_fs);
+  if (file) {
+    if (!::writePage(file, hot_slot[hot_idx], &clients[hot_idx], nonce_at_last_persist[hot_idx])) {
+      MESH_DEBUG_PRINTLN("ClientACL: unable to write page %d", (int) hot_slot[hot_idx]);
+    }
+    file.close();
+  }
+}
+
+// write clients[hot_idx] back to its page, if it has changed
+void ClientACL::writeBack(int hot_idx) {
+  if (hot_slot[hot_idx] < 0) return;
+  copyStatus(client_status[hot_slot[hot_idx]], clients[hot_idx]);
+  if (!_fs) return;
+  File file = openPages(_fs);
+  if (file) {
+    ClientInfo stored;
+    uint16_t persisted;
+    int slot = hot_slot[hot_idx];
+    if (!readPage(file, slot, &stored, &persisted) || persisted != nonce_at_last_persist[hot_idx]
+        || memcmp(&stored, &clients[hot_idx], sizeof(ClientInfo)) != 0) {
+      if (!::writePage(file, slot, &clients[hot_idx], nonce_at_last_persist[hot_idx])) {
+        MESH_DEBUG_PRINTLN("ClientACL: unable to write page %d", slot);
+      }
+    }
+    file.close();
+  }
+}
+
+// returns the resident ClientInfo for a page slot, replacing the least recently used one if it isn't
+ClientInfo* ClientACL::pageIn(int slot, bool fetch) {
+  int h = findResident(slot);
+  if (h < 0) {
+    h = 0;
+    for (int i = 1; i < ACL_HOT_CLIENTS; i++) {   // free entries have last_used of 0
+      if (hot_last_used[i] < hot_last_used[h]) h = i;
+    }
+    writeBack(h);
+    hot_slot[h] = slot;
+    if (fetch) {
+      File file = _fs ? openPages(_fs) : File();
+      if (!(file && readPage(file, slot, &clients[h], &nonce_at_last_persist[h]))) {
+        MESH_DEBUG_PRINTLN("ClientACL: unable to read page %d", slot);
+        memset(&clients[h], 0, sizeof(ClientInfo));
+        hot_slot[h] = -1;   // just scratch, never written back
+      }
+      if (file) file.close();
+    }
+  }
+  hot_last_used[h] = ++hot_tick;
+  return &clients[h];
+}
+
+int ClientACL::findLeastActiveSlot() const {
+  uint32_t min_time = 0xFFFFFFFF;
+  int oldest = MAX_CLIENTS - 1;
+  for (int i = 0; i < num_clients; i++) {
+    auto s = getStatusByIdx(i);   // (no pages read)
+    if (!s.isAdmin() && s.last_activity < min_time) {
+      oldest = i;
+      min_time = s.last_activity;
+    }
+  }
+  return oldest;
+}
+
+ClientStatus ClientACL::getStatusByIdx(int idx) const {
+  int h = findResident(idx);
+  if (h < 0) return client_status[idx];
+
+  ClientStatus s;
+  copyStatus(s, clients[h]);
+  return s;
+}
+
+// append every client's aead_nonce (or only those changed since last persisted) to nonce_file, if not NULL, and mark
+// them as persisted
+bool ClientACL::syncNonces(File* nonce_file, bool all) {
+  File pages = _fs ? openPages(_fs) : File();
+  bool success = true;
+  for (int i = 0; i < num_clients && success; i++) {
+    uint16_t nonce, persisted;
+    int h = findResident(i);
+    if (h >= 0) {
+      nonce = clients[h].aead_nonce;
+      persisted = nonce_at_last_persist[h];
+    } else if (!(pages && readPageField(pages, i, PAGE_NONCE_OFS, &nonce, 2)
+                 && readPageField(pages, i, PAGE_PERSISTED_OFS, &persisted, 2))) {
+      continue;
+    }
+    if (nonce_file && (all || nonce != persisted)) {
+      success = appendNonce(nonce_log, *nonce_file, client_keys[i], nonce);
+    }
+    if (!success) break;
+    if (h >= 0) {
+      nonce_at_last_persist[h] = nonce;
+    } else if (persisted != nonce) {
+      writePageField(pages, i, PAGE_PERSISTED_OFS, &nonce, 2);
+    }
+  }
+  if (pages) pages.close();
+  if (success) nonce_dirty = false;
+  return success;
+}
+
+#else
+
+ClientStatus ClientACL::getStatusByIdx(int idx) const {
+  ClientStatus s;
+  copyStatus(s, clients[idx]);
+  return s;
+}
+
+bool ClientACL::syncNonces(File* nonce_file, bool all) {
+  for (int i = 0; i < num_clients; i++) {
+    uint16_t nonce = clients[i].aead_nonce;
+    if (nonce_file && (all || nonce != nonce_at_last_persist[i])) {
+      if (!appendNonce(nonce_log, *nonce_file, clients[i].id.pub_key, nonce)) return false;
+    }
+    nonce_at_last_persist[i] = nonce;
+  }
+  nonce_dirty = false;
+  return true;
+}
+
+#endif
+
+void ClientACL::clearNonceDirty() {
+  syncNonces(NULL);
+}
+
+int ClientACL::residentIndexOf(const ClientInfo& client) const {
+  int idx = &client - clients;
+#if ACL_HOT_CLIENTS > 0
+  return (idx >= 0 && idx < ACL_HOT_CLIENTS && hot_slot[idx] >= 0) ? idx : -1;
+#else
+  return (idx >= 0 && idx < num_clients) ? idx : -1;
+#endif
+}
+
 void ClientACL::load(FILESYSTEM* fs, const mesh::LocalIdentity& self_id) {
   _fs = fs;
+  session_store.begin(_fs, "/s_sess_log", "/s_sess_keys");
+  nonce_log.begin(_fs, NONCE_LOG_FILE, NONCE_REC_SIZE);
   num_clients = 0;
+  client_index.clear();
+#if ACL_HOT_CLIENTS > 0
+  resetResident();
+  File pages = openWrite(_fs, ACL_PAGES_FILE);   // rebuilt from /s_contacts
+  if (!pages) return;
+#endif
   if (_fs->exists("/s_contacts")) {
   #if defined(RP2040_PLATFORM)
     File file = _fs->open("/s_contacts", "r");
@@ -24,6 +267,7 @@ void ClientACL::load(FILESYSTEM* fs, const mesh::LocalIdentity& self_id) {
     File file = _fs->open("/s_contacts");
   #endif
     if (file) {
+      RecordReader in(file);
       bool full = false;
       while (!full) {
         ClientInfo c;
@@ -32,20 +276,27 @@ void ClientACL::load(FILESYSTEM* fs, const mesh::LocalIdentity& self_id) {
 
         memset(&c, 0, sizeof(c));
 
-        bool success = (file.read(pub_key, 32) == 32);
-        success = success && (file.read((uint8_t *) &c.permissions, 1) == 1);
-        success = success && (file.read((uint8_t *) &c.extra.room.sync_since, 4) == 4);
-        success = success && (file.read(unused, 2) == 2);
-        success = success && (file.read((uint8_t *)&c.out_path_len, 1) == 1);
-        success = success && (file.read(c.out_path, 64) == 64);
-        success = success && (file.read(c.shared_secret, PUB_KEY_SIZE) == PUB_KEY_SIZE); // will be recalculated below
+        bool success = (in.read(pub_key, 32) == 32);
+        success = success && (in.read((uint8_t *) &c.permissions, 1) == 1);
+        success = success && (in.read((uint8_t *) &c.extra.room.sync_since, 4) == 4);
+        success = success && (in.read(unused, 2) == 2);
+        success = success && (in.read((uint8_t *)&c.out_path_len, 1) == 1);
+        success = success && (in.read(c.out_path, 64) == 64);
+        success = success && (in.read(c.shared_secret, PUB_KEY_SIZE) == PUB_KEY_SIZE); // will be recalculated below
 
         if (!success) break; // EOF
 
         c.id = mesh::Identity(pub_key);
         self_id.calcSharedSecret(c.shared_secret, pub_key);  // recalculate shared secrets in case our private key changed
         if (num_clients < MAX_CLIENTS) {
-          clients[num_clients++] = c;
+        #if ACL_HOT_CLIENTS > 0
+          if (!::writePage(pages, num_clients, &c, 0)) break;
+          memcpy(client_keys[num_clients], pub_key, ACL_KEY_PREFIX);
+          copyStatus(client_status[num_clients], c);
+        #else
+          clients[num_clients] = c;
+        #endif
+          client_index.add(num_clients++);
         } else {
           full = true;
         }
@@ -53,6 +304,9 @@ void ClientACL::load(FILESYSTEM* fs, const mesh::LocalIdentity& self_id) {
       file.close();
     }
   }
+#if ACL_HOT_CLIENTS > 0
+  pages.close();
+#endif
 }
 
 void ClientACL::save(FILESYSTEM* fs, bool (*filter)(ClientInfo*)) {
@@ -61,9 +315,20 @@ void ClientACL::save(FILESYSTEM* fs, bool (*filter)(ClientInfo*)) {
   if (file) {
     uint8_t unused[2];
     memset(unused, 0, sizeof(unused));
+  #if ACL_HOT_CLIENTS > 0
+    File pages = openReadACL(_fs, ACL_PAGES_FILE);
+  #endif
 
     for (int i = 0; i < num_clients; i++) {
+    #if ACL_HOT_CLIENTS > 0
+      ClientInfo stored;
+      uint16_t persisted;
+      int h = findResident(i);
+      auto c = h >= 0 ? &clients[h] : &stored;
+      if (h < 0 && !(pages && readPage(pages, i, &stored, &persisted))) break;
+    #else
       auto c = &clients[i];
+    #endif
       if (c->permissions == 0 || (filter && !filter(c))) continue;    // skip deleted entries, or by filter function
 
       bool success = (file.write(c->id.pub_key, 32) == 32);
@@ -76,6 +341,9 @@ void ClientACL::save(FILESYSTEM* fs, bool (*filter)(ClientInfo*)) {
 
       if (!success) break; // write failed
     }
+  #if ACL_HOT_CLIENTS > 0
+    if (pages) pages.close();
+  #endif
     file.close();
   }
 }
@@ -85,23 +353,73 @@ bool ClientACL::clear() {
   if (_fs->exists("/s_contacts")) {
     _fs->remove("/s_contacts");
   }
+#if ACL_HOT_CLIENTS > 0
+  _fs->remove(ACL_PAGES_FILE);
+  File pages = openWrite(_fs, ACL_PAGES_FILE);
+  if (pages) pages.close();
+  resetResident();
+#endif
   memset(clients, 0, sizeof(clients));
   num_clients = 0;
+  client_index.clear();
+  mesh::Utils::forgetAllKeys();
   return true;
 }
 
+#if ACL_HOT_CLIENTS > 0
+
 ClientInfo* ClientACL::getClient(const uint8_t* pubkey, int key_len) {
-  for (int i = 0; i < num_clients; i++) {
-    if (memcmp(pubkey, clients[i].id.pub_key, key_len) == 0) return &clients[i];  // already known
+  int len = key_len < ACL_KEY_PREFIX ? key_len : ACL_KEY_PREFIX;   // only the prefix is indexed
+  int i = client_index.find(pubkey, len);
+  if (i < 0) return NULL;  // not found
+
+  auto c = pageIn(i);
+  if (key_len > len && memcmp(c->id.pub_key, pubkey, key_len) != 0) return NULL;   // just the prefix matched
+  return c;
+}
+
+ClientInfo* ClientACL::putClient(const mesh::Identity& id, uint8_t init_perms) {
+  auto known = getClient(id.pub_key, PUB_KEY_SIZE);
+  if (known) return known;
+
+  int slot;
+  if (num_clients < MAX_CLIENTS) {
+    slot = num_clients++;
+  } else {
+    slot = findLeastActiveSlot();  // evict least active contact
+    mesh::Utils::forgetKey(pageIn(slot)->shared_secret, PUB_KEY_SIZE);
+    client_index.remove(slot);
+  }
+  ClientInfo* c = pageIn(slot, false);
+  int h = c - clients;
+  memset(c, 0, sizeof(*c));
+  c->permissions = init_perms;
+  c->id = id;
+  memcpy(client_keys[slot], id.pub_key, ACL_KEY_PREFIX);
+  client_index.add(slot);
+  c->out_path_len = -1;  // initially out_path is unknown
+  if (_rng) {
+    c->aead_nonce = (uint16_t)_rng->nextInt(NONCE_INITIAL_MIN, NONCE_INITIAL_MAX + 1);
   }
-  return NULL;  // not found
+  nonce_at_last_persist[h] = c->aead_nonce;
+  writePage(h);   // new pages are appended in order, so the file has no gaps
+  return c;
+}
+
+#else
+
+ClientInfo* ClientACL::getClient(const uint8_t* pubkey, int key_len) {
+  int i = client_index.find(pubkey, key_len);
+  return i >= 0 ? &clients[i] : NULL;  // NULL if not found
 }
 
 ClientInfo* ClientACL::putClient(const mesh::Identity& id, uint8_t init_perms) {
+  auto known = getClient(id.pub_key, PUB_KEY_SIZE);
+  if (known) return known;
+
   uint32_t min_time = 0xFFFFFFFF;
   ClientInfo* oldest = &clients[MAX_CLIENTS - 1];
   for (int i = 0; i < num_clients; i++) {
-    if (id.matches(clients[i].id)) return &clients[i];  // already known
     if (!clients[i].isAdmin() && clients[i].last_activity < min_time) {
       oldest = &clients[i];
       min_time = oldest->last_activity;
@@ -113,11 +431,14 @@ ClientInfo* ClientACL::putClient(const mesh::Identity& id, uint8_t init_perms) {
     c = &clients[num_clients++];
   } else {
     c = oldest;  // evict least active contact
+    mesh::Utils::forgetKey(c->shared_secret, PUB_KEY_SIZE);
+    client_index.remove(c - clients);
   }
   int idx = c - clients;
   memset(c, 0, sizeof(*c));
   c->permissions = init_perms;
   c->id = id;
+  client_index.add(idx);
   c->out_path_len = -1;  // initially out_path is unknown
   if (_rng) {
     c->aead_nonce = (uint16_t)_rng->nextInt(NONCE_INITIAL_MIN, NONCE_INITIAL_MAX + 1);
@@ -126,11 +447,13 @@ ClientInfo* ClientACL::putClient(const mesh::Identity& id, uint8_t init_perms) {
   return c;
 }
 
+#endif
+
 uint16_t ClientACL::nextAeadNonceFor(const ClientInfo& client) {
   uint16_t nonce = client.nextAeadNonce();
   if (nonce != 0) {
-    int idx = &client - clients;
-    if (idx >= 0 && idx < num_clients &&
+    int idx = residentIndexOf(client);
+    if (idx >= 0 &&
         (uint16_t)(client.aead_nonce - nonce_at_last_persist[idx]) >= NONCE_PERSIST_INTERVAL) {
       nonce_dirty = true;
     }
@@ -140,58 +463,100 @@ uint16_t ClientACL::nextAeadNonceFor(const ClientInfo& client) {
 
 void ClientACL::loadNonces() {
   if (!_fs) return;
-#if defined(RP2040_PLATFORM)
-  File file = _fs->open("/s_nonces", "r");
-#elif defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
-  File file = _fs->open("/s_nonces", FILE_O_READ);
-#else
-  File file = _fs->open("/s_nonces", "r", false);
-#endif
+  bool legacy = !nonce_log.exists();
+  File file;
+  if (legacy) {
+  #if defined(RP2040_PLATFORM)
+    file = _fs->open(NONCE_LEGACY_FILE, "r");
+  #elif defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+    file = _fs->open(NONCE_LEGACY_FILE, FILE_O_READ);
+  #else
+    file = _fs->open(NONCE_LEGACY_FILE, "r", false);
+  #endif
+    if (file) nonce_log.requestCompact();   // next saveNonces() converts it
+  } else {
+    file = nonce_log.openRead();
+  }
   if (file) {
-    uint8_t rec[6];  // 4-byte pub_key prefix + 2-byte nonce
-    while (file.read(rec, 6) == 6) {
+  #if ACL_HOT_CLIENTS > 0
+    File pages = openPages(_fs);
+  #endif
+    uint8_t rec[NONCE_REC_SIZE];
+    // a client's latest record wins
+    while (legacy ? file.read(rec, NONCE_REC_SIZE) == NONCE_REC_SIZE : nonce_log.read(file, rec)) {
       uint16_t nonce;
       memcpy(&nonce, &rec[4], 2);
+    #if ACL_HOT_CLIENTS > 0
+      int i = client_index.find(rec, 4);
+      if (i >= 0) {
+        int h = findResident(i);
+        if (h >= 0) {
+          clients[h].aead_nonce = nonce;
+        } else if (pages) {
+          writePageField(pages, i, PAGE_NONCE_OFS, &nonce, 2);
+        }
+      }
+    #else
       for (int i = 0; i < num_clients; i++) {
         if (memcmp(clients[i].id.pub_key, rec, 4) == 0) {
           clients[i].aead_nonce = nonce;
           break;
         }
       }
+    #endif
     }
+  #if ACL_HOT_CLIENTS > 0
+    if (pages) pages.close();
+  #endif
     file.close();
   }
 }
 
 void ClientACL::saveNonces() {
   if (!_fs) return;
-  File file = openWrite(_fs, "/s_nonces");
-  if (file) {
-    for (int i = 0; i < num_clients; i++) {
-      file.write(clients[i].id.pub_key, 4);
-      file.write((uint8_t*)&clients[i].aead_nonce, 2);
-      nonce_at_last_persist[i] = clients[i].aead_nonce;
+  if (nonce_log.shouldCompact(num_clients)) {
+    File file = nonce_log.beginCompact();
+    if (file) {
+      bool success = syncNonces(&file, true);
+      if (nonce_log.endCompact(file, success) && _fs->exists(NONCE_LEGACY_FILE)) {
+        _fs->remove(NONCE_LEGACY_FILE);
+      }
+    }
+  } else {
+    File file = nonce_log.openAppend();   // just the nonces which have moved on
+    if (file) {
+      syncNonces(&file, false);
+      file.close();
     }
-    file.close();
-    nonce_dirty = false;
   }
 }
 
 void ClientACL::finalizeNonceLoad(bool needs_bump) {
+#if ACL_HOT_CLIENTS > 0
+  File pages = _fs ? openPages(_fs) : File();
   for (int i = 0; i < num_clients; i++) {
-    if (needs_bump) {
-      uint16_t old = clients[i].aead_nonce;
-      clients[i].aead_nonce += NONCE_BOOT_BUMP;
-      if (clients[i].aead_nonce == 0) clients[i].aead_nonce = 1;
-      if (clients[i].aead_nonce < old) {
-        MESH_DEBUG_PRINTLN("AEAD nonce wrapped after boot bump for client: %02x%02x%02x%02x",
-          clients[i].id.pub_key[0], clients[i].id.pub_key[1],
-          clients[i].id.pub_key[2], clients[i].id.pub_key[3]);
+    int h = findResident(i);
+    if (h >= 0) {
+      nonce_at_last_persist[h] = clients[h].aead_nonce;
+      if (needs_bump) clients[h].aead_nonce = bumpNonce(clients[h].aead_nonce, client_keys[i]);
+    } else {
+      uint16_t nonce;
+      if (!(pages && readPageField(pages, i, PAGE_NONCE_OFS, &nonce, 2))) continue;
+      writePageField(pages, i, PAGE_PERSISTED_OFS, &nonce, 2);
+      if (needs_bump) {
+        nonce = bumpNonce(nonce, client_keys[i]);
+        writePageField(pages, i, PAGE_NONCE_OFS, &nonce, 2);
       }
     }
+  }
+  if (pages) pages.close();
+#else
+  for (int i = 0; i < num_clients; i++) {
     nonce_at_last_persist[i] = clients[i].aead_nonce;
+    if (needs_bump) clients[i].aead_nonce = bumpNonce(clients[i].aead_nonce, clients[i].id.pub_key);
   }
-  nonce_dirty = false;
+#endif
+  nonce_dirty = needs_bump;   // the bumped nonces are yet to be persisted
 
   // Apply boot bump to session key nonces too
   if (needs_bump) {
@@ -215,15 +580,36 @@ bool ClientACL::applyPermissions(const mesh::LocalIdentity& self_id, const uint8
     if (c == NULL) return false;   // partial pubkey not found
 
     removeSessionKey(c->id.pub_key);  // also remove session key if any
-
-    num_clients--;   // delete from contacts[]
+    mesh::Utils::forgetKey(c->shared_secret, PUB_KEY_SIZE);
+
+  #if ACL_HOT_CLIENTS > 0
+    int h = c - clients;
+    int slot = hot_slot[h];
+    int last = num_clients - 1;
+    client_index.remove(slot);
+    if (slot != last) {   // move the last page into the gap
+      client_index.remove(last);
+      int m = pageIn(last) - clients;
+      hot_slot[m] = slot;
+      memcpy(client_keys[slot], client_keys[last], ACL_KEY_PREFIX);
+      client_index.add(slot);
+      writePage(m);
+    }
+    num_clients--;   // delete from pages
+    memset(c, 0, sizeof(ClientInfo));
+    hot_slot[h] = -1;
+    hot_last_used[h] = 0;
+  #else
     int i = c - clients;
+    client_index.erase(i);
+    num_clients--;   // delete from contacts[]
     while (i < num_clients) {
       clients[i] = clients[i + 1];
       nonce_at_last_persist[i] = nonce_at_last_persist[i + 1];
       i++;
     }
     memset(&clients[num_clients], 0, sizeof(ClientInfo));
+  #endif
   } else {
     if (key_len < PUB_KEY_SIZE) return false;   // need complete pubkey when adding/modifying
 
@@ -254,12 +640,7 @@ int ClientACL::handleSessionKeyInit(const ClientInfo* client, const uint8_t* eph
 
   // 3. Derive session_key = HMAC-SHA256(static_shared_secret, ephemeral_secret)
   uint8_t new_session_key[SESSION_KEY_SIZE];
-  {
-    SHA256 sha;
-    sha.resetHMAC(client->shared_secret, PUB_KEY_SIZE);
-    sha.update(ephemeral_secret, PUB_KEY_SIZE);
-    sha.finalizeHMAC(client->shared_secret, PUB_KEY_SIZE, new_session_key, SESSION_KEY_SIZE);
-  }
+  mesh::Utils::hmacSHA256(new_session_key, SESSION_KEY_SIZE, client->shared_secret, PUB_KEY_SIZE, ephemeral_secret, PUB_KEY_SIZE);
   memset(ephemeral_secret, 0, PUB_KEY_SIZE);
 
   // 4. Store in pool (dual-decode: new key active, old key still valid)
@@ -323,8 +704,8 @@ uint16_t ClientACL::getEncryptionNonce(const ClientInfo& client) {
   if (entry && entry->sends_since_last_recv < 255) {
     entry->sends_since_last_recv++;
     if (entry->sends_since_last_recv >= SESSION_KEY_ABANDON_THRESHOLD) {
-      int idx = &client - clients;
-      if (idx >= 0 && idx < num_clients)
+      int idx = residentIndexOf(client);
+      if (idx >= 0)
         clients[idx].flags &= ~CONTACT_FLAG_AEAD;
       removeSessionKey(client.id.pub_key);
       saveSessionKeys();
@@ -353,7 +734,7 @@ void ClientACL::onSessionConfirmed(const uint8_t* pub_key) {
 
 ClientInfo* ClientACL::resolveClient(int peer_idx, const int* matching_indexes) {
   int i = matching_indexes[peer_idx];
-  if (i >= 0 && i < num_clients) return &clients[i];
+  if (i >= 0 && i < num_clients) return getClientByIdx(i);
   return nullptr;
 }
 
@@ -377,6 +758,16 @@ void ClientACL::peerSessionKeyDecryptSuccess(int peer_idx, const int* matching_i
   if (c) onSessionConfirmed(c->id.pub_key);
 }
 
+uint8_t ClientACL::peerDecodeHint(int peer_idx, const int* matching_indexes) {
+  auto* c = resolveClient(peer_idx, matching_indexes);
+  return c ? c->decode_hint : DECODE_MODE_NONE;
+}
+
+void ClientACL::setPeerDecodeHint(int peer_idx, const int* matching_indexes, uint8_t mode) {
+  auto* c = resolveClient(peer_idx, matching_indexes);
+  if (c) c->decode_hint = mode;
+}
+
 const uint8_t* ClientACL::peerEncryptionKey(int peer_idx, const int* matching_indexes, const uint8_t* fallback) {
   auto* c = resolveClient(peer_idx, matching_indexes);
   return c ? getEncryptionKey(*c) : fallback;
@@ -389,46 +780,28 @@ uint16_t ClientACL::peerEncryptionNonce(int peer_idx, const int* matching_indexe
 
 // --- Flash-backed session key wrappers ---
 
-static File openReadACL(FILESYSTEM* fs, const char* filename) {
-#if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
-  return fs->open(filename, FILE_O_READ);
-#elif defined(RP2040_PLATFORM)
-  return fs->open(filename, "r");
-#else
-  return fs->open(filename, "r", false);
-#endif
-}
+// SessionKeyStore's view of the RAM pool
+class PoolStoreHost : public SessionKeyStoreHost {
+  SessionKeyPool& _pool;
+public:
+  PoolStoreHost(SessionKeyPool& pool) : _pool(pool) { }
+
+  bool onSessionKeyLoaded(const uint8_t* pub_key_prefix, uint8_t flags, uint16_t nonce,
+                          const uint8_t* session_key, const uint8_t* prev_session_key) override {
+    return _pool.applyLoaded(pub_key_prefix, flags, nonce, session_key, prev_session_key);
+  }
+  bool getSessionKeyForSave(int idx, uint8_t* pub_key_prefix, uint8_t* flags, uint16_t* nonce,
+                            uint8_t* session_key, uint8_t* prev_session_key) override {
+    return _pool.getEntryForSave(idx, pub_key_prefix, flags, nonce, session_key, prev_session_key);
+  }
+  bool isSessionKeyInRAM(const uint8_t* pub_key_prefix) override { return _pool.hasPrefix(pub_key_prefix); }
+  bool isSessionKeyRemoved(const uint8_t* pub_key_prefix) override { return _pool.isRemoved(pub_key_prefix); }
+};
 
 bool ClientACL::loadSessionKeyRecordFromFlash(const uint8_t* prefix,
     uint8_t* flags, uint16_t* nonce, uint8_t* session_key, uint8_t* prev_session_key) {
   if (!_fs) return false;
-  File f = openReadACL(_fs, "/s_sess_keys");
-  if (!f) return false;
-  while (true) {
-    uint8_t rec[SESSION_KEY_RECORD_MIN_SIZE];
-    if (f.read(rec, SESSION_KEY_RECORD_MIN_SIZE) != SESSION_KEY_RECORD_MIN_SIZE) break;
-    uint8_t rec_flags = rec[4];
-    bool has_prev = (rec_flags & SESSION_FLAG_PREV_VALID);
-    if (memcmp(rec, prefix, 4) == 0) {
-      *flags = rec_flags;
-      memcpy(nonce, &rec[5], 2);
-      memcpy(session_key, &rec[7], SESSION_KEY_SIZE);
-      if (has_prev) {
-        if (f.read(prev_session_key, SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-      } else {
-        memset(prev_session_key, 0, SESSION_KEY_SIZE);
-      }
-      f.close();
-      return true;
-    }
-    // Skip prev_key if present
-    if (has_prev) {
-      uint8_t skip[SESSION_KEY_SIZE];
-      if (f.read(skip, SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-    }
-  }
-  f.close();
-  return false;
+  return session_store.find(prefix, flags, nonce, session_key, prev_session_key);
 }
 
 SessionKeyEntry* ClientACL::findSessionKey(const uint8_t* pub_key) {
@@ -466,82 +839,15 @@ void ClientACL::removeSessionKey(const uint8_t* pub_key) {
 
 void ClientACL::loadSessionKeys() {
   if (!_fs) return;
-  File file = openReadACL(_fs, "/s_sess_keys");
-  if (!file) return;
-  while (true) {
-    uint8_t rec[SESSION_KEY_RECORD_MIN_SIZE];
-    if (file.read(rec, SESSION_KEY_RECORD_MIN_SIZE) != SESSION_KEY_RECORD_MIN_SIZE) break;
-    uint8_t flags = rec[4];
-    uint16_t nonce;
-    memcpy(&nonce, &rec[5], 2);
-    uint8_t prev_key[SESSION_KEY_SIZE];
-    if (flags & SESSION_FLAG_PREV_VALID) {
-      if (file.read(prev_key, SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-    } else {
-      memset(prev_key, 0, SESSION_KEY_SIZE);
-    }
-    session_keys.applyLoaded(rec, flags, nonce, &rec[7], prev_key);
-  }
-  file.close();
+  PoolStoreHost host(session_keys);
+  session_store.load(&host);
 }
 
 void ClientACL::saveSessionKeys() {
   if (!_fs) return;
-
-  // 1. Read old flash file into buffer (variable-length records)
-  uint8_t old_buf[MAX_SESSION_KEYS_FLASH * SESSION_KEY_RECORD_SIZE];
-  int old_len = 0;
-  File rf = openReadACL(_fs, "/s_sess_keys");
-  if (rf) {
-    while (true) {
-      if (old_len + SESSION_KEY_RECORD_MIN_SIZE > (int)sizeof(old_buf)) break;
-      if (rf.read(&old_buf[old_len], SESSION_KEY_RECORD_MIN_SIZE) != SESSION_KEY_RECORD_MIN_SIZE) break;
-      uint8_t flags = old_buf[old_len + 4];
-      int rec_len = SESSION_KEY_RECORD_MIN_SIZE;
-      if (flags & SESSION_FLAG_PREV_VALID) {
-        if (old_len + SESSION_KEY_RECORD_SIZE > (int)sizeof(old_buf)) break;
-        if (rf.read(&old_buf[old_len + SESSION_KEY_RECORD_MIN_SIZE], SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
-        rec_len = SESSION_KEY_RECORD_SIZE;
-      }
-      old_len += rec_len;
-    }
-    rf.close();
-  }
-
-  // 2. Write merged file
-  File wf = openWrite(_fs, "/s_sess_keys");
-  if (!wf) return;
-
-  // Write kept old records (variable-length)
-  int pos = 0;
-  while (pos + SESSION_KEY_RECORD_MIN_SIZE <= old_len) {
-    uint8_t* rec = &old_buf[pos];
-    uint8_t flags = rec[4];
-    int rec_len = (flags & SESSION_FLAG_PREV_VALID) ? SESSION_KEY_RECORD_SIZE : SESSION_KEY_RECORD_MIN_SIZE;
-    if (pos + rec_len > old_len) break;
-    if (!session_keys.hasPrefix(rec) && !session_keys.isRemoved(rec)) {
-      wf.write(rec, rec_len);
-    }
-    pos += rec_len;
-  }
-  // Write current RAM entries (variable-length)
-  for (int i = 0; i < session_keys.getCount(); i++) {
-    uint8_t pub_key_prefix[4];
-    uint8_t flags;
-    uint16_t nonce;
-    uint8_t session_key[SESSION_KEY_SIZE];
-    uint8_t prev_session_key[SESSION_KEY_SIZE];
-    if (session_keys.getEntryForSave(i, pub_key_prefix, &flags, &nonce, session_key, prev_session_key)) {
-      wf.write(pub_key_prefix, 4);
-      wf.write(&flags, 1);
-      wf.write((uint8_t*)&nonce, 2);
-      wf.write(session_key, SESSION_KEY_SIZE);
-      if (flags & SESSION_FLAG_PREV_VALID) {
-        wf.write(prev_session_key, SESSION_KEY_SIZE);
-      }
-    }
+  PoolStoreHost host(session_keys);
+  if (session_store.save(&host)) {
+    _session_keys_dirty = false;
+    session_keys.clearRemoved();
   }
-  wf.close();
-  _session_keys_dirty = false;
-  session_keys.clearRemoved();
 }
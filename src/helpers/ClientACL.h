@@ -4,6 +4,8 @@
 #include <Mesh.h>
 #include <helpers/IdentityStore.h>
 #include <helpers/SessionKeyPool.h>
+#include <helpers/SessionKeyStore.h>
+#include <helpers/PubKeyIndex.h>
 
 #define PERM_ACL_ROLE_MASK     3   // lower 2 bits
 #define PERM_ACL_GUEST         0
@@ -11,25 +13,28 @@
 #define PERM_ACL_READ_WRITE    2
 #define PERM_ACL_ADMIN         3
 
+union ClientExtra {
+  struct {
+    uint32_t sync_since;  // sync messages SINCE this timestamp (by OUR clock)
+    uint32_t pending_ack;
+    uint32_t push_post_timestamp;
+    unsigned long ack_timeout;
+    uint8_t  push_failures;
+  } room;
+};
+
 struct ClientInfo {
   mesh::Identity id;
   uint8_t permissions;
   uint8_t flags;                    // transient — includes CONTACT_FLAG_AEAD
   mutable uint16_t aead_nonce;      // transient — per-peer nonce counter
+  uint8_t decode_hint;              // transient — DECODE_MODE_ which last decrypted a packet from this client
   int8_t out_path_len;
   uint8_t out_path[MAX_PATH_SIZE];
   uint8_t shared_secret[PUB_KEY_SIZE];
   uint32_t last_timestamp;   // by THEIR clock  (transient)
   uint32_t last_activity;    // by OUR clock    (transient)
-  union  {
-    struct {
-      uint32_t sync_since;  // sync messages SINCE this timestamp (by OUR clock)
-      uint32_t pending_ack;
-      uint32_t push_post_timestamp;
-      unsigned long ack_timeout;
-      uint8_t  push_failures;
-    } room;
-  } extra;
+  ClientExtra extra;
 
   uint16_t nextAeadNonce() const {
     if (flags & CONTACT_FLAG_AEAD) {
@@ -41,26 +46,104 @@ struct ClientInfo {
   bool isAdmin() const { return (permissions & PERM_ACL_ROLE_MASK) == PERM_ACL_ADMIN; }
 };
 
+/**
+ * \brief  a copy of the ClientInfo fields which get polled for every client (by the 'get acl' style listings, the
+ *        room server's ACK checks, and eviction when the ACL is full). In paged mode these are also held in RAM for
+ *        every page slot, so reading them doesn't page a client in.
+ */
+struct ClientStatus {
+  uint32_t pending_ack;   // extra.room.pending_ack
+  uint32_t last_activity;
+  uint8_t permissions;
+  uint8_t flags;
+
+  bool isAdmin() const { return (permissions & PERM_ACL_ROLE_MASK) == PERM_ACL_ADMIN; }
+};
+
 #ifndef MAX_CLIENTS
   #define MAX_CLIENTS           20
 #endif
 
+/*
+ * ACL_HOT_CLIENTS > 0 selects the paged mode, for servers with hundreds of authorised clients (MAX_CLIENTS):
+ * every client is kept in a flash file ("/s_acl_pages", rebuilt from "/s_contacts" by load()), with only a
+ * ACL_KEY_PREFIX byte key prefix per client held in RAM for the index. Just ACL_HOT_CLIENTS ClientInfo's are
+ * resident, paged in on demand and written back (if changed) when they are the least recently used.
+ * Client indexes (findClientsByHash(), getClientByIdx(), resolveClient()) are page slots, so are stable as before,
+ * but a returned ClientInfo* is only valid until ACL_HOT_CLIENTS-1 other clients have been paged in, ie. don't hold
+ * one across anything that may look up other clients. Loops over all clients should poll getStatusByIdx() instead,
+ * and only fetch the ClientInfo's they act on.
+ * RAM per client is 22 bytes (key prefix, ClientStatus of 12, and 2 for the index), so 500 clients take about 11KB,
+ * against 200+ bytes per client when all are resident.
+ */
+#ifndef ACL_HOT_CLIENTS
+  #define ACL_HOT_CLIENTS        0     // all clients resident
+#endif
+#ifndef ACL_KEY_PREFIX
+  #define ACL_KEY_PREFIX         8
+#endif
+
+#if ACL_HOT_CLIENTS > 0 && ACL_HOT_CLIENTS < 2
+  #error "ACL_HOT_CLIENTS must be at least 2"
+#endif
+static_assert(ACL_KEY_PREFIX >= 6, "ACL_KEY_PREFIX must cover the 6 byte prefixes of getKeyPrefixByIdx()");
+
 class ClientACL {
   FILESYSTEM* _fs;
+#if ACL_HOT_CLIENTS > 0
+  ClientInfo clients[ACL_HOT_CLIENTS];       // the resident (hot) set
+  int16_t hot_slot[ACL_HOT_CLIENTS];         // page slot held in clients[i], -1 if free
+  uint32_t hot_last_used[ACL_HOT_CLIENTS];
+  uint32_t hot_tick;
+  uint8_t client_keys[MAX_CLIENTS][ACL_KEY_PREFIX];   // pub_key prefix of each page slot
+  ClientStatus client_status[MAX_CLIENTS];            // of each page slot, current unless the slot is resident
+  int num_clients;
+  PubKeyIndex<MAX_CLIENTS, ACL_KEY_PREFIX> client_index;
+
+  // Nonce persistence state (parallel to clients[], and stored with each page)
+  uint16_t nonce_at_last_persist[ACL_HOT_CLIENTS];
+#else
   ClientInfo clients[MAX_CLIENTS];
   int num_clients;
+  PubKeyIndex<MAX_CLIENTS> client_index;
 
   // Nonce persistence state (parallel to clients[])
   uint16_t nonce_at_last_persist[MAX_CLIENTS];
+#endif
   bool nonce_dirty;
   bool _session_keys_dirty;
   mesh::RNG* _rng;
 
   // Session key pool (Phase 2)
   SessionKeyPool session_keys;
+  SessionKeyStore session_store;
+  RecordLog nonce_log;
+
+  int residentIndexOf(const ClientInfo& client) const;
+  bool syncNonces(File* nonce_file, bool all=true);
+#if ACL_HOT_CLIENTS > 0
+  int findResident(int slot) const;
+  ClientInfo* pageIn(int slot, bool fetch=true);
+  void writePage(int hot_idx);
+  void writeBack(int hot_idx);
+  void resetResident();
+  int findLeastActiveSlot() const;
+#endif
 
 public:
-  ClientACL() {
+#if ACL_HOT_CLIENTS > 0
+  ClientACL() : client_index(client_keys[0], ACL_KEY_PREFIX) {
+    _fs = NULL;
+    memset(clients, 0, sizeof(clients));
+    memset(nonce_at_last_persist, 0, sizeof(nonce_at_last_persist));
+    resetResident();
+    num_clients = 0;
+    nonce_dirty = false;
+    _session_keys_dirty = false;
+    _rng = NULL;
+  }
+#else
+  ClientACL() : client_index(clients[0].id.pub_key, sizeof(ClientInfo)) {
     memset(clients, 0, sizeof(clients));
     memset(nonce_at_last_persist, 0, sizeof(nonce_at_last_persist));
     num_clients = 0;
@@ -68,16 +151,38 @@ public:
     _session_keys_dirty = false;
     _rng = NULL;
   }
+#endif
   void load(FILESYSTEM* _fs, const mesh::LocalIdentity& self_id);
   void save(FILESYSTEM* _fs, bool (*filter)(ClientInfo*)=NULL);
   bool clear();
 
   ClientInfo* getClient(const uint8_t* pubkey, int key_len);
+  int findClientsByHash(const uint8_t* hash, int dest_indexes[], int max_matches) const {
+    return client_index.findByHash(hash[0], dest_indexes, max_matches);
+  }
   ClientInfo* putClient(const mesh::Identity& id, uint8_t init_perms);
   bool applyPermissions(const mesh::LocalIdentity& self_id, const uint8_t* pubkey, int key_len, uint8_t perms);
 
   int getNumClients() const { return num_clients; }
+#if ACL_HOT_CLIENTS > 0
+  ClientInfo* getClientByIdx(int idx) { return pageIn(idx); }
+#else
   ClientInfo* getClientByIdx(int idx) { return &clients[idx]; }
+#endif
+
+  /**
+   * \brief  a copy of the client's status fields, without paging the client in. (to change them, use getClientByIdx())
+  */
+  ClientStatus getStatusByIdx(int idx) const;
+
+  /**
+   * \returns  the first 6 (at least) bytes of the client's pub_key, without paging the client in
+  */
+#if ACL_HOT_CLIENTS > 0
+  const uint8_t* getKeyPrefixByIdx(int idx) const { return client_keys[idx]; }
+#else
+  const uint8_t* getKeyPrefixByIdx(int idx) const { return clients[idx].id.pub_key; }
+#endif
   int getSessionKeyCount() const { return session_keys.getCount(); }
 
   // AEAD nonce persistence
@@ -87,10 +192,7 @@ public:
   void saveNonces();
   void finalizeNonceLoad(bool needs_bump);
   bool isNonceDirty() const { return nonce_dirty; }
-  void clearNonceDirty() {
-    for (int i = 0; i < num_clients; i++) nonce_at_last_persist[i] = clients[i].aead_nonce;
-    nonce_dirty = false;
-  }
+  void clearNonceDirty();
 
   // Session key support (Phase 2)
   int handleSessionKeyInit(const ClientInfo* client, const uint8_t* ephemeral_pub_A, uint8_t* reply_buf, mesh::RNG* rng);
@@ -122,6 +224,8 @@ public:
   const uint8_t* peerSessionKey(int peer_idx, const int* matching_indexes);
   const uint8_t* peerPrevSessionKey(int peer_idx, const int* matching_indexes);
   void peerSessionKeyDecryptSuccess(int peer_idx, const int* matching_indexes);
+  uint8_t peerDecodeHint(int peer_idx, const int* matching_indexes);
+  void setPeerDecodeHint(int peer_idx, const int* matching_indexes, uint8_t mode);
   const uint8_t* peerEncryptionKey(int peer_idx, const int* matching_indexes, const uint8_t* fallback);
   uint16_t peerEncryptionNonce(int peer_idx, const int* matching_indexes);
 };
@@ -16,6 +16,7 @@ struct ContactInfo {
   int32_t gps_lat, gps_lon;    // 6 dec places
   uint32_t sync_since;
   mutable uint16_t aead_nonce;  // per-peer AEAD nonce counter for DMs (not used for group messages), seeded from HW RNG
+  uint8_t decode_hint;   // transient — DECODE_MODE_ which last decrypted a packet from this peer
 
   // Returns next AEAD nonce (post-increment) if peer supports AEAD, 0 otherwise.
   // When 0, callers use ECB encryption.
@@ -42,6 +43,15 @@ struct ContactInfo {
     return shared_secret;
   }
 
+  // drops the shared secret, and anything cached from it (eg. when the contact is removed)
+  void forgetSharedSecret() {
+    if (shared_secret_valid) {
+      mesh::Utils::forgetKey(shared_secret, PUB_KEY_SIZE);
+      memset(shared_secret, 0, sizeof(shared_secret));
+      shared_secret_valid = false;
+    }
+  }
+
 private:
   mutable uint8_t shared_secret[PUB_KEY_SIZE];
 };
@@ -8,6 +8,9 @@
   #define FILESYSTEM  Adafruit_LittleFS
 
   using namespace Adafruit_LittleFS_Namespace;
+#elif defined(HOST_PLATFORM)
+  #include <helpers/host/HostFS.h>
+  #define FILESYSTEM  HostFS
 #endif
 #include <Identity.h>
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * \brief  An index over an array of structs which each hold a key (eg. Identity::pub_key, GroupChannel::hash).
+ *        Entries are kept sorted by the first KEY_PREFIX bytes of their key, with a 256 bucket table giving the
+ *        range for each leading (ie. hash) byte. So lookup by hash is O(1), and lookup by a key prefix is a binary
+ *        search within one bucket.
+ *        Keys are not copied, they are read in place (first key + stride), so an entry's key must be written
+ *        BEFORE add(), and the entry remove()'d BEFORE its key is changed.
+*/
+template <int MAX_ENTRIES, int KEY_PREFIX = 8>
+class PubKeyIndex {
+  static_assert(MAX_ENTRIES <= 0xFFFF, "PubKeyIndex MAX_ENTRIES too big");
+
+  const uint8_t* _keys;
+  int _stride;
+  int _count;
+  uint16_t _order[MAX_ENTRIES];   // entry indexes, sorted by key prefix
+  uint16_t _bucket[257];          // _order[_bucket[b] .. _bucket[b+1]) have leading key byte 'b'
+
+  const uint8_t* keyOf(int idx) const { return &_keys[idx * _stride]; }
+
+  // first position in the key[0] bucket, with prefix >= key (comparing len bytes)
+  int lowerBound(const uint8_t* key, int len) const {
+    int lo = _bucket[key[0]], hi = _bucket[key[0] + 1];
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (memcmp(keyOf(_order[mid]), key, len) < 0) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  int posOf(int idx) const {
+    const uint8_t* key = keyOf(idx);
+    for (int i = lowerBound(key, KEY_PREFIX); i < _bucket[key[0] + 1]; i++) {
+      if (_order[i] == idx) return i;
+    }
+    return -1;
+  }
+
+public:
+  /**
+   * \param  first_key  the key within entry [0] of the array
+   * \param  stride  sizeof() the array's entries
+  */
+  PubKeyIndex(const uint8_t* first_key, int stride) : _keys(first_key), _stride(stride) { clear(); }
+
+  void clear() {
+    _count = 0;
+    memset(_bucket, 0, sizeof(_bucket));
+  }
+  int count() const { return _count; }
+
+  void add(int idx) {
+    const uint8_t* key = keyOf(idx);
+    int pos = lowerBound(key, KEY_PREFIX);
+    while (pos < _bucket[key[0] + 1] && memcmp(keyOf(_order[pos]), key, KEY_PREFIX) == 0) pos++;   // after any equal keys
+    memmove(&_order[pos + 1], &_order[pos], (_count - pos) * sizeof(_order[0]));
+    _order[pos] = idx;
+    _count++;
+    for (int b = key[0] + 1; b <= 256; b++) _bucket[b]++;
+  }
+
+  bool remove(int idx) {
+    int pos = posOf(idx);
+    if (pos < 0) return false;
+
+    _count--;
+    memmove(&_order[pos], &_order[pos + 1], (_count - pos) * sizeof(_order[0]));
+    for (int b = keyOf(idx)[0] + 1; b <= 256; b++) _bucket[b]--;
+    return true;
+  }
+
+  /**
+   * \brief  remove(), for when entries after 'idx' are then shifted down to close the gap in the array
+  */
+  void erase(int idx) {
+    remove(idx);
+    for (int i = 0; i < _count; i++) {
+      if (_order[i] > idx) _order[i]--;
+    }
+  }
+
+  /**
+   * \returns  number of entries whose key starts with 'hash', their indexes stored in dest[]
+  */
+  int findByHash(uint8_t hash, int dest[], int max_matches) const {
+    int n = 0;
+    for (int i = _bucket[hash]; i < _bucket[hash + 1] && n < max_matches; i++) {
+      dest[n++] = _order[i];
+    }
+    return n;
+  }
+
+  /**
+   * \returns  the lowest index of entries whose key starts with prefix[0..len), or -1 if none
+  */
+  int find(const uint8_t* prefix, int len) const {
+    int best = -1;
+    if (len <= 0) {   // matches anything
+      for (int i = 0; i < _count; i++) {
+        if (best < 0 || _order[i] < best) best = _order[i];
+      }
+      return best;
+    }
+    int cmp_len = len < KEY_PREFIX ? len : KEY_PREFIX;
+    for (int i = lowerBound(prefix, cmp_len); i < _bucket[prefix[0] + 1]; i++) {
+      const uint8_t* key = keyOf(_order[i]);
+      if (memcmp(key, prefix, cmp_len) != 0) break;   // past the run of matching prefixes
+      if ((best < 0 || _order[i] < best) && memcmp(key, prefix, len) == 0) best = _order[i];
+    }
+    return best;
+  }
+};
@@ -0,0 +1,162 @@
+#include "RecordLog.h"
+#include <MeshCore.h>
+
+static File openRead(FILESYSTEM* _fs, const char* filename) {
+  #if defined(RP2040_PLATFORM)
+    return _fs->open(filename, "r");
+  #else
+    return _fs->open(filename);
+  #endif
+}
+
+static File openWrite(FILESYSTEM* _fs, const char* filename) {
+  #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+    _fs->remove(filename);
+    return _fs->open(filename, FILE_O_WRITE);
+  #elif defined(RP2040_PLATFORM)
+    return _fs->open(filename, "w");
+  #else
+    return _fs->open(filename, "w", true);
+  #endif
+}
+
+static File openAppend(FILESYSTEM* _fs, const char* filename) {
+  #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+    return _fs->open(filename, FILE_O_WRITE);   // opens at the end
+  #elif defined(RP2040_PLATFORM)
+    return _fs->open(filename, "a");
+  #else
+    return _fs->open(filename, "a", true);
+  #endif
+}
+
+// CRC-16/CCITT-FALSE
+static uint16_t crc16(const uint8_t* data, int len) {
+  uint16_t crc = 0xFFFF;
+  for (int i = 0; i < len; i++) {
+    crc ^= ((uint16_t) data[i]) << 8;
+    for (int b = 0; b < 8; b++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  }
+  return crc;
+}
+
+RecordLog::RecordLog() {
+  _fs = NULL;
+  _path = NULL;
+  _tmp_path[0] = 0;
+  _rec_size = 0;
+  _num_records = 0;
+  _num_compacted = 0;
+  _compacting = false;
+  _needs_compact = false;
+}
+
+void RecordLog::begin(FILESYSTEM* fs, const char* path, int rec_size) {
+  _fs = fs;
+  _path = path;
+  _rec_size = rec_size;
+  snprintf(_tmp_path, sizeof(_tmp_path), "%s.tmp", path);
+  _num_records = 0;
+  _compacting = false;
+  _needs_compact = false;
+
+  if (_fs->exists(_tmp_path)) {
+    if (_fs->exists(_path)) {
+      _fs->remove(_tmp_path);   // compaction didn't finish writing, the log is still intact
+    } else {
+      _fs->rename(_tmp_path, _path);   // compaction was written, but not yet renamed
+    }
+  }
+
+  File file = ::openRead(_fs, _path);
+  if (file) {
+    uint32_t size = file.size();
+    _num_records = size / fileRecSize();
+    if (size % fileRecSize()) _needs_compact = true;   // a partial record at the end
+    file.close();
+  }
+}
+
+bool RecordLog::exists() const {
+  return _fs && _fs->exists(_path);
+}
+
+File RecordLog::openRead() {
+  if (!exists()) return File();
+  return ::openRead(_fs, _path);
+}
+
+bool RecordLog::read(File& file, uint8_t* rec) {
+  uint8_t buf[RECORD_LOG_MAX_RECORD + 2];
+  int n = file.read(buf, fileRecSize());
+  if (n == 0) return false;   // end of log
+
+  uint16_t crc;
+  memcpy(&crc, &buf[_rec_size], 2);
+  if (n != fileRecSize() || crc != crc16(buf, _rec_size)) {
+    MESH_DEBUG_PRINTLN("RecordLog: bad record in %s", _path);
+    _needs_compact = true;   // anything after this point is unreadable
+    return false;
+  }
+  memcpy(rec, buf, _rec_size);
+  return true;
+}
+
+bool RecordLog::readAt(File& file, uint32_t idx, uint8_t* rec) {
+  return idx < _num_records && file.seek(idx * fileRecSize()) && read(file, rec);
+}
+
+File RecordLog::openAppend() {
+  if (_fs == NULL || _needs_compact || _compacting) return File();
+  return ::openAppend(_fs, _path);
+}
+
+int32_t RecordLog::append(File& file, const uint8_t* rec) {
+  uint8_t buf[RECORD_LOG_MAX_RECORD + 2];
+  memcpy(buf, rec, _rec_size);
+  uint16_t crc = crc16(buf, _rec_size);
+  memcpy(&buf[_rec_size], &crc, 2);
+  if (file.write(buf, fileRecSize()) != fileRecSize()) {
+    if (!_compacting) _needs_compact = true;   // may have left a partial record
+    return -1;
+  }
+  return _compacting ? _num_compacted++ : _num_records++;
+}
+
+File RecordLog::beginCompact() {
+  if (_fs == NULL) return File();
+  File file = ::openWrite(_fs, _tmp_path);
+  if (file) {
+    _compacting = true;
+    _num_compacted = 0;
+  }
+  return file;
+}
+
+bool RecordLog::endCompact(File& file, bool success) {
+  file.close();
+  _compacting = false;
+  if (success) {
+    _fs->remove(_path);
+    success = _fs->rename(_tmp_path, _path);
+  } else {
+    _fs->remove(_tmp_path);
+  }
+  if (success) {
+    _num_records = _num_compacted;
+    _needs_compact = false;
+  } else {
+    MESH_DEBUG_PRINTLN("RecordLog: compaction of %s failed", _path);
+    begin(_fs, _path, _rec_size);   // recount the log as it is now
+    _needs_compact = true;
+  }
+  return success;
+}
+
+bool RecordLog::clear() {
+  _num_records = 0;
+  _needs_compact = false;
+  return _fs != NULL && (!_fs->exists(_path) || _fs->remove(_path));
+}
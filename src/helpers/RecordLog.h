@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Arduino.h>   // needed for PlatformIO
+#include <helpers/IdentityStore.h>
+
+#define RECORD_LOG_MAX_RECORD  176     // max rec_size
+
+#ifndef RECORD_LOG_SLACK
+  #define RECORD_LOG_SLACK      32     // superseded records allowed, on top of 1x the live records, before compaction
+#endif
+
+/**
+ * \brief  An append-only file of fixed size records, each followed by a CRC-16. For state which changes a little at
+ *        a time (eg. nonces, session keys), so that an update is one small append rather than a rewrite of the whole
+ *        file. Replay stops at the first bad record (eg. an append cut short by a reset), after which the log must
+ *        be compacted before it can be appended to. Compaction writes just the owner's live records to a new file,
+ *        which is then renamed over the log; an interrupted compaction is recovered by begin().
+*/
+class RecordLog {
+  FILESYSTEM* _fs;
+  const char* _path;
+  char _tmp_path[32];
+  int _rec_size;
+  uint32_t _num_records;
+  uint32_t _num_compacted;
+  bool _compacting;
+  bool _needs_compact;
+
+  int fileRecSize() const { return _rec_size + 2; }
+
+public:
+  RecordLog();
+
+  void begin(FILESYSTEM* fs, const char* path, int rec_size);
+  bool exists() const;
+
+  uint32_t getNumRecords() const { return _num_records; }
+
+  /**
+   * \param  num_live  the number of records a compaction would write
+  */
+  bool shouldCompact(int num_live) const {
+    return _needs_compact || _num_records > (uint32_t) (2*num_live + RECORD_LOG_SLACK);
+  }
+  void requestCompact() { _needs_compact = true; }
+
+  /**
+   * \brief  reading, in order with read() or by record index with readAt(). Either returns false at the end of the
+   *      log, or on a bad record.
+  */
+  File openRead();
+  bool read(File& file, uint8_t* rec);
+  bool readAt(File& file, uint32_t idx, uint8_t* rec);
+
+  /**
+   * \brief  appending. openAppend() fails if the log needs compaction
+   * \returns  the new record's index, or -1 if the write failed
+  */
+  File openAppend();
+  int32_t append(File& file, const uint8_t* rec);
+
+  /**
+   * \brief  compaction: beginCompact(), then append() each live record, then endCompact(). The log can still be read
+   *      (with its own File) until endCompact(), after which record indexes start again from zero.
+  */
+  File beginCompact();
+  bool endCompact(File& file, bool success);
+
+  bool clear();
+};
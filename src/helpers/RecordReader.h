@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>   // needed for PlatformIO
+#include <helpers/IdentityStore.h>
+
+#ifndef RECORD_READER_BUF_SIZE
+  #define RECORD_READER_BUF_SIZE   256
+#endif
+
+/**
+ * \brief  Reads a File in blocks of RECORD_READER_BUF_SIZE, for the loaders which decode records a field at a time.
+ *        read() is a drop-in for File::read(), served from the buffer, so the filesystem sees one read call per
+ *        block rather than one per field.
+*/
+class RecordReader {
+  File& _file;
+  uint8_t _buf[RECORD_READER_BUF_SIZE];
+  int _pos, _len;
+
+  bool fill() {
+    _pos = 0;
+    int n = _file.read(_buf, sizeof(_buf));
+    _len = n > 0 ? n : 0;
+    return _len > 0;
+  }
+
+public:
+  RecordReader(File& file) : _file(file), _pos(0), _len(0) { }
+
+  size_t read(uint8_t* dest, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+      if (_pos >= _len && !fill()) break;   // EOF
+      size_t n = _len - _pos;
+      if (n > len - done) n = len - done;
+      memcpy(&dest[done], &_buf[_pos], n);
+      _pos += n;
+      done += n;
+    }
+    return done;
+  }
+
+  /**
+   * \returns  the number of bytes skipped, less than 'len' at EOF
+  */
+  size_t skip(size_t len) {
+    size_t done = 0;
+    while (done < len) {
+      if (_pos >= _len && !fill()) break;
+      size_t n = _len - _pos;
+      if (n > len - done) n = len - done;
+      _pos += n;
+      done += n;
+    }
+    return done;
+  }
+};
@@ -1,5 +1,6 @@
 #include "RegionMap.h"
 #include <helpers/TxtDataHelpers.h>
+#include <helpers/RecordReader.h>
 #include <SHA256.h>
 
 // helper class for region map exporter, we emulate Stream with a safe buffer writer.
@@ -41,13 +42,28 @@ private:
 };
 
 
-RegionMap::RegionMap(TransportKeyStore& store) : _store(&store) {
+RegionMap::RegionMap(TransportKeyStore& store, RegionKeyTable* key_table) : _store(&store), _key_table(key_table) {
   next_id = 1; num_regions = 0; home_id = 0;
+  num_prepared = 0; keys_version = 0; keys_dirty = true;
   wildcard.id = wildcard.parent = 0;
   wildcard.flags = 0;  // default behaviour, allow flood and direct
   strcpy(wildcard.name, "*");
 }
 
+RegionMap& RegionMap::operator=(const RegionMap& src) {
+  if (this != &src) {
+    _store = src._store;
+    next_id = src.next_id;
+    home_id = src.home_id;
+    num_regions = src.num_regions;
+    memcpy(regions, src.regions, sizeof(regions[0]) * num_regions);
+    wildcard = src.wildcard;
+    num_prepared = 0;
+    keys_dirty = true;
+  }
+  return *this;
+}
+
 bool RegionMap::is_name_char(uint8_t c) {
   // accept all alpha-num or accented characters, but exclude most punctuation chars
   return c == '-' || c == '$' || c == '#' || (c >= '0' && c <= '9') || c >= 'A';
@@ -77,24 +93,25 @@ bool RegionMap::load(FILESYSTEM* _fs, const char* path) {
   #endif
 
     if (file) {
-      uint8_t pad[128];
+      RecordReader in(file);
 
       num_regions = 0; next_id = 1; home_id = 0;
+      keys_dirty = true;
 
-      bool success = file.read(pad, 5) == 5;  // reserved header
-      success = success && file.read((uint8_t *) &home_id, sizeof(home_id)) == sizeof(home_id);
-      success = success && file.read((uint8_t *) &wildcard.flags, sizeof(wildcard.flags)) == sizeof(wildcard.flags);
-      success = success && file.read((uint8_t *) &next_id, sizeof(next_id)) == sizeof(next_id);
+      bool success = in.skip(5) == 5;  // reserved header
+      success = success && in.read((uint8_t *) &home_id, sizeof(home_id)) == sizeof(home_id);
+      success = success && in.read((uint8_t *) &wildcard.flags, sizeof(wildcard.flags)) == sizeof(wildcard.flags);
+      success = success && in.read((uint8_t *) &next_id, sizeof(next_id)) == sizeof(next_id);
 
       if (success) {
         while (num_regions < MAX_REGION_ENTRIES) {
           auto r = &regions[num_regions];
 
-          success = file.read((uint8_t *) &r->id, sizeof(r->id)) == sizeof(r->id);
-          success = success && file.read((uint8_t *) &r->parent, sizeof(r->parent)) == sizeof(r->parent);
-          success = success && file.read((uint8_t *) r->name, sizeof(r->name)) == sizeof(r->name);
-          success = success && file.read((uint8_t *) &r->flags, sizeof(r->flags)) == sizeof(r->flags);
-          success = success && file.read(pad, sizeof(pad)) == sizeof(pad);
+          success = in.read((uint8_t *) &r->id, sizeof(r->id)) == sizeof(r->id);
+          success = success && in.read((uint8_t *) &r->parent, sizeof(r->parent)) == sizeof(r->parent);
+          success = success && in.read((uint8_t *) r->name, sizeof(r->name)) == sizeof(r->name);
+          success = success && in.read((uint8_t *) &r->flags, sizeof(r->flags)) == sizeof(r->flags);
+          success = success && in.skip(128) == 128;   // pad
 
           if (!success) break; // EOF
 
@@ -156,6 +173,7 @@ RegionEntry* RegionMap::putRegion(const char* name, uint16_t parent_id, uint16_t
     if (id == 0 && num_regions >= MAX_REGION_ENTRIES) return NULL;  // full!
 
     region = &regions[num_regions++];   // alloc new RegionEntry
+    keys_dirty = true;
     region->flags = REGION_DENY_FLOOD;     // DENY by default
     region->id = id == 0 ? next_id++ : id;
     StrHelper::strncpy(region->name, name, sizeof(region->name));
@@ -164,28 +182,65 @@ RegionEntry* RegionMap::putRegion(const char* name, uint16_t parent_id, uint16_t
   return region;
 }
 
+int RegionMap::getKeysFor(const RegionEntry* region, TransportKey keys[], int max_num) {
+  if (region->name[0] == '$') {   // private region
+    return _store->loadKeysFor(region->id, keys, max_num);
+  }
+  if (region->name[0] == '#') {   // auto hashtag region
+    _store->getAutoKeyFor(region->id, region->name, keys[0]);
+  } else {   // new: implicit auto hashtag region
+    char tmp[sizeof(region->name) + 1];
+    tmp[0] = '#';
+    strcpy(&tmp[1], region->name);
+    _store->getAutoKeyFor(region->id, tmp, keys[0]);
+  }
+  return 1;
+}
+
+void RegionMap::prepareKeys() {
+  int n = 0;
+  num_prepared = 0;
+  for (int i = 0; _key_table && i < num_regions; i++) {
+    TransportKey keys[MAX_TKS_KEYS_PER_ID];
+    int num = getKeysFor(&regions[i], keys, MAX_TKS_KEYS_PER_ID);
+    if (n + num > MAX_REGION_KEYS) break;   // no room, this and later regions are done per packet
+
+    auto t = _key_table;
+    t->start[i] = n;
+    for (int j = 0; j < num; j++, n++) {
+      mesh::Utils::hmacPrepare(t->pads[n].inner, t->pads[n].outer, keys[j].key, sizeof(keys[j].key));
+    }
+    t->start[i + 1] = n;
+    num_prepared = i + 1;
+  }
+  keys_version = _store->getVersion();
+  keys_dirty = false;
+}
+
 RegionEntry* RegionMap::findMatch(mesh::Packet* packet, uint8_t mask) {
+  if (keys_dirty || keys_version != _store->getVersion()) prepareKeys();
+
+  uint8_t type = packet->getPayloadType();
   for (int i = 0; i < num_regions; i++) {
     auto region = &regions[i];
     if ((region->flags & mask) == 0) {   // does region allow this? (per 'mask' param)
-      TransportKey keys[4];
-      int num;
-      if (region->name[0] == '$') {   // private region
-        num = _store->loadKeysFor(region->id, keys, 4);
-      } else if (region->name[0] == '#') {   // auto hashtag region
-        _store->getAutoKeyFor(region->id, region->name, keys[0]);
-        num = 1;
-      } else {   // new: implicit auto hashtag region
-        char tmp[sizeof(region->name)];
-        tmp[0] = '#';
-        strcpy(&tmp[1], region->name);
-        _store->getAutoKeyFor(region->id, tmp, keys[0]);
-        num = 1;
-      }
-      for (int j = 0; j < num; j++) {
-        uint16_t code = keys[j].calcTransportCode(packet);
-        if (packet->transport_codes[0] == code) {   // a match!!
-          return region;
+      if (i < num_prepared) {
+        auto t = _key_table;
+        for (int k = t->start[i]; k < t->start[i + 1]; k++) {
+          uint16_t code;
+          mesh::Utils::hmacFinish((uint8_t *) &code, 2, t->pads[k].inner, t->pads[k].outer, &type, 1, packet->payload, packet->payload_len);
+          if (packet->transport_codes[0] == TransportKey::toTransportCode(code)) {   // a match!!
+            return region;
+          }
+        }
+      } else {
+        TransportKey keys[MAX_TKS_KEYS_PER_ID];
+        int num = getKeysFor(region, keys, MAX_TKS_KEYS_PER_ID);
+        for (int j = 0; j < num; j++) {
+          uint16_t code = keys[j].calcTransportCode(packet);
+          if (packet->transport_codes[0] == code) {   // a match!!
+            return region;
+          }
         }
       }
     }
@@ -257,11 +312,22 @@ bool RegionMap::removeRegion(const RegionEntry& region) {
     regions[i] = regions[i + 1];
     i++;
   }
+  keys_dirty = true;
   return true;  // success
 }
 
+bool RegionMap::pruneKeys() {
+  uint16_t ids[MAX_REGION_ENTRIES];
+  int n = 0;
+  for (int i = 0; i < num_regions; i++) {
+    if (regions[i].name[0] == '$') ids[n++] = regions[i].id;
+  }
+  return _store->retainKeys(ids, n);
+}
+
 bool RegionMap::clear() {
   num_regions = 0;
+  keys_dirty = true;
   return true;  // success
 }
 
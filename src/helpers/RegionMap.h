@@ -2,12 +2,17 @@
 
 #include <Arduino.h>   // needed for PlatformIO
 #include <Packet.h>
+#include <SHA256.h>
 #include "TransportKeyStore.h"
 
 #ifndef MAX_REGION_ENTRIES
   #define MAX_REGION_ENTRIES  32
 #endif
 
+#ifndef MAX_REGION_KEYS
+  #define MAX_REGION_KEYS  4   // keys kept prepared for findMatch(), any more are looked up per packet
+#endif
+
 #define REGION_DENY_FLOOD   0x01
 #define REGION_DENY_DIRECT  0x02   // reserved for future
 
@@ -18,17 +23,46 @@ struct RegionEntry {
   char name[31];
 };
 
+/**
+ * \brief  HMAC midstates of a RegionMap's keys, in region order: regions[i] has pads[start[i] .. start[i+1]).
+ *        About 240 bytes per key (so ~1KB at the default MAX_REGION_KEYS, ~7.5KB if raised to MAX_REGION_ENTRIES),
+ *        which is why this is separate from RegionMap: only the map used by findMatch() needs one, not eg. a staging
+ *        copy.
+*/
+struct RegionKeyTable {
+  struct KeyPads {
+    SHA256 inner, outer;
+  };
+  KeyPads pads[MAX_REGION_KEYS];
+  uint16_t start[MAX_REGION_ENTRIES + 1];
+};
+
 class RegionMap {
   TransportKeyStore* _store;
+  RegionKeyTable* _key_table;   // NULL: findMatch() looks up every region's keys per packet
   uint16_t next_id, home_id;
   uint16_t num_regions;
   RegionEntry regions[MAX_REGION_ENTRIES];
   RegionEntry wildcard;
 
+  uint16_t num_prepared;     // regions[0 .. num_prepared) have all their keys in _key_table
+  uint16_t keys_version;     // of _store, when _key_table was prepared
+  bool keys_dirty;
+
+  int getKeysFor(const RegionEntry* region, TransportKey keys[], int max_num);
+  void prepareKeys();
   void printChildRegions(int indent, const RegionEntry* parent, Stream& out) const;
 
 public:
-  RegionMap(TransportKeyStore& store);
+  /**
+   * \param  key_table  (optional) where to keep the keys prepared, for faster findMatch()
+  */
+  RegionMap(TransportKeyStore& store, RegionKeyTable* key_table = NULL);
+
+  /**
+   * \brief  copies the regions of 'src', but keeps this map's own key table, (re-)prepared on next findMatch()
+  */
+  RegionMap& operator=(const RegionMap& src);
 
   static bool is_name_char(uint8_t c);
 
@@ -44,8 +78,13 @@ public:
   RegionEntry* getHomeRegion();   // NOTE: can be NULL
   void setHomeRegion(const RegionEntry* home);
   bool removeRegion(const RegionEntry& region);
+
+  /**
+   * \brief  removes stored keys of any private region no longer in this map
+  */
+  bool pruneKeys();
   bool clear();
-  void resetFrom(const RegionMap& src) { num_regions = 0; next_id = src.next_id; }
+  void resetFrom(const RegionMap& src) { num_regions = 0; next_id = src.next_id; keys_dirty = true; }
   int getCount() const { return num_regions; }
   const RegionEntry* getByIdx(int i) const { return &regions[i]; }
   const RegionEntry* getRoot() const { return &wildcard; }
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * \brief  A fixed capacity set of KEY_SIZE byte keys (eg. packet hashes), for duplicate detection.
+ *        Keys live in CAPACITY slots, found through an open addressing (linear probe) index of twice that size,
+ *        so lookup, insert and evict are O(1) expected. When full, insert() evicts with CLOCK: keys which have been
+ *        looked up again since the hand last passed them get a second chance.
+ *        Keys are assumed to be evenly distributed (hash output, CRCs), as their leading bytes are used directly as the hash.
+*/
+template <int CAPACITY, int KEY_SIZE>
+class SeenHashSet {
+  static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "SeenHashSet CAPACITY must be a power of 2");
+  static_assert(CAPACITY < 0x8000, "SeenHashSet CAPACITY too big");
+  static_assert(KEY_SIZE >= 4, "SeenHashSet KEY_SIZE must be at least 4");
+
+  enum { INDEX_SIZE = CAPACITY*2 };
+  enum { SLOT_EMPTY = 0, SLOT_USED, SLOT_REFERENCED };
+
+  uint8_t _keys[CAPACITY*KEY_SIZE];
+  uint8_t _state[CAPACITY];       // one of SLOT_*
+  uint16_t _index[INDEX_SIZE];    // slot + 1, or 0 if free
+  int _hand;
+
+  static int homeOf(const uint8_t* key) {
+    uint32_t h;
+    memcpy(&h, key, 4);
+    return h & (INDEX_SIZE - 1);
+  }
+  const uint8_t* keyAt(int slot) const { return &_keys[slot*KEY_SIZE]; }
+
+  int findPos(const uint8_t* key) const {
+    for (int i = homeOf(key); _index[i] != 0; i = (i + 1) & (INDEX_SIZE - 1)) {
+      if (memcmp(keyAt(_index[i] - 1), key, KEY_SIZE) == 0) return i;
+    }
+    return -1;
+  }
+
+  void addToIndex(int slot) {
+    int i = homeOf(keyAt(slot));
+    while (_index[i] != 0) i = (i + 1) & (INDEX_SIZE - 1);
+    _index[i] = slot + 1;
+  }
+
+  void removeFromIndex(int pos) {
+    // backward shift deletion, so that probe sequences stay unbroken (no tombstones)
+    int i = pos;
+    for (int j = (i + 1) & (INDEX_SIZE - 1); _index[j] != 0; j = (j + 1) & (INDEX_SIZE - 1)) {
+      int k = homeOf(keyAt(_index[j] - 1));
+      bool stays = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);   // home is cyclically within (i, j]
+      if (!stays) {
+        _index[i] = _index[j];
+        i = j;
+      }
+    }
+    _index[i] = 0;
+  }
+
+  void rebuildIndex() {
+    memset(_index, 0, sizeof(_index));
+    for (int s = 0; s < CAPACITY; s++) {
+      if (_state[s] != SLOT_EMPTY) addToIndex(s);
+    }
+  }
+
+public:
+  SeenHashSet() { clearAll(); }
+
+  void clearAll() {
+    memset(_keys, 0, sizeof(_keys));
+    memset(_state, 0, sizeof(_state));
+    memset(_index, 0, sizeof(_index));
+    _hand = 0;
+  }
+
+  /**
+   * \returns  true if 'key' is in the set (and marks it as recently used)
+  */
+  bool lookup(const uint8_t* key) {
+    int pos = findPos(key);
+    if (pos < 0) return false;
+    _state[_index[pos] - 1] = SLOT_REFERENCED;
+    return true;
+  }
+
+  /**
+   * \brief  adds 'key' (which must not already be in the set), evicting another if full
+  */
+  void insert(const uint8_t* key) {
+    int slot;
+    for (;;) {   // advance the CLOCK hand
+      slot = _hand;
+      _hand = (_hand + 1) & (CAPACITY - 1);
+      if (_state[slot] != SLOT_REFERENCED) break;
+      _state[slot] = SLOT_USED;   // second chance
+    }
+    if (_state[slot] != SLOT_EMPTY) {
+      removeFromIndex(findPos(keyAt(slot)));
+    }
+    memcpy(&_keys[slot*KEY_SIZE], key, KEY_SIZE);
+    _state[slot] = SLOT_USED;
+    addToIndex(slot);
+  }
+
+  /**
+   * \returns  true if 'key' was found, and removed
+  */
+  bool remove(const uint8_t* key) {
+    int pos = findPos(key);
+    if (pos < 0) return false;
+    int slot = _index[pos] - 1;
+    removeFromIndex(pos);
+    memset(&_keys[slot*KEY_SIZE], 0, KEY_SIZE);
+    _state[slot] = SLOT_EMPTY;
+    return true;
+  }
+
+  /**
+   * \brief  raw slot storage, CAPACITY keys of KEY_SIZE bytes, all zeros for an empty slot. (for persistence)
+  */
+  uint8_t* getSlots() { return _keys; }
+  int getSlotsSize() const { return sizeof(_keys); }
+  int getHand() const { return _hand; }
+
+  /**
+   * \brief  call after loading getSlots() from storage. All-zero keys are treated as empty.
+  */
+  void restoreSlots(int hand) {
+    for (int s = 0; s < CAPACITY; s++) {
+      const uint8_t* sp = keyAt(s);
+      bool empty = true;
+      for (int j = 0; j < KEY_SIZE && empty; j++) {
+        if (sp[j] != 0) empty = false;
+      }
+      _state[s] = empty ? SLOT_EMPTY : SLOT_USED;
+    }
+    _hand = hand & (CAPACITY - 1);
+    rebuildIndex();
+  }
+};
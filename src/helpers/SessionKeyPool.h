@@ -1,6 +1,7 @@
 #pragma once
 
 #include <MeshCore.h>
+#include <Utils.h>
 #include <string.h>
 
 #define SESSION_STATE_NONE        0
@@ -36,6 +37,15 @@ class SessionKeyPool {
     entry->last_used = ++lru_counter;
   }
 
+  // zeroise an entry, and drop its keys from the Utils caches
+  static void wipe(SessionKeyEntry* entry) {
+    if (entry->state != SESSION_STATE_NONE) {
+      mesh::Utils::forgetKey(entry->session_key, SESSION_KEY_SIZE);
+      mesh::Utils::forgetKey(entry->prev_session_key, SESSION_KEY_SIZE);
+    }
+    memset(entry, 0, sizeof(*entry));
+  }
+
 public:
   SessionKeyPool() : count(0), lru_counter(0), removed_count(0) {
     memset(entries, 0, sizeof(entries));
@@ -86,7 +96,7 @@ public:
       }
     }
     if (evict_idx < 0) evict_idx = 0;  // all INIT_SENT — shouldn't happen, fall back to [0]
-    memset(&entries[evict_idx], 0, sizeof(entries[evict_idx]));
+    wipe(&entries[evict_idx]);
     memcpy(entries[evict_idx].peer_pub_prefix, pub_key, 4);
     touch(&entries[evict_idx]);
     return &entries[evict_idx];
@@ -99,6 +109,7 @@ public:
         if (removed_count < MAX_SESSION_KEYS_RAM) {
           memcpy(removed_prefixes[removed_count++], entries[i].peer_pub_prefix, 4);
         }
+        wipe(&entries[i]);
         // Shift remaining entries down
         count--;
         for (int j = i; j < count; j++) {
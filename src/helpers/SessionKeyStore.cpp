@@ -0,0 +1,261 @@
+#include "SessionKeyStore.h"
+
+// record: [pub_prefix:4][flags:1][nonce:2][session_key:32][prev_session_key:32]
+#define SKS_FLAG_DELETED   0x80   // record deletes the prefix's key (the rest is zeroes)
+
+static_assert(SESSION_KEY_RECORD_SIZE <= RECORD_LOG_MAX_RECORD, "RECORD_LOG_MAX_RECORD too small");
+static_assert(MAX_SESSION_KEYS_FLASH*2 + RECORD_LOG_SLACK < 0xFFFF, "MAX_SESSION_KEYS_FLASH too big");
+
+static File openRead(FILESYSTEM* _fs, const char* filename) {
+  #if defined(RP2040_PLATFORM)
+    return _fs->open(filename, "r");
+  #else
+    return _fs->open(filename);
+  #endif
+}
+
+static void toRecord(uint8_t* rec, const uint8_t* pub_key_prefix, uint8_t flags, uint16_t nonce,
+                     const uint8_t* session_key, const uint8_t* prev_session_key) {
+  memcpy(rec, pub_key_prefix, 4);
+  rec[4] = flags;
+  memcpy(&rec[5], &nonce, 2);
+  memcpy(&rec[7], session_key, SESSION_KEY_SIZE);
+  if (flags & SESSION_FLAG_PREV_VALID) {
+    memcpy(&rec[SESSION_KEY_RECORD_MIN_SIZE], prev_session_key, SESSION_KEY_SIZE);
+  } else {
+    memset(&rec[SESSION_KEY_RECORD_MIN_SIZE], 0, SESSION_KEY_SIZE);
+  }
+}
+
+static void fromRecord(const uint8_t* rec, uint8_t* flags, uint16_t* nonce, uint8_t* session_key, uint8_t* prev_session_key) {
+  *flags = rec[4];
+  memcpy(nonce, &rec[5], 2);
+  memcpy(session_key, &rec[7], SESSION_KEY_SIZE);
+  memcpy(prev_session_key, &rec[SESSION_KEY_RECORD_MIN_SIZE], SESSION_KEY_SIZE);
+}
+
+SessionKeyStore::SessionKeyStore() {
+  num_keys = 0;
+}
+
+int SessionKeyStore::indexOf(const uint8_t* pub_key_prefix) const {
+  for (int i = 0; i < num_keys; i++) {
+    if (memcmp(prefixes[i], pub_key_prefix, 4) == 0) return i;
+  }
+  return -1;
+}
+
+void SessionKeyStore::removeAt(int i) {
+  num_keys--;
+  if (i != num_keys) {
+    memcpy(prefixes[i], prefixes[num_keys], 4);
+    rec_idx[i] = rec_idx[num_keys];
+  }
+}
+
+// rebuilds the index from the log, where a prefix's latest record wins
+void SessionKeyStore::replay() {
+  num_keys = 0;
+  File file = log.openRead();
+  if (!file) return;
+
+  uint8_t rec[SESSION_KEY_RECORD_SIZE];
+  for (uint16_t pos = 0; log.read(file, rec); pos++) {
+    int i = indexOf(rec);
+    if (rec[4] & SKS_FLAG_DELETED) {
+      if (i >= 0) removeAt(i);
+    } else if (i >= 0) {
+      rec_idx[i] = pos;
+    } else if (num_keys < MAX_SESSION_KEYS_FLASH) {
+      memcpy(prefixes[num_keys], rec, 4);
+      rec_idx[num_keys++] = pos;
+    }
+  }
+  file.close();
+}
+
+void SessionKeyStore::begin(FILESYSTEM* fs, const char* path, const char* legacy_path) {
+  log.begin(fs, path, SESSION_KEY_RECORD_SIZE);
+  num_keys = 0;
+
+  if (log.exists()) {
+    replay();
+  } else if (legacy_path && fs->exists(legacy_path)) {
+    migrate(fs, legacy_path);
+  }
+}
+
+// converts the older format: [pub_prefix:4][flags:1][nonce:2][session_key:32][prev_session_key:32 if flags & PREV_VALID]
+void SessionKeyStore::migrate(FILESYSTEM* fs, const char* legacy_path) {
+  File src = openRead(fs, legacy_path);
+  if (!src) return;
+  File dest = log.beginCompact();
+  if (!dest) {
+    src.close();
+    return;
+  }
+
+  bool success = true;
+  uint8_t rec[SESSION_KEY_RECORD_SIZE];
+  while (success && num_keys < MAX_SESSION_KEYS_FLASH && src.read(rec, SESSION_KEY_RECORD_MIN_SIZE) == SESSION_KEY_RECORD_MIN_SIZE) {
+    if (rec[4] & SESSION_FLAG_PREV_VALID) {
+      if (src.read(&rec[SESSION_KEY_RECORD_MIN_SIZE], SESSION_KEY_SIZE) != SESSION_KEY_SIZE) break;
+    } else {
+      memset(&rec[SESSION_KEY_RECORD_MIN_SIZE], 0, SESSION_KEY_SIZE);
+    }
+    if (indexOf(rec) >= 0) continue;   // first record for each prefix wins, same as the old lookup
+
+    int32_t pos = log.append(dest, rec);
+    success = pos >= 0;
+    memcpy(prefixes[num_keys], rec, 4);
+    rec_idx[num_keys++] = pos;
+  }
+  src.close();
+
+  if (log.endCompact(dest, success)) {
+    fs->remove(legacy_path);
+  } else {
+    MESH_DEBUG_PRINTLN("SessionKeyStore: unable to convert %s", legacy_path);
+    num_keys = 0;
+  }
+}
+
+void SessionKeyStore::load(SessionKeyStoreHost* host) {
+  if (num_keys == 0) return;
+  File file = log.openRead();
+  if (!file) return;
+
+  // in log order, so no seeking. Superseded records are skipped
+  uint8_t rec[SESSION_KEY_RECORD_SIZE];
+  for (uint16_t pos = 0; log.read(file, rec); pos++) {
+    int i = indexOf(rec);
+    if (i < 0 || rec_idx[i] != pos) continue;
+
+    uint8_t flags;
+    uint16_t nonce;
+    uint8_t session_key[SESSION_KEY_SIZE], prev_session_key[SESSION_KEY_SIZE];
+    fromRecord(rec, &flags, &nonce, session_key, prev_session_key);
+    host->onSessionKeyLoaded(prefixes[i], flags, nonce, session_key, prev_session_key);
+  }
+  file.close();
+}
+
+bool SessionKeyStore::find(const uint8_t* pub_key_prefix, uint8_t* flags, uint16_t* nonce, uint8_t* session_key, uint8_t* prev_session_key) {
+  int i = indexOf(pub_key_prefix);
+  if (i < 0) return false;   // not stored, no need to touch flash
+
+  File file = log.openRead();
+  if (!file) return false;
+
+  uint8_t rec[SESSION_KEY_RECORD_SIZE];
+  bool success = log.readAt(file, rec_idx[i], rec);
+  file.close();
+
+  if (success) fromRecord(rec, flags, nonce, session_key, prev_session_key);
+  return success;
+}
+
+bool SessionKeyStore::save(SessionKeyStoreHost* host) {
+  // the host's persistable keys
+  uint8_t keys[MAX_SESSION_KEYS_RAM][SESSION_KEY_RECORD_SIZE];
+  int n = 0;
+  for (int idx = 0; idx < MAX_SESSION_KEYS_RAM; idx++) {
+    uint8_t prefix[4], flags; uint16_t nonce;
+    uint8_t session_key[SESSION_KEY_SIZE], prev_session_key[SESSION_KEY_SIZE];
+    if (!host->getSessionKeyForSave(idx, prefix, &flags, &nonce, session_key, prev_session_key)) continue;
+    toRecord(keys[n], prefix, flags & ~SKS_FLAG_DELETED, nonce, session_key, prev_session_key);
+    n++;
+  }
+
+  File src = log.openRead();
+  uint8_t rec[SESSION_KEY_RECORD_SIZE];
+  uint8_t deleted[MAX_SESSION_KEYS_FLASH + MAX_SESSION_KEYS_RAM][4];
+  int num_deleted = 0;
+
+  // 1. delete removed keys, and those in RAM which aren't to be persisted
+  for (int i = num_keys - 1; i >= 0; i--) {
+    bool is_saving = false;
+    for (int k = 0; k < n && !is_saving; k++) is_saving = memcmp(keys[k], prefixes[i], 4) == 0;
+    if (is_saving || !(host->isSessionKeyRemoved(prefixes[i]) || host->isSessionKeyInRAM(prefixes[i]))) continue;
+
+    memcpy(deleted[num_deleted++], prefixes[i], 4);
+    removeAt(i);
+  }
+
+  // 2. the host's keys which are new or have changed
+  int8_t changed[MAX_SESSION_KEYS_FLASH];   // per index entry, the key in 'keys' to write, or -1
+  memset(changed, -1, sizeof(changed));
+  int num_changed = 0;
+  for (int k = 0; k < n; k++) {
+    int i = indexOf(keys[k]);
+    if (i >= 0) {
+      if (src && log.readAt(src, rec_idx[i], rec) && memcmp(rec, keys[k], SESSION_KEY_RECORD_SIZE) == 0) {
+        continue;   // unchanged
+      }
+    } else if (num_keys < MAX_SESSION_KEYS_FLASH) {
+      i = num_keys++;
+      memcpy(prefixes[i], keys[k], 4);
+    } else {
+      // full, replace a key which isn't in RAM
+      for (int j = 0; j < num_keys && i < 0; j++) {
+        if (changed[j] < 0 && !host->isSessionKeyInRAM(prefixes[j])) i = j;
+      }
+      if (i < 0) continue;
+      memcpy(deleted[num_deleted++], prefixes[i], 4);
+      memcpy(prefixes[i], keys[k], 4);
+    }
+    changed[i] = k;
+    num_changed++;
+  }
+
+  if (num_deleted == 0 && num_changed == 0) {
+    if (src) src.close();
+    return true;
+  }
+
+  bool success = true;
+  if (log.shouldCompact(num_keys)) {
+    // write just the current keys, to a new log
+    File dest = log.beginCompact();
+    success = dest;
+    for (int i = 0; i < num_keys && success; i++) {
+      const uint8_t* r = rec;
+      if (changed[i] >= 0) {
+        r = keys[changed[i]];
+      } else {
+        success = src && log.readAt(src, rec_idx[i], rec);
+      }
+      success = success && log.append(dest, r) == i;
+    }
+    if (src) src.close();
+    if (dest) {
+      success = log.endCompact(dest, success);
+    }
+    if (success) {
+      for (int i = 0; i < num_keys; i++) rec_idx[i] = i;
+    }
+  } else {
+    if (src) src.close();
+    File dest = log.openAppend();
+    success = dest;
+    memset(rec, 0, sizeof(rec));
+    rec[4] = SKS_FLAG_DELETED;
+    for (int d = 0; d < num_deleted && success; d++) {
+      memcpy(rec, deleted[d], 4);
+      success = log.append(dest, rec) >= 0;
+    }
+    for (int i = 0; i < num_keys && success; i++) {
+      if (changed[i] < 0) continue;
+      int32_t pos = log.append(dest, keys[changed[i]]);
+      success = pos >= 0;
+      rec_idx[i] = pos;
+    }
+    if (dest) dest.close();
+  }
+
+  if (!success) {
+    MESH_DEBUG_PRINTLN("SessionKeyStore::save() failed");
+    replay();   // back to what's in the log
+  }
+  return success;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>   // needed for PlatformIO
+#include <MeshCore.h>
+#include <helpers/IdentityStore.h>
+#include <helpers/RecordLog.h>
+
+/**
+ * \brief  The owner of the session keys in RAM (eg. a SessionKeyPool), as seen by SessionKeyStore.
+*/
+class SessionKeyStoreHost {
+public:
+  virtual bool onSessionKeyLoaded(const uint8_t* pub_key_prefix, uint8_t flags, uint16_t nonce,
+                                   const uint8_t* session_key, const uint8_t* prev_session_key) { return false; }
+  virtual bool getSessionKeyForSave(int idx, uint8_t* pub_key_prefix, uint8_t* flags, uint16_t* nonce,
+                                     uint8_t* session_key, uint8_t* prev_session_key) { return false; }
+  virtual bool isSessionKeyInRAM(const uint8_t* pub_key_prefix) { return false; }
+  virtual bool isSessionKeyRemoved(const uint8_t* pub_key_prefix) { return false; }
+};
+
+/**
+ * \brief  Session keys in flash, as a RecordLog of fixed size records: a changed key is appended, and a deleted key
+ *        gets a 'deleted' record. The position of each prefix's latest record is kept in RAM, so looking up a prefix
+ *        takes one seek and read (and none if it isn't stored). Files in the older format (variable length records,
+ *        rewritten on every save) are converted by begin().
+*/
+class SessionKeyStore {
+  RecordLog log;
+  uint8_t prefixes[MAX_SESSION_KEYS_FLASH][4];
+  uint16_t rec_idx[MAX_SESSION_KEYS_FLASH];
+  int num_keys;
+
+  int indexOf(const uint8_t* pub_key_prefix) const;
+  void removeAt(int i);
+  void replay();
+  void migrate(FILESYSTEM* fs, const char* legacy_path);
+
+public:
+  SessionKeyStore();
+
+  /**
+   * \param  path  the log file
+   * \param  legacy_path  (optional) a file in the older format, converted to 'path' then removed
+  */
+  void begin(FILESYSTEM* fs, const char* path, const char* legacy_path=NULL);
+
+  int getCount() const { return num_keys; }
+  bool has(const uint8_t* pub_key_prefix) const { return indexOf(pub_key_prefix) >= 0; }
+
+  /**
+   * \brief  calls host->onSessionKeyLoaded() for every stored key
+  */
+  void load(SessionKeyStoreHost* host);
+
+  /**
+   * \brief  reads the stored key for a pub_key prefix
+   * \returns  false if not stored
+  */
+  bool find(const uint8_t* pub_key_prefix, uint8_t* flags, uint16_t* nonce, uint8_t* session_key, uint8_t* prev_session_key);
+
+  /**
+   * \brief  merges the host's keys into the file: its persistable keys are appended (only those which have changed),
+   *      and keys it has removed, or holds in a state which isn't persisted (eg. pending negotiation), are deleted.
+   *      When full, keys not in RAM are dropped. The log is compacted first, once it has grown enough.
+  */
+  bool save(SessionKeyStoreHost* host);
+};
@@ -1,86 +1,201 @@
 #include "StaticPoolPacketManager.h"
 
 PacketQueue::PacketQueue(int max_entries) {
-  _table = new mesh::Packet*[max_entries];
-  _pri_table = new uint8_t[max_entries];
-  _schedule_table = new uint32_t[max_entries];
+  _table = new Entry[max_entries];
   _size = max_entries;
-  _num = 0;
+  _num = _num_ready = 0;
+  _next_seq = 0;
 }
 
-int PacketQueue::countBefore(uint32_t now) const {
-  int n = 0;
-  for (int j = 0; j < _num; j++) {
-    if ((int32_t)(_schedule_table[j] - now) > 0) continue;   // scheduled for future... ignore for now
-    n++;
+bool PacketQueue::isBefore(bool ready, const Entry* a, const Entry* b) {
+  if (ready) {
+    if (a->priority != b->priority) return a->priority < b->priority;
+  } else {
+    int32_t d = (int32_t)(a->scheduled_for - b->scheduled_for);
+    if (d != 0) return d < 0;
   }
-  return n;
+  return (int32_t)(a->seq - b->seq) < 0;   // FIFO for equal keys
 }
 
-mesh::Packet* PacketQueue::get(uint32_t now) {
-  uint8_t min_pri = 0xFF;
-  int best_idx = -1;
-  for (int j = 0; j < _num; j++) {
-    if ((int32_t)(_schedule_table[j] - now) > 0) continue;   // scheduled for future... ignore for now
-    if (_pri_table[j] < min_pri) {  // select most important priority amongst non-future entries
-      min_pri = _pri_table[j];
-      best_idx = j;
-    }
+void PacketQueue::siftUp(bool ready, int k) const {
+  Entry e = *slot(ready, k);
+  while (k > 0) {
+    int parent = (k - 1) >> 1;
+    if (!isBefore(ready, &e, slot(ready, parent))) break;
+    *slot(ready, k) = *slot(ready, parent);
+    k = parent;
+  }
+  *slot(ready, k) = e;
+}
+
+void PacketQueue::siftDown(bool ready, int k, int n) const {
+  Entry e = *slot(ready, k);
+  for (;;) {
+    int child = (k << 1) + 1;
+    if (child >= n) break;
+    if (child + 1 < n && isBefore(ready, slot(ready, child + 1), slot(ready, child))) child++;
+    if (!isBefore(ready, slot(ready, child), &e)) break;
+    *slot(ready, k) = *slot(ready, child);
+    k = child;
   }
-  if (best_idx < 0) return NULL;   // empty, or all items are still in the future
+  *slot(ready, k) = e;
+}
 
-  mesh::Packet* top = _table[best_idx];
-  int i = best_idx;
-  _num--;
-  while (i < _num) {
-    _table[i] = _table[i+1];
-    _pri_table[i] = _pri_table[i+1];
-    _schedule_table[i] = _schedule_table[i+1];
-    i++;
+// remove entry 'k' of a heap currently holding 'n' entries
+void PacketQueue::popHeap(bool ready, int k, int n, Entry* dest) const {
+  *dest = *slot(ready, k);
+  n--;
+  if (k < n) {
+    *slot(ready, k) = *slot(ready, n);   // move last entry into the hole
+    siftDown(ready, k, n);
+    siftUp(ready, k);
   }
-  return top;
 }
 
-mesh::Packet* PacketQueue::removeByIdx(int i) {
-  if (i >= _num) return NULL;  // invalid index
+void PacketQueue::promote(uint32_t now) const {
+  while (_num_ready < _num) {
+    Entry* top = slot(false, 0);
+    if ((int32_t)(top->scheduled_for - now) > 0) break;   // earliest pending is still in the future
+
+    Entry e;
+    popHeap(false, 0, _num - _num_ready, &e);
+    *slot(true, _num_ready) = e;
+    siftUp(true, _num_ready++);
+  }
+}
+
+int PacketQueue::countBefore(uint32_t now) const {
+  promote(now);
+  return _num_ready;
+}
+
+int PacketQueue::nextDueIn(uint32_t now) const {
+  if (_num_ready > 0) return 0;
+  if (_num == 0) return -1;
+  int32_t d = (int32_t)(slot(false, 0)->scheduled_for - now);
+  return d > 0 ? d : 0;
+}
 
-  mesh::Packet* item = _table[i];
+mesh::Packet* PacketQueue::get(uint32_t now) {
+  promote(now);
+  if (_num_ready == 0) return NULL;   // empty, or all items are still in the future
+
+  Entry e;
+  popHeap(true, 0, _num_ready, &e);
+  _num_ready--;
   _num--;
-  while (i < _num) {
-    _table[i] = _table[i+1];
-    _pri_table[i] = _pri_table[i+1];
-    _schedule_table[i] = _schedule_table[i+1];
-    i++;
+  return e.packet;
+}
+
+mesh::Packet* PacketQueue::itemAt(int i) const {
+  if (i < 0 || i >= _num) return NULL;
+  return i < _num_ready ? slot(true, i)->packet : slot(false, i - _num_ready)->packet;
+}
+
+mesh::Packet* PacketQueue::removeByIdx(int i) {
+  if (i < 0 || i >= _num) return NULL;  // invalid index
+
+  Entry e;
+  if (i < _num_ready) {
+    popHeap(true, i, _num_ready, &e);
+    _num_ready--;
+  } else {
+    popHeap(false, i - _num_ready, _num - _num_ready, &e);
   }
-  return item;
+  _num--;
+  return e.packet;
 }
 
 bool PacketQueue::add(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) {
   if (_num == _size) {
     return false;
   }
-  _table[_num] = packet;
-  _pri_table[_num] = priority;
-  _schedule_table[_num] = scheduled_for;
+  Entry* e = slot(false, _num - _num_ready);   // new pending entry
+  e->packet = packet;
+  e->priority = priority;
+  e->scheduled_for = scheduled_for;
+  e->seq = _next_seq++;
   _num++;
+  siftUp(false, _num - _num_ready - 1);
   return true;
 }
 
-StaticPoolPacketManager::StaticPoolPacketManager(int pool_size): unused(pool_size), send_queue(pool_size), rx_queue(pool_size) {
+StaticPoolPacketManager::StaticPoolPacketManager(int pool_size): send_queue(pool_size), rx_queue(pool_size) {
+  _pool = new mesh::Packet[pool_size];
+  _free_stack = new mesh::Packet*[pool_size];
+  _pool_size = pool_size;
   // load up our unusued Packet pool
   for (int i = 0; i < pool_size; i++) {
-    unused.add(new mesh::Packet(), 0, 0);
+    _free_stack[i] = &_pool[pool_size - 1 - i];   // so first alloc is _pool[0]
   }
+  _num_free = _min_free = pool_size;
+#if MESH_DEBUG
+  _alloc_seq = new uint32_t[pool_size];
+  memset(_alloc_seq, 0, sizeof(uint32_t) * pool_size);
+  _num_allocs = 0;
+#endif
 }
 
 mesh::Packet* StaticPoolPacketManager::allocNew() {
-  return unused.removeByIdx(0);  // just get first one (returns NULL if empty)
+  if (_num_free == 0) {
+#if MESH_DEBUG
+    checkLeaks();
+#endif
+    return NULL;
+  }
+  mesh::Packet* packet = _free_stack[--_num_free];
+  if (_num_free < _min_free) _min_free = _num_free;
+#if MESH_DEBUG
+  if (++_num_allocs == 0) _num_allocs = 1;   // zero means 'free'
+  _alloc_seq[packet - _pool] = _num_allocs;
+#endif
+  return packet;
 }
 
 void StaticPoolPacketManager::free(mesh::Packet* packet) {
-  unused.add(packet, 0, 0);
+#if MESH_DEBUG
+  int idx = packet - _pool;
+  if (packet < _pool || idx >= _pool_size) {
+    MESH_DEBUG_PRINTLN("StaticPoolPacketManager::free(): ERROR: packet %p is not from this pool!", packet);
+    return;
+  }
+  if (_alloc_seq[idx] == 0) {
+    MESH_DEBUG_PRINTLN("StaticPoolPacketManager::free(): ERROR: double free of packet #%d!", idx);
+    return;
+  }
+  _alloc_seq[idx] = 0;
+#endif
+  if (_num_free < _pool_size) {
+    _free_stack[_num_free++] = packet;
+  }
+}
+
+#if MESH_DEBUG
+bool StaticPoolPacketManager::isQueued(const mesh::Packet* packet) const {
+  for (int i = 0; i < send_queue.count(); i++) {
+    if (send_queue.itemAt(i) == packet) return true;
+  }
+  for (int i = 0; i < rx_queue.count(); i++) {
+    if (rx_queue.itemAt(i) == packet) return true;
+  }
+  return false;
 }
 
+int StaticPoolPacketManager::checkLeaks(uint32_t max_age) const {
+  int n = 0;
+  for (int i = 0; i < _pool_size; i++) {
+    if (_alloc_seq[i] == 0) continue;   // free
+    uint32_t age = _num_allocs - _alloc_seq[i];
+    if (age > max_age && !isQueued(&_pool[i])) {
+      MESH_DEBUG_PRINTLN("StaticPoolPacketManager: possible leak, packet #%d (type=%d) held for %u allocs",
+          i, (uint32_t)_pool[i].getPayloadType(), age);
+      n++;
+    }
+  }
+  return n;
+}
+#endif
+
 void StaticPoolPacketManager::queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) {
   if (!send_queue.add(packet, priority, scheduled_for)) {
     MESH_DEBUG_PRINTLN("queueOutbound: send queue full, dropping packet");
@@ -97,8 +212,16 @@ int  StaticPoolPacketManager::getOutboundCount(uint32_t now) const {
   return send_queue.countBefore(now);
 }
 
+int StaticPoolPacketManager::getOutboundTotal() const {
+  return send_queue.count();
+}
+
+int StaticPoolPacketManager::getOutboundDueIn(uint32_t now) const {
+  return send_queue.nextDueIn(now);
+}
+
 int StaticPoolPacketManager::getFreeCount() const {
-  return unused.count();
+  return _num_free;
 }
 
 mesh::Packet* StaticPoolPacketManager::getOutboundByIdx(int i) {
@@ -117,3 +240,6 @@ void StaticPoolPacketManager::queueInbound(mesh::Packet* packet, uint32_t schedu
 mesh::Packet* StaticPoolPacketManager::getNextInbound(uint32_t now) {
   return rx_queue.get(now);
 }
+int StaticPoolPacketManager::getInboundDueIn(uint32_t now) const {
+  return rx_queue.nextDueIn(now);
+}
@@ -2,36 +2,103 @@
 
 #include <Dispatcher.h>
 
+/**
+ * \brief  Queue of packets keyed on (scheduled_for, priority). Entries wait in a 'pending' min-heap ordered by
+ *        schedule time, and are promoted to a 'ready' min-heap ordered by priority once due. Both heaps share one
+ *        table: ready grows up from the front, pending grows down from the back.
+ *        Ties are broken by insertion order, so equal priorities come out FIFO.
+ *        Costs: add() and get() O(log n), countBefore() O(1) (plus any promotions), nextDueIn() O(1).
+*/
 class PacketQueue {
-  mesh::Packet** _table;
-  uint8_t* _pri_table;
-  uint32_t* _schedule_table;
+  struct Entry {
+    mesh::Packet* packet;
+    uint32_t scheduled_for;
+    uint32_t seq;
+    uint8_t priority;
+  };
+  mutable Entry* _table;
   int _size, _num;
+  mutable int _num_ready;
+  uint32_t _next_seq;
+
+  Entry* slot(bool ready, int k) const { return ready ? &_table[k] : &_table[_size - 1 - k]; }
+  static bool isBefore(bool ready, const Entry* a, const Entry* b);
+  void siftUp(bool ready, int k) const;
+  void siftDown(bool ready, int k, int n) const;
+  void popHeap(bool ready, int k, int n, Entry* dest) const;
+  void promote(uint32_t now) const;
 
 public:
   PacketQueue(int max_entries);
   mesh::Packet* get(uint32_t now);
   bool add(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for);
   int count() const { return _num; }
+
+  /**
+   * \returns  number of entries due at 'now'. NOTE: entries due are promoted, so 'now' must be the current time
+   *          (use count() for everything queued)
+  */
   int countBefore(uint32_t now) const;
-  mesh::Packet* itemAt(int i) const { return _table[i]; }
+
+  /**
+   * \returns  millis until the next entry is due (0 if one is due already), or -1 if empty
+  */
+  int nextDueIn(uint32_t now) const;
+
+  mesh::Packet* itemAt(int i) const;
   mesh::Packet* removeByIdx(int i);
 };
 
+#ifndef POOL_LEAK_ALLOC_AGE
+  #define POOL_LEAK_ALLOC_AGE   256   // (MESH_DEBUG) held outside the queues for this many allocations => suspected leak
+#endif
+
+/**
+ * \brief  Fixed pool of Packets. Free packets are kept on a stack, so allocNew() and free() are O(1).
+ *        With MESH_DEBUG, free() rejects double-frees and foreign pointers, and running out of packets reports
+ *        suspected leaks (see checkLeaks()).
+*/
 class StaticPoolPacketManager : public mesh::PacketManager {
-  PacketQueue unused, send_queue, rx_queue;
+  mesh::Packet* _pool;
+  mesh::Packet** _free_stack;
+  int _pool_size, _num_free, _min_free;
+  PacketQueue send_queue, rx_queue;
+#if MESH_DEBUG
+  uint32_t* _alloc_seq;     // per packet: _num_allocs at allocation, or 0 when free
+  uint32_t _num_allocs;
+
+  bool isQueued(const mesh::Packet* packet) const;
+#endif
 
 public:
   StaticPoolPacketManager(int pool_size);
 
+  /**
+   * \returns  the most packets that have been in use at once (since construction, or resetMaxInUse())
+  */
+  int getMaxInUse() const { return _pool_size - _min_free; }
+  void resetMaxInUse() { _min_free = _num_free; }
+
+#if MESH_DEBUG
+  /**
+   * \brief  reports packets which are allocated, but have sat outside the send/receive queues for 'max_age' allocations.
+   *         (packets legitimately held, eg. Dispatcher's outbound, are young, so won't show)
+   * \returns  number of suspected leaks
+  */
+  int checkLeaks(uint32_t max_age = POOL_LEAK_ALLOC_AGE) const;
+#endif
+
   mesh::Packet* allocNew() override;
   void free(mesh::Packet* packet) override;
   void queueOutbound(mesh::Packet* packet, uint8_t priority, uint32_t scheduled_for) override;
   mesh::Packet* getNextOutbound(uint32_t now) override;
   int getOutboundCount(uint32_t now) const override;
+  int getOutboundTotal() const override;
+  int getOutboundDueIn(uint32_t now) const override;
   int getFreeCount() const override;
   mesh::Packet* getOutboundByIdx(int i) override;
   mesh::Packet* removeOutboundByIdx(int i) override;
   void queueInbound(mesh::Packet* packet, uint32_t scheduled_for) override;
   mesh::Packet* getNextInbound(uint32_t now) override;
+  int getInboundDueIn(uint32_t now) const override;
 };
\ No newline at end of file
@@ -1,14 +1,16 @@
 #include "TransportKeyStore.h"
 #include <SHA256.h>
 
+#define DEFAULT_KEYS_PATH  "/transport_keys"
+
 uint16_t TransportKey::calcTransportCode(const mesh::Packet* packet) const {
   uint16_t code;
-  SHA256 sha;
-  sha.resetHMAC(key, sizeof(key));
   uint8_t type = packet->getPayloadType();
-  sha.update(&type, 1);
-  sha.update(packet->payload, packet->payload_len);
-  sha.finalizeHMAC(key, sizeof(key), &code, 2);
+  mesh::Utils::hmacSHA256((uint8_t *) &code, 2, key, sizeof(key), &type, 1, packet->payload, packet->payload_len);
+  return toTransportCode(code);
+}
+
+uint16_t TransportKey::toTransportCode(uint16_t code) {
   if (code == 0) {     // reserve codes 0000 and FFFF
     code++;
   } else if (code == 0xFFFF) {
@@ -24,69 +26,219 @@ bool TransportKey::isNull() const {
   return true;  // key is all zeroes
 }
 
-void TransportKeyStore::putCache(uint16_t id, const TransportKey& key) {
-  if (num_cache < MAX_TKS_ENTRIES) {
-    cache_ids[num_cache] = id;
-    cache_keys[num_cache] = key;
-    num_cache++;
-  } else {
-    // TODO: evict oldest cache entry
+static File openRead(FILESYSTEM* _fs, const char* filename) {
+  #if defined(RP2040_PLATFORM)
+    return _fs->open(filename, "r");
+  #else
+    return _fs->open(filename);
+  #endif
+}
+
+static File openWrite(FILESYSTEM* _fs, const char* filename) {
+  #if defined(NRF52_PLATFORM) || defined(STM32_PLATFORM)
+    _fs->remove(filename);
+    return _fs->open(filename, FILE_O_WRITE);
+  #elif defined(RP2040_PLATFORM)
+    return _fs->open(filename, "w");
+  #else
+    return _fs->open(filename, "w", true);
+  #endif
+}
+
+TransportKeyStore::TransportKeyStore() {
+  _fs = NULL;
+  _path = DEFAULT_KEYS_PATH;
+  version = 0;
+  cache_tick = 0;
+  memset(cache, 0, sizeof(cache));
+}
+
+void TransportKeyStore::begin(FILESYSTEM* fs, const char* path) {
+  _fs = fs;
+  _path = path ? path : DEFAULT_KEYS_PATH;
+  invalidateCache();
+}
+
+TransportKeyStore::CacheEntry* TransportKeyStore::getCache(uint16_t id) {
+  for (int i = 0; i < MAX_TKS_ENTRIES; i++) {
+    auto e = &cache[i];
+    if (e->in_use && e->id == id) {
+      e->last_used = ++cache_tick;
+      return e;
+    }
   }
+  return NULL;  // not cached
 }
 
-void TransportKeyStore::getAutoKeyFor(uint16_t id, const char* name, TransportKey& dest) {
-  for (int i = 0; i < num_cache; i++) {  // first, check cache
-    if (cache_ids[i] == id) {   // cache hit!
-      dest = cache_keys[i];
-      return;
+void TransportKeyStore::putCache(uint16_t id, const TransportKey keys[], int num) {
+  CacheEntry* oldest = &cache[0];
+  for (int i = 0; i < MAX_TKS_ENTRIES; i++) {
+    auto e = &cache[i];
+    if (e->in_use && e->id == id) { oldest = e; break; }   // replace existing
+    if (!e->in_use || (oldest->in_use && e->last_used < oldest->last_used)) oldest = e;
+  }
+  if (num > MAX_TKS_KEYS_PER_ID) num = MAX_TKS_KEYS_PER_ID;
+
+  oldest->id = id;
+  oldest->num_keys = num;
+  memcpy(oldest->keys, keys, num * sizeof(TransportKey));
+  oldest->in_use = true;
+  oldest->last_used = ++cache_tick;
+}
+
+void TransportKeyStore::invalidateCache(uint16_t id) {
+  for (int i = 0; i < MAX_TKS_ENTRIES; i++) {
+    if (cache[i].in_use && cache[i].id == id) {
+      memset(&cache[i], 0, sizeof(cache[i]));
     }
   }
+  version++;
+}
+
+void TransportKeyStore::invalidateCache() {
+  memset(cache, 0, sizeof(cache));
+  version++;
+}
+
+void TransportKeyStore::getAutoKeyFor(uint16_t id, const char* name, TransportKey& dest) {
+  auto e = getCache(id);
+  if (e && e->num_keys > 0) {   // cache hit!
+    dest = e->keys[0];
+    return;
+  }
   // calc key for publicly-known hashtag region name
   SHA256 sha;
   sha.update(name, strlen(name));
   sha.finalize(&dest.key, sizeof(dest.key));
 
-  putCache(id, dest);
+  putCache(id, &dest, 1);
 }
 
-int TransportKeyStore::loadKeysFor(uint16_t id, TransportKey keys[], int max_num) {
+int TransportKeyStore::readKeysFor(uint16_t id, TransportKey keys[], int max_num) {
   int n = 0;
-  for (int i = 0; i < num_cache && n < max_num; i++) {  // first, check cache
-    if (cache_ids[i] == id) {
-      keys[n++] = cache_keys[i];
+  if (_fs && _fs->exists(_path)) {
+    File file = openRead(_fs, _path);
+    if (file) {
+      uint16_t rec_id;
+      TransportKey key;
+      while (n < max_num && file.read((uint8_t *) &rec_id, sizeof(rec_id)) == sizeof(rec_id)
+          && file.read(key.key, sizeof(key.key)) == sizeof(key.key)) {
+        if (rec_id == id) keys[n++] = key;
+      }
+      file.close();
     }
   }
-  if (n > 0) return n;   // cache hit!
-
-  // TODO:  retrieve from difficult-to-copy keystore
+  return n;
+}
 
-  // store in cache (if room)
-  for (int i = 0; i < n; i++) {
-    putCache(id, keys[i]);
+int TransportKeyStore::loadKeysFor(uint16_t id, TransportKey keys[], int max_num) {
+  auto e = getCache(id);
+  if (e == NULL) {   // not cached, read from file (and cache, even if no keys)
+    TransportKey tmp[MAX_TKS_KEYS_PER_ID];
+    int num = readKeysFor(id, tmp, MAX_TKS_KEYS_PER_ID);
+    putCache(id, tmp, num);
+    e = getCache(id);
   }
+  int n = e->num_keys < max_num ? e->num_keys : max_num;
+  memcpy(keys, e->keys, n * sizeof(TransportKey));
   return n;
 }
 
-bool TransportKeyStore::saveKeysFor(uint16_t id, const TransportKey keys[], int num) {
-  invalidateCache();
+// writes a new keys file: all other ids' records from the current file, then the given keys for 'id'
+bool TransportKeyStore::rewriteKeys(uint16_t id, const TransportKey keys[], int num) {
+  if (_fs == NULL) return false;
+
+  char tmp_path[40];
+  sprintf(tmp_path, "%s.tmp", _path);
+  File out = openWrite(_fs, tmp_path);
+  if (!out) return false;
+
+  bool success = true;
+  if (_fs->exists(_path)) {
+    File in = openRead(_fs, _path);
+    if (in) {
+      uint16_t rec_id;
+      TransportKey key;
+      while (success && in.read((uint8_t *) &rec_id, sizeof(rec_id)) == sizeof(rec_id)
+          && in.read(key.key, sizeof(key.key)) == sizeof(key.key)) {
+        if (rec_id == id) continue;   // being replaced
+        success = out.write((uint8_t *) &rec_id, sizeof(rec_id)) == sizeof(rec_id);
+        success = success && out.write(key.key, sizeof(key.key)) == sizeof(key.key);
+      }
+      in.close();
+    }
+  }
+  for (int i = 0; success && i < num; i++) {
+    success = out.write((uint8_t *) &id, sizeof(id)) == sizeof(id);
+    success = success && out.write(keys[i].key, sizeof(keys[i].key)) == sizeof(keys[i].key);
+  }
+  out.close();
+
+  if (success) {
+    _fs->remove(_path);
+    success = _fs->rename(tmp_path, _path);
+  } else {
+    _fs->remove(tmp_path);
+    MESH_DEBUG_PRINTLN("ERROR: TransportKeyStore write failed");
+  }
+  return success;
+}
 
-  // TODO: update hardware keystore
+bool TransportKeyStore::saveKeysFor(uint16_t id, const TransportKey keys[], int num) {
+  if (num > MAX_TKS_KEYS_PER_ID) return false;
 
-  return false;  // failed
+  bool success = rewriteKeys(id, keys, num);
+  invalidateCache(id);
+  return success;
 }
 
 bool TransportKeyStore::removeKeys(uint16_t id) {
-  invalidateCache();
+  bool success = rewriteKeys(id, NULL, 0);
+  invalidateCache(id);
+  return success;
+}
 
-  // TODO: remove from hardware keystore
+bool TransportKeyStore::retainKeys(const uint16_t ids[], int num_ids) {
+  if (_fs == NULL || !_fs->exists(_path)) return true;   // nothing stored
+
+  char tmp_path[40];
+  sprintf(tmp_path, "%s.tmp", _path);
+  File out = openWrite(_fs, tmp_path);
+  if (!out) return false;
+
+  bool success = true;
+  int num_dropped = 0;
+  File in = openRead(_fs, _path);
+  if (in) {
+    uint16_t rec_id;
+    TransportKey key;
+    while (success && in.read((uint8_t *) &rec_id, sizeof(rec_id)) == sizeof(rec_id)
+        && in.read(key.key, sizeof(key.key)) == sizeof(key.key)) {
+      int i = 0;
+      while (i < num_ids && ids[i] != rec_id) i++;
+      if (i >= num_ids) {   // orphaned
+        num_dropped++;
+        continue;
+      }
+      success = out.write((uint8_t *) &rec_id, sizeof(rec_id)) == sizeof(rec_id);
+      success = success && out.write(key.key, sizeof(key.key)) == sizeof(key.key);
+    }
+    in.close();
+  }
+  out.close();
 
-  return false;  // failed
+  if (success && num_dropped > 0) {
+    _fs->remove(_path);
+    success = _fs->rename(tmp_path, _path);
+    invalidateCache();
+  } else {
+    _fs->remove(tmp_path);   // unchanged, or failed
+    if (!success) MESH_DEBUG_PRINTLN("ERROR: TransportKeyStore write failed");
+  }
+  return success;
 }
 
 bool TransportKeyStore::clear() {
   invalidateCache();
-
-  // TODO: clear hardware keystore
-
-  return false;  // failed
+  return _fs != NULL && (!_fs->exists(_path) || _fs->remove(_path));
 }
@@ -9,23 +9,65 @@ struct TransportKey {
 
   uint16_t calcTransportCode(const mesh::Packet* packet) const;
   bool isNull() const;
+
+  /**
+   * \brief  maps the leading bytes of the HMAC to a transport code (codes 0000 and FFFF are reserved)
+  */
+  static uint16_t toTransportCode(uint16_t code);
 };
 
-#define MAX_TKS_ENTRIES   16
+#ifndef MAX_TKS_ENTRIES
+  #define MAX_TKS_ENTRIES   16     // region ids whose keys are kept in RAM
+#endif
+
+#define MAX_TKS_KEYS_PER_ID   4
 
+/**
+ * \brief  Transport keys by region id. Auto (hashtag) region keys are derived from the name, private region keys are
+ *        stored in a file of (id, key) records. Recently used ids' keys are kept decoded in an LRU cache.
+*/
 class TransportKeyStore {
-  uint16_t     cache_ids[MAX_TKS_ENTRIES];
-  TransportKey cache_keys[MAX_TKS_ENTRIES];
-  int num_cache;
+  struct CacheEntry {
+    uint16_t id;
+    uint8_t num_keys;     // can be zero, ie. no keys stored for this id
+    bool in_use;
+    uint32_t last_used;
+    TransportKey keys[MAX_TKS_KEYS_PER_ID];
+  };
+  CacheEntry cache[MAX_TKS_ENTRIES];
+  uint32_t cache_tick;
+  uint16_t version;
+  FILESYSTEM* _fs;
+  const char* _path;
 
-  void putCache(uint16_t id, const TransportKey& key);
-  void invalidateCache() { num_cache = 0; }
+  CacheEntry* getCache(uint16_t id);
+  void putCache(uint16_t id, const TransportKey keys[], int num);
+  void invalidateCache(uint16_t id);
+  void invalidateCache();
+  int readKeysFor(uint16_t id, TransportKey keys[], int max_num);
+  bool rewriteKeys(uint16_t id, const TransportKey keys[], int num);
 
 public:
-  TransportKeyStore() { num_cache = 0; }
+  TransportKeyStore();
+
+  /**
+   * \brief  enables the private keys file. (without it, only auto keys are available)
+  */
+  void begin(FILESYSTEM* fs, const char* path=NULL);
+
+  /**
+   * \brief  changes whenever stored keys may have changed, so users holding keys (eg. RegionMap) know to reload them
+  */
+  uint16_t getVersion() const { return version; }
+
   void getAutoKeyFor(uint16_t id, const char* name, TransportKey& dest);
   int loadKeysFor(uint16_t id, TransportKey keys[], int max_num);
   bool saveKeysFor(uint16_t id, const TransportKey keys[], int num);
   bool removeKeys(uint16_t id);
+
+  /**
+   * \brief  removes the stored keys of every id NOT in 'ids' (eg. private regions dropped by a 'region load')
+  */
+  bool retainKeys(const uint16_t ids[], int num_ids);
   bool clear();
 };
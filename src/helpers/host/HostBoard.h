@@ -0,0 +1,21 @@
+#pragma once
+
+#include <MeshCore.h>
+#include <stdlib.h>
+
+/**
+ * \brief  MainBoard for a Linux host: mains powered, no GPIO, and reboot just exits the process.
+*/
+class HostBoard : public mesh::MainBoard {
+  float _adc_mult;
+public:
+  HostBoard() { _adc_mult = 0.0f; }
+
+  uint16_t getBattMilliVolts() override { return 4200; }
+  bool setAdcMultiplier(float multiplier) override { _adc_mult = multiplier; return true; }
+  float getAdcMultiplier() const override { return _adc_mult; }
+  const char* getManufacturerName() const override { return "Linux host"; }
+  void reboot() override { exit(0); }
+  uint8_t getStartupReason() const override { return BD_STARTUP_NORMAL; }
+  bool isExternalPowered() override { return true; }
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Mesh.h>
+
+/**
+ * \brief  A MillisecondClock that only moves when told to. For benchmarks and simulations that run on virtual time.
+*/
+class VirtualMillisClock : public mesh::MillisecondClock {
+  unsigned long _now;
+public:
+  VirtualMillisClock(unsigned long start = 0) { _now = start; }
+
+  unsigned long getMillis() override { return _now; }
+
+  void setMillis(unsigned long now) { _now = now; }
+  void advance(unsigned long millis) { _now += millis; }
+};
+
+/**
+ * \brief  An RTCClock derived from a MillisecondClock, so that epoch time follows virtual time.
+*/
+class VirtualRTCClock : public mesh::RTCClock {
+  mesh::MillisecondClock* _ms;
+  uint32_t _base_time;
+  unsigned long _base_millis;
+public:
+  VirtualRTCClock(mesh::MillisecondClock& ms, uint32_t base_time = 1715770351) : _ms(&ms) {
+    _base_time = base_time;
+    _base_millis = ms.getMillis();
+  }
+
+  uint32_t getCurrentTime() override { return _base_time + (_ms->getMillis() - _base_millis) / 1000; }
+  void setCurrentTime(uint32_t time) override { _base_time = time; _base_millis = _ms->getMillis(); }
+};
@@ -0,0 +1,157 @@
+#include "HostFS.h"
+#include <sys/stat.h>
+#include <dirent.h>
+#include <unistd.h>
+
+uint32_t File::num_read_calls = 0;
+
+File::File(FILE* fp, const char* name) : _fp(fp, fclose) {
+  strncpy(_name, name, sizeof(_name) - 1);
+  _name[sizeof(_name) - 1] = 0;
+}
+
+size_t File::write(const uint8_t *buf, size_t size) {
+  return _fp ? fwrite(buf, 1, size, _fp.get()) : 0;
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+  num_read_calls++;
+  return _fp ? fread(buf, 1, size, _fp.get()) : 0;
+}
+
+int File::read() {
+  num_read_calls++;
+  return _fp ? fgetc(_fp.get()) : -1;
+}
+
+int File::peek() {
+  if (!_fp) return -1;
+  int c = fgetc(_fp.get());
+  if (c != EOF) ungetc(c, _fp.get());
+  return c;
+}
+
+int File::available() {
+  if (!_fp) return 0;
+  return size() - position();
+}
+
+void File::flush() {
+  if (_fp) fflush(_fp.get());
+}
+
+bool File::seek(uint32_t pos) {
+  return _fp && fseek(_fp.get(), pos, SEEK_SET) == 0;
+}
+
+size_t File::position() const {
+  return _fp ? ftell(_fp.get()) : 0;
+}
+
+size_t File::size() const {
+  if (!_fp) return 0;
+  struct stat st;
+  fflush(_fp.get());
+  return fstat(fileno(_fp.get()), &st) == 0 ? st.st_size : 0;
+}
+
+static void makeParentDirs(const char* host_path);
+
+bool HostFS::begin(const char* root) {
+  strncpy(_root, root, sizeof(_root) - 1);
+  _root[sizeof(_root) - 1] = 0;
+  makeParentDirs(_root);
+  ::mkdir(_root, 0755);
+  return true;
+}
+
+void HostFS::toHostPath(char* dest, size_t max_len, const char* path) const {
+  snprintf(dest, max_len, "%s%s%s", _root, *path == '/' ? "" : "/", path);
+}
+
+static bool removeContents(const char* dir_path) {
+  DIR* dir = opendir(dir_path);
+  if (dir == NULL) return false;
+
+  struct dirent* ent;
+  while ((ent = readdir(dir)) != NULL) {
+    if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s", dir_path, ent->d_name);
+    if (ent->d_type == DT_DIR) {
+      removeContents(path);
+      ::rmdir(path);
+    } else {
+      unlink(path);
+    }
+  }
+  closedir(dir);
+  return true;
+}
+
+// like SPIFFS, writing "/a/b" doesn't need "/a" to be created first
+static void makeParentDirs(const char* host_path) {
+  char tmp[256];
+  strncpy(tmp, host_path, sizeof(tmp) - 1);
+  tmp[sizeof(tmp) - 1] = 0;
+  for (char* sp = strchr(tmp + 1, '/'); sp; sp = strchr(sp + 1, '/')) {
+    *sp = 0;
+    ::mkdir(tmp, 0755);
+    *sp = '/';
+  }
+}
+
+bool HostFS::format() {
+  return removeContents(_root);
+}
+
+bool HostFS::exists(const char* path) {
+  char hp[256];
+  toHostPath(hp, sizeof(hp), path);
+  struct stat st;
+  return stat(hp, &st) == 0;
+}
+
+File HostFS::open(const char* path, const char* mode, bool create) {
+  char hp[256];
+  toHostPath(hp, sizeof(hp), path);
+
+  const char* fmode;
+  if (strcmp(mode, "w") == 0) {
+    fmode = "wb";
+  } else if (strcmp(mode, "a") == 0) {
+    fmode = "ab";
+  } else if (strcmp(mode, "r+") == 0) {
+    fmode = exists(path) ? "r+b" : (create ? "w+b" : "r+b");
+  } else {
+    fmode = "rb";
+  }
+  if (fmode[0] != 'r' || create) makeParentDirs(hp);
+  FILE* fp = fopen(hp, fmode);
+  return fp ? File(fp, path) : File();
+}
+
+bool HostFS::remove(const char* path) {
+  char hp[256];
+  toHostPath(hp, sizeof(hp), path);
+  return unlink(hp) == 0;
+}
+
+bool HostFS::rename(const char* from, const char* to) {
+  char hp_from[256], hp_to[256];
+  toHostPath(hp_from, sizeof(hp_from), from);
+  toHostPath(hp_to, sizeof(hp_to), to);
+  return ::rename(hp_from, hp_to) == 0;
+}
+
+bool HostFS::mkdir(const char* path) {
+  char hp[256];
+  toHostPath(hp, sizeof(hp), path);
+  return ::mkdir(hp, 0755) == 0;
+}
+
+bool HostFS::rmdir(const char* path) {
+  char hp[256];
+  toHostPath(hp, sizeof(hp), path);
+  return ::rmdir(hp) == 0;
+}
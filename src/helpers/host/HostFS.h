@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <memory>
+
+/**
+ * \brief  Host stand-in for an Arduino File, modelled on the ESP32 fs::File API. Backed by a stdio FILE.
+*/
+class File : public Stream {
+  std::shared_ptr<FILE> _fp;
+  char _name[64];
+
+public:
+  static uint32_t num_read_calls;   // read() calls on any File, for benchmarks
+
+  File() { _name[0] = 0; }
+  File(FILE* fp, const char* name);
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buf, size_t size) override;
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override;
+
+  size_t read(uint8_t* buf, size_t size);
+  bool seek(uint32_t pos);
+  size_t position() const;
+  size_t size() const;
+  const char* name() const { return _name; }
+  void close() { _fp.reset(); }
+
+  operator bool() const { return (bool) _fp; }
+};
+
+/**
+ * \brief  Host stand-in for the device filesystem (FILESYSTEM), with all paths relative to a root directory.
+*/
+class HostFS {
+  char _root[128];
+
+  void toHostPath(char* dest, size_t max_len, const char* path) const;
+
+public:
+  HostFS(const char* root = ".") { begin(root); }
+
+  bool begin(const char* root);
+  bool format();
+
+  bool exists(const char* path);
+  File open(const char* path, const char* mode = "r", bool create = false);
+  bool remove(const char* path);
+  bool rename(const char* from, const char* to);
+  bool mkdir(const char* path);
+  bool rmdir(const char* path);
+};
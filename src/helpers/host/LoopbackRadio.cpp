@@ -0,0 +1,49 @@
+#include "LoopbackRadio.h"
+#include <math.h>
+
+uint32_t LoopbackRadio::calcLoRaAirtime(int len_bytes, uint8_t sf, float bw_khz, uint8_t cr) {
+  // per Semtech AN1200.13
+  float t_sym = (float)(1 << sf) / bw_khz;   // millis
+  int de = (sf >= 11 && bw_khz <= 125.0f) ? 1 : 0;   // low data-rate optimise
+  float n_preamble = 16 + 4.25f;
+  float num = 8.0f*len_bytes - 4.0f*sf + 28 + 16;
+  float n_payload = 8 + fmaxf(ceilf(num / (4.0f*(sf - 2*de))) * cr, 0);
+  return (uint32_t) ((n_preamble + n_payload) * t_sym);
+}
+
+bool LoopbackRadio::injectRaw(const uint8_t* bytes, int len, float snr, float rssi) {
+  if (len <= 0 || len > MAX_TRANS_UNIT || _rx_count >= LOOPBACK_RX_QUEUE_SIZE) {
+    n_dropped++;
+    return false;
+  }
+  auto f = &_rx_queue[(_rx_head + _rx_count) % LOOPBACK_RX_QUEUE_SIZE];
+  memcpy(f->data, bytes, len);
+  f->len = len;
+  f->snr = snr;
+  f->rssi = rssi;
+  _rx_count++;
+  return true;
+}
+
+int LoopbackRadio::recvRaw(uint8_t* bytes, int sz) {
+  if (_rx_count == 0) return 0;
+
+  auto f = &_rx_queue[_rx_head];
+  _rx_head = (_rx_head + 1) % LOOPBACK_RX_QUEUE_SIZE;
+  _rx_count--;
+
+  int len = f->len > sz ? sz : f->len;
+  memcpy(bytes, f->data, len);
+  _last_snr = f->snr;
+  _last_rssi = f->rssi;
+  n_recv++;
+  return len;
+}
+
+bool LoopbackRadio::startSendRaw(const uint8_t* bytes, int len) {
+  n_sent++;
+  if (_loopback) {
+    injectRaw(bytes, len, _last_snr, _last_rssi);
+  }
+  return true;
+}
@@ -0,0 +1,230 @@
+#include "SimMedium.h"
+#include "LoopbackRadio.h"
+
+SimMedium::SimMedium(mesh::MillisecondClock& ms, uint32_t seed) : _ms(&ms) {
+  _air_until = ms.getMillis();
+  _rng_state = seed ? seed : 1;
+  memset(&stats, 0, sizeof(stats));
+}
+
+float SimMedium::nextRandom() {
+  // xorshift32, so that loss decisions don't disturb the nodes' RNG sequence
+  _rng_state ^= _rng_state << 13;
+  _rng_state ^= _rng_state >> 17;
+  _rng_state ^= _rng_state << 5;
+  return (_rng_state >> 8) / 16777216.0f;
+}
+
+int SimMedium::attach(SimRadio* radio) {
+  _radios.push_back(radio);
+  _links.push_back(std::vector<SimLink>());
+  return _radios.size() - 1;
+}
+
+void SimMedium::addLink(int from, int to, float snr, float loss) {
+  for (auto& l : _links[from]) {
+    if (l.to == to) {   // replace existing edge
+      l.snr = snr;
+      l.loss = loss;
+      return;
+    }
+  }
+  SimLink l;
+  l.to = to;
+  l.snr = snr;
+  l.loss = loss;
+  _links[from].push_back(l);
+}
+
+uint64_t SimMedium::calcFrameHash(const uint8_t* bytes, int len) {
+  mesh::Packet pkt;
+  if (!pkt.readFrom(bytes, len)) return 0;
+
+  uint8_t hash[MAX_HASH_SIZE];
+  pkt.calculatePacketHash(hash);
+  uint64_t h;
+  memcpy(&h, hash, sizeof(h));
+  return h;
+}
+
+void SimMedium::transmit(SimRadio& sender, const uint8_t* bytes, int len, uint32_t airtime) {
+  auto frame = std::make_shared<SimFrame>();
+  memcpy(frame->data, bytes, len);
+  frame->len = len;
+  frame->sender = sender._idx;
+  frame->hash = calcFrameHash(bytes, len);
+
+  stats.n_tx++;
+  stats.tx_airtime_millis += airtime;
+  _unique.insert(frame->hash);
+  if (!sender._sent.insert(frame->hash).second) {
+    stats.n_dup_tx++;
+  }
+
+  unsigned long now = _ms->getMillis();
+  unsigned long end = now + airtime;
+  if ((long)(end - _air_until) > 0) _air_until = end;
+  sender.markBusy(now, end);
+
+  for (auto& l : _links[sender._idx]) {
+    auto dest = _radios[l.to];
+    if (l.snr < SimRadio::getSNRThreshold(dest->_sf)) {
+      stats.n_below_sensitivity++;
+      dest->markBusy(now, end);   // still occupies the channel (CAD can't see it, though)
+      continue;
+    }
+    dest->beginReceive(frame, end, l.snr, l.loss > 0 && nextRandom() < l.loss);
+  }
+}
+
+// ---------------------------------------------------------------------------------------------
+
+SimRadio::SimRadio(SimMedium& medium, uint8_t sf, float bw_khz, uint8_t cr) : _medium(&medium) {
+  _sf = sf; _bw = bw_khz; _cr = cr;
+  _rx_head = _rx_count = 0;
+  _tx_end = 0;
+  _transmitting = false;
+  _last_snr = _last_rssi = 0;
+  _busy_until = medium.getMillis();
+  _busy_millis = 0;
+  n_recv = n_sent = 0;
+  _idx = medium.attach(this);
+}
+
+static float snr_threshold[] = {
+    -7.5,  // SF7
+    -10,   // SF8
+    -12.5, // SF9
+    -15,   // SF10
+    -17.5, // SF11
+    -20    // SF12
+};
+
+float SimRadio::getSNRThreshold(uint8_t sf) {
+  if (sf < 7) return snr_threshold[0];
+  if (sf > 12) return snr_threshold[5];
+  return snr_threshold[sf - 7];
+}
+
+void SimRadio::markBusy(unsigned long start, unsigned long end) {
+  if ((long)(start - _busy_until) < 0) start = _busy_until;   // overlaps time already accounted for
+  if ((long)(end - start) > 0) {
+    _busy_millis += end - start;
+    _busy_until = end;
+  }
+}
+
+void SimRadio::beginReceive(const std::shared_ptr<SimFrame>& frame, unsigned long end, float snr, bool lost) {
+  completeReceptions();
+  markBusy(_medium->getMillis(), end);
+
+  Reception r;
+  r.frame = frame;
+  r.end = end;
+  r.snr = snr;
+  r.loss = lost ? RX_LINK_LOSS : RX_OK;
+  if (_transmitting && (long)(_medium->getMillis() - _tx_end) < 0) {
+    r.loss = RX_HALF_DUPLEX;
+  }
+  for (auto& other : _active) {   // everything still active overlaps this new frame
+    if (r.snr - other.snr >= SIM_CAPTURE_THRESHOLD_DB) {
+      if (other.loss == RX_OK) other.loss = RX_COLLISION;   // new frame captures the receiver
+    } else if (other.snr - r.snr >= SIM_CAPTURE_THRESHOLD_DB) {
+      if (r.loss == RX_OK) r.loss = RX_COLLISION;
+    } else {
+      if (other.loss == RX_OK) other.loss = RX_COLLISION;
+      if (r.loss == RX_OK) r.loss = RX_COLLISION;
+    }
+  }
+  _active.push_back(r);
+}
+
+void SimRadio::completeReceptions() {
+  unsigned long now = _medium->getMillis();
+  for (int i = 0; i < (int)_active.size(); ) {
+    auto& r = _active[i];
+    if ((long)(now - r.end) < 0) {   // still in the air
+      i++;
+      continue;
+    }
+
+    auto& stats = _medium->stats;
+    switch (r.loss) {
+      case RX_COLLISION:   stats.n_collisions++; break;
+      case RX_HALF_DUPLEX: stats.n_half_duplex++; break;
+      case RX_LINK_LOSS:   stats.n_link_loss++; break;
+      default:
+        if (_rx_count >= SIM_RX_QUEUE_SIZE) {
+          stats.n_queue_full++;
+        } else {
+          int j = (_rx_head + _rx_count) % SIM_RX_QUEUE_SIZE;
+          _rx_queue[j] = r.frame;
+          _rx_snr[j] = r.snr;
+          _rx_count++;
+
+          stats.n_rx_ok++;
+          if (!_heard.insert(r.frame->hash).second) {
+            stats.n_rx_redundant++;
+          }
+        }
+        break;
+    }
+    _active[i] = _active.back();
+    _active.pop_back();
+  }
+}
+
+int SimRadio::recvRaw(uint8_t* bytes, int sz) {
+  completeReceptions();
+  if (_rx_count == 0) return 0;
+
+  auto frame = _rx_queue[_rx_head];
+  _last_snr = _rx_snr[_rx_head];
+  _last_rssi = SIM_NOISE_FLOOR_DBM + _last_snr;
+  _rx_queue[_rx_head].reset();
+  _rx_head = (_rx_head + 1) % SIM_RX_QUEUE_SIZE;
+  _rx_count--;
+
+  int len = frame->len > sz ? sz : frame->len;
+  memcpy(bytes, frame->data, len);
+  n_recv++;
+  return len;
+}
+
+uint32_t SimRadio::getEstAirtimeFor(int len_bytes) {
+  return LoopbackRadio::calcLoRaAirtime(len_bytes, _sf, _bw, _cr);
+}
+
+float SimRadio::packetScore(float snr, int packet_len) {
+  // same as RadioLibWrapper::packetScoreInt()
+  float threshold = getSNRThreshold(_sf);
+  if (snr < threshold) return 0.0f;
+
+  float success_rate_based_on_snr = (snr - threshold) / 10.0f;
+  float collision_penalty = 1 - (packet_len / 256.0f);
+  float score = success_rate_based_on_snr * collision_penalty;
+  return score < 0 ? 0.0f : (score > 1 ? 1.0f : score);
+}
+
+bool SimRadio::startSendRaw(const uint8_t* bytes, int len) {
+  completeReceptions();
+  for (auto& r : _active) {   // half duplex: anything mid-receive is lost
+    if (r.loss == RX_OK) r.loss = RX_HALF_DUPLEX;
+  }
+
+  uint32_t airtime = getEstAirtimeFor(len);
+  _transmitting = true;
+  _tx_end = _medium->getMillis() + airtime;
+  n_sent++;
+  _medium->transmit(*this, bytes, len, airtime);
+  return true;
+}
+
+bool SimRadio::isSendComplete() {
+  return (long)(_medium->getMillis() - _tx_end) >= 0;
+}
+
+bool SimRadio::isReceiving() {
+  completeReceptions();
+  return _active.size() > 0;
+}
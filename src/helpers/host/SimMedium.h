@@ -0,0 +1,164 @@
+#pragma once
+
+#include <Mesh.h>
+#include <memory>
+#include <vector>
+#include <unordered_set>
+
+#ifndef SIM_RX_QUEUE_SIZE
+  #define SIM_RX_QUEUE_SIZE         8
+#endif
+
+#ifndef SIM_CAPTURE_THRESHOLD_DB
+  #define SIM_CAPTURE_THRESHOLD_DB  6.0f   // a frame this much stronger than an overlapping one survives the collision
+#endif
+
+#ifndef SIM_NOISE_FLOOR_DBM
+  #define SIM_NOISE_FLOOR_DBM       -120
+#endif
+
+class SimRadio;
+
+/**
+ * \brief  A directed edge of the simulated link graph.
+*/
+struct SimLink {
+  uint16_t to;
+  float snr;    // dB, as seen by the receiver
+  float loss;   // probability [0..1] of the frame being lost on this edge (fading, etc), independent of collisions
+};
+
+/**
+ * \brief  One over-the-air transmission, shared by all of its receptions.
+*/
+struct SimFrame {
+  uint8_t data[MAX_TRANS_UNIT];
+  uint8_t len;
+  uint16_t sender;
+  uint64_t hash;    // leading bytes of the packet hash, for duplicate accounting
+};
+
+struct SimMediumStats {
+  uint32_t n_tx;              // transmissions started, all nodes
+  uint32_t n_dup_tx;          // a node transmitting a packet (by hash) it has already transmitted
+  uint32_t n_rx_ok;           // frames successfully decoded, all nodes
+  uint32_t n_rx_redundant;    // ...of which the receiver had already decoded the same packet
+  uint32_t n_collisions;      // receptions lost to overlapping frames
+  uint32_t n_half_duplex;     // receptions lost because the receiver was transmitting
+  uint32_t n_below_sensitivity;
+  uint32_t n_link_loss;
+  uint32_t n_queue_full;
+  uint64_t tx_airtime_millis;
+};
+
+/**
+ * \brief  The shared radio channel of a simulation: a link graph of SimRadio nodes, with frames in flight for
+ *        their LoRa airtime. Overlapping receptions at a node collide (subject to capture), and nodes are half duplex.
+ *        All nodes must share the same virtual MillisecondClock.
+*/
+class SimMedium {
+  mesh::MillisecondClock* _ms;
+  std::vector<SimRadio*> _radios;
+  std::vector<std::vector<SimLink> > _links;
+  std::unordered_set<uint64_t> _unique;
+  unsigned long _air_until;
+  uint32_t _rng_state;
+
+  float nextRandom();
+
+public:
+  SimMediumStats stats;
+
+  SimMedium(mesh::MillisecondClock& ms, uint32_t seed = 1);
+
+  /**
+   * \returns  the node index assigned to the radio
+  */
+  int attach(SimRadio* radio);
+
+  void addLink(int from, int to, float snr, float loss = 0.0f);
+  void connect(int a, int b, float snr, float loss = 0.0f) { addLink(a, b, snr, loss); addLink(b, a, snr, loss); }
+
+  int getNumNodes() const { return _radios.size(); }
+  SimRadio* getRadio(int idx) const { return _radios[idx]; }
+  const std::vector<SimLink>& getLinksFrom(int idx) const { return _links[idx]; }
+  uint32_t getNumUniquePackets() const { return _unique.size(); }
+  unsigned long getMillis() const { return _ms->getMillis(); }
+
+  /**
+   * \returns  true if no frame is currently in the air anywhere
+  */
+  bool isIdle() const { return (long)(_ms->getMillis() - _air_until) >= 0; }
+
+  void transmit(SimRadio& sender, const uint8_t* bytes, int len, uint32_t airtime);
+
+  static uint64_t calcFrameHash(const uint8_t* bytes, int len);
+};
+
+/**
+ * \brief  A mesh::Radio attached to a SimMedium.
+*/
+class SimRadio : public mesh::Radio {
+  friend class SimMedium;
+
+  enum LossReason { RX_OK, RX_COLLISION, RX_HALF_DUPLEX, RX_LINK_LOSS };
+
+  struct Reception {
+    std::shared_ptr<SimFrame> frame;
+    unsigned long end;
+    float snr;
+    uint8_t loss;   // one of LossReason
+  };
+
+  SimMedium* _medium;
+  int _idx;
+  uint8_t _sf, _cr;
+  float _bw;
+  std::vector<Reception> _active;
+  std::shared_ptr<SimFrame> _rx_queue[SIM_RX_QUEUE_SIZE];
+  float _rx_snr[SIM_RX_QUEUE_SIZE];
+  int _rx_head, _rx_count;
+  unsigned long _tx_end;
+  bool _transmitting;
+  float _last_snr, _last_rssi;
+  unsigned long _busy_until;
+  uint64_t _busy_millis;
+  uint32_t n_recv, n_sent;
+  std::unordered_set<uint64_t> _heard, _sent;
+
+  void markBusy(unsigned long start, unsigned long end);
+  void beginReceive(const std::shared_ptr<SimFrame>& frame, unsigned long end, float snr, bool lost);
+  void completeReceptions();
+
+public:
+  SimRadio(SimMedium& medium, uint8_t sf = 11, float bw_khz = 250.0f, uint8_t cr = 5);
+
+  int getNodeIdx() const { return _idx; }
+
+  /**
+   * \returns  min SNR (dB) needed to demodulate at the given spreading factor
+  */
+  static float getSNRThreshold(uint8_t sf);
+
+  int recvRaw(uint8_t* bytes, int sz) override;
+  uint32_t getEstAirtimeFor(int len_bytes) override;
+  float packetScore(float snr, int packet_len) override;
+  bool startSendRaw(const uint8_t* bytes, int len) override;
+  bool isSendComplete() override;
+  void onSendFinished() override { _transmitting = false; }
+  void loop() override { completeReceptions(); }
+  int getNoiseFloor() const override { return SIM_NOISE_FLOOR_DBM; }
+  bool isInRecvMode() const override { return !_transmitting; }
+  bool isReceiving() override;
+
+  float getLastRSSI() const override { return _last_rssi; }
+  float getLastSNR() const override { return _last_snr; }
+
+  uint32_t getPacketsRecv() const { return n_recv; }
+  uint32_t getPacketsSent() const { return n_sent; }
+
+  /**
+   * \returns  total millis this node's channel was busy (own transmits, plus any frame heard, decodable or not)
+  */
+  uint64_t getBusyMillis() const { return _busy_millis; }
+};
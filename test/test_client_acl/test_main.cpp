@@ -0,0 +1,204 @@
+#include <unity.h>
+#include <helpers/ClientACL.h>
+#include <helpers/ArduinoHelpers.h>
+#include <helpers/host/HostFS.h>
+
+/*
+ * ClientACL in paged mode, with more clients than ACL_HOT_CLIENTS: clients paged in and out (and changes written
+ * back), statuses and key prefixes polled without paging, deleting a client (the last page moves into its slot), eviction when full,
+ * (without reading every page), save()/load(), and AEAD nonces restored into pages that aren't resident.
+ */
+
+#if ACL_HOT_CLIENTS == 0
+  #error "test_client_acl needs the paged mode, ie. ACL_HOT_CLIENTS > 0"
+#endif
+
+#define NUM_TEST_CLIENTS  (ACL_HOT_CLIENTS * 3)
+
+static HostFS fs(".");
+static StdRNG rng;
+static mesh::LocalIdentity self_id;
+static mesh::LocalIdentity client_ids[MAX_CLIENTS + 1];
+
+static void removeFiles() {
+  const char* files[] = { "/s_contacts", "/s_acl_pages", "/s_nonce_log", "/s_nonce_log.tmp", "/s_nonces",
+                          "/s_sess_log", "/s_sess_log.tmp", "/s_sess_keys" };
+  for (int i = 0; i < sizeof(files) / sizeof(files[0]); i++) fs.remove(files[i]);
+}
+
+void setUp() {
+  static bool ids_made = false;
+  if (!ids_made) {
+    rng.begin(99);
+    self_id = mesh::LocalIdentity(&rng);
+    for (int i = 0; i < MAX_CLIENTS + 1; i++) client_ids[i] = mesh::LocalIdentity(&rng);
+    ids_made = true;
+  }
+  removeFiles();
+}
+void tearDown() { removeFiles(); }
+
+static uint8_t permsFor(int n) {
+  return n == 0 ? PERM_ACL_ADMIN : (n % 2 ? PERM_ACL_READ_ONLY : PERM_ACL_READ_WRITE);
+}
+
+// a loaded (empty) ACL, with clients 0..num-1 added, each with a distinct out_path and last_activity
+static void addClients(ClientACL& acl, int num) {
+  acl.load(&fs, self_id);
+  for (int n = 0; n < num; n++) {
+    TEST_ASSERT_TRUE(acl.applyPermissions(self_id, client_ids[n].pub_key, PUB_KEY_SIZE, permsFor(n)));
+    auto c = acl.getClient(client_ids[n].pub_key, PUB_KEY_SIZE);
+    TEST_ASSERT_NOT_NULL(c);
+    c->out_path_len = 1 + n % 8;
+    memset(c->out_path, n, c->out_path_len);
+    c->last_activity = 1000 + n;
+  }
+}
+
+static void checkClient(ClientACL& acl, int n) {
+  auto c = acl.getClient(client_ids[n].pub_key, PUB_KEY_SIZE);
+  TEST_ASSERT_NOT_NULL(c);
+  TEST_ASSERT_TRUE(c->id.matches(client_ids[n]));
+  TEST_ASSERT_EQUAL_UINT8(permsFor(n), c->permissions);
+  TEST_ASSERT_EQUAL_INT(1 + n % 8, c->out_path_len);
+  TEST_ASSERT_EQUAL_UINT8(n, c->out_path[c->out_path_len - 1]);
+
+  uint8_t secret[PUB_KEY_SIZE];
+  self_id.calcSharedSecret(secret, client_ids[n].pub_key);
+  TEST_ASSERT_EQUAL_MEMORY(secret, c->shared_secret, PUB_KEY_SIZE);
+}
+
+static void test_paging() {
+  static ClientACL acl;
+  addClients(acl, NUM_TEST_CLIENTS);
+  TEST_ASSERT_EQUAL_INT(NUM_TEST_CLIENTS, acl.getNumClients());
+
+  for (int pass = 0; pass < 2; pass++) {   // every client has been paged out by now, then again
+    for (int n = 0; n < NUM_TEST_CLIENTS; n++) checkClient(acl, n);
+  }
+  for (int i = 0; i < NUM_TEST_CLIENTS; i++) {   // changes are written back when paged out
+    acl.getClientByIdx(i)->extra.room.pending_ack = 0xA000 + i;
+  }
+  for (int i = 0; i < NUM_TEST_CLIENTS; i++) {
+    TEST_ASSERT_EQUAL_UINT32(0xA000 + i, acl.getClientByIdx(i)->extra.room.pending_ack);
+  }
+
+  uint32_t calls = File::num_read_calls;
+  for (int i = 0; i < NUM_TEST_CLIENTS; i++) {   // statuses are polled without paging
+    auto s = acl.getStatusByIdx(i);
+    TEST_ASSERT_EQUAL_UINT32(0xA000 + i, s.pending_ack);
+    TEST_ASSERT_EQUAL_UINT8(acl.getClientByIdx(i)->permissions, s.permissions);
+    TEST_ASSERT_EQUAL_UINT32(acl.getClientByIdx(i)->last_activity, s.last_activity);
+  }
+  TEST_ASSERT_GREATER_THAN(calls, File::num_read_calls);   // (the getClientByIdx() calls did read)
+  calls = File::num_read_calls;
+  for (int i = 0; i < NUM_TEST_CLIENTS; i++) {
+    acl.getStatusByIdx(i);
+    TEST_ASSERT_EQUAL_MEMORY(client_ids[i].pub_key, acl.getKeyPrefixByIdx(i), 6);
+  }
+  TEST_ASSERT_EQUAL_UINT32(calls, File::num_read_calls);
+
+  int idx[4];
+  int n = acl.findClientsByHash(client_ids[5].pub_key, idx, 4);
+  TEST_ASSERT_GREATER_THAN(0, n);
+  bool found = false;
+  for (int i = 0; i < n; i++) found |= acl.getClientByIdx(idx[i])->id.matches(client_ids[5]);
+  TEST_ASSERT_TRUE(found);
+}
+
+static void test_delete_moves_last_page() {
+  static ClientACL acl;
+  addClients(acl, NUM_TEST_CLIENTS);
+  int last = NUM_TEST_CLIENTS - 1;
+
+  for (int n = 1; n < 4; n++) checkClient(acl, n);   // slot 1 resident, the last page not
+  TEST_ASSERT_TRUE(acl.applyPermissions(self_id, client_ids[1].pub_key, PUB_KEY_SIZE, PERM_ACL_GUEST));
+  TEST_ASSERT_EQUAL_INT(NUM_TEST_CLIENTS - 1, acl.getNumClients());
+  TEST_ASSERT_NULL(acl.getClient(client_ids[1].pub_key, PUB_KEY_SIZE));
+  TEST_ASSERT_TRUE(acl.getClientByIdx(1)->id.matches(client_ids[last]));   // the last page moved into slot 1
+  checkClient(acl, last);
+
+  for (int n = 6; n < NUM_TEST_CLIENTS - 1; n++) checkClient(acl, n);   // slot 3 not resident, the last page is
+  TEST_ASSERT_TRUE(acl.applyPermissions(self_id, client_ids[3].pub_key, PUB_KEY_SIZE, PERM_ACL_GUEST));
+  TEST_ASSERT_EQUAL_INT(NUM_TEST_CLIENTS - 2, acl.getNumClients());
+  TEST_ASSERT_TRUE(acl.getClientByIdx(3)->id.matches(client_ids[last - 1]));
+
+  for (int n = 0; n < NUM_TEST_CLIENTS; n++) {
+    if (n == 1 || n == 3) {
+      TEST_ASSERT_NULL(acl.getClient(client_ids[n].pub_key, PUB_KEY_SIZE));
+    } else {
+      checkClient(acl, n);
+    }
+  }
+}
+
+static void test_evict_when_full() {
+  static ClientACL acl;
+  addClients(acl, MAX_CLIENTS);
+  acl.getClient(client_ids[0].pub_key, PUB_KEY_SIZE)->last_activity = 1;    // admin, never evicted
+  acl.getClient(client_ids[7].pub_key, PUB_KEY_SIZE)->last_activity = 10;   // least active of the rest
+  for (int n = 8; n < 8 + ACL_HOT_CLIENTS; n++) checkClient(acl, n);        // so client 7 is paged out
+
+  uint32_t calls = File::num_read_calls;
+  TEST_ASSERT_TRUE(acl.applyPermissions(self_id, client_ids[MAX_CLIENTS].pub_key, PUB_KEY_SIZE, PERM_ACL_READ_WRITE));
+  TEST_ASSERT_EQUAL_INT(MAX_CLIENTS, acl.getNumClients());
+  TEST_ASSERT_LESS_OR_EQUAL(4, File::num_read_calls - calls);   // the evicted page (and a write-back), not every page
+  TEST_ASSERT_NULL(acl.getClient(client_ids[7].pub_key, PUB_KEY_SIZE));
+  TEST_ASSERT_NOT_NULL(acl.getClient(client_ids[0].pub_key, PUB_KEY_SIZE));
+  TEST_ASSERT_NOT_NULL(acl.getClient(client_ids[MAX_CLIENTS].pub_key, PUB_KEY_SIZE));
+}
+
+static void test_save_load() {
+  static ClientACL acl, reloaded;
+  addClients(acl, NUM_TEST_CLIENTS);
+  acl.save(&fs);
+
+  reloaded.load(&fs, self_id);
+  TEST_ASSERT_EQUAL_INT(NUM_TEST_CLIENTS, reloaded.getNumClients());
+  for (int n = NUM_TEST_CLIENTS - 1; n >= 0; n--) checkClient(reloaded, n);
+}
+
+static void test_nonces_in_pages() {
+  static ClientACL acl, reloaded;
+  addClients(acl, NUM_TEST_CLIENTS);
+  for (int i = 0; i < NUM_TEST_CLIENTS; i++) {
+    auto c = acl.getClientByIdx(i);
+    c->flags |= CONTACT_FLAG_AEAD;
+    c->aead_nonce = 2000 + 100*i;
+  }
+  acl.save(&fs);
+  acl.saveNonces();
+
+  for (int bump = 0; bump < 2; bump++) {
+    reloaded.load(&fs, self_id);
+    reloaded.loadNonces();
+    reloaded.finalizeNonceLoad(bump);
+    TEST_ASSERT_EQUAL(bump, reloaded.isNonceDirty());
+    for (int i = 0; i < NUM_TEST_CLIENTS; i++) {   // most of them restored into pages, not resident ones
+      TEST_ASSERT_EQUAL_UINT16(2000 + 100*i + (bump ? NONCE_BOOT_BUMP : 0), reloaded.getClientByIdx(i)->aead_nonce);
+    }
+  }
+
+  reloaded.saveNonces();   // the bumped nonces, appended
+  auto c = reloaded.getClientByIdx(2);
+  c->flags |= CONTACT_FLAG_AEAD;
+  for (int k = 0; k < NONCE_PERSIST_INTERVAL; k++) reloaded.nextAeadNonceFor(*c);
+  TEST_ASSERT_TRUE(reloaded.isNonceDirty());
+  reloaded.saveNonces();
+
+  acl.load(&fs, self_id);
+  acl.loadNonces();
+  acl.finalizeNonceLoad(false);
+  TEST_ASSERT_EQUAL_UINT16(2200 + NONCE_BOOT_BUMP + NONCE_PERSIST_INTERVAL, acl.getClientByIdx(2)->aead_nonce);
+  TEST_ASSERT_EQUAL_UINT16(2000 + 100*(NUM_TEST_CLIENTS - 1) + NONCE_BOOT_BUMP, acl.getClientByIdx(NUM_TEST_CLIENTS - 1)->aead_nonce);
+}
+
+int main(int argc, char* argv[]) {
+  UNITY_BEGIN();
+  RUN_TEST(test_paging);
+  RUN_TEST(test_delete_moves_last_page);
+  RUN_TEST(test_evict_when_full);
+  RUN_TEST(test_save_load);
+  RUN_TEST(test_nonces_in_pages);
+  return UNITY_END();
+}
@@ -0,0 +1,150 @@
+#include <unity.h>
+#include <Utils.h>
+#include <SHA256.h>
+#include <AES.h>
+#include <Ed25519.h>
+#include <ed_25519.h>
+
+/*
+ * Utils' HMAC midstate and AES key schedule caches: results must match uncached ones, whether a key is cached, evicted
+ * or forgotten. Likewise lib/ed25519's verify key cache, checked against the Crypto library's Ed25519::verify(), and
+ * both lib/ed25519 verifies must reject a signature's S + l (the same signature, re-encoded).
+ */
+
+void setUp() { }
+void tearDown() { mesh::Utils::forgetAllKeys(); }
+
+static void makeKey(uint8_t* key, uint8_t seed) {
+  for (int i = 0; i < PUB_KEY_SIZE; i++) key[i] = seed * 31 + i;
+}
+
+static void plainHMAC(uint8_t* mac, const uint8_t* key, const uint8_t* msg, int msg_len) {
+  SHA256 sha;
+  sha.resetHMAC(key, PUB_KEY_SIZE);
+  sha.update(msg, msg_len);
+  sha.finalizeHMAC(key, PUB_KEY_SIZE, mac, 32);
+}
+
+static void test_hmac_matches_uncached() {
+  uint8_t key[PUB_KEY_SIZE], msg[40], expected[32], mac[32];
+  memset(msg, 0xA5, sizeof(msg));
+  for (int k = 0; k < 20; k++) {   // more keys than HMAC_CACHE_SIZE, so some are evicted
+    makeKey(key, k);
+    plainHMAC(expected, key, msg, sizeof(msg));
+    mesh::Utils::hmacSHA256(mac, sizeof(mac), key, PUB_KEY_SIZE, msg, sizeof(msg));
+    TEST_ASSERT_EQUAL_MEMORY(expected, mac, sizeof(mac));
+    mesh::Utils::hmacSHA256(mac, sizeof(mac), key, PUB_KEY_SIZE, msg, sizeof(msg));   // cached
+    TEST_ASSERT_EQUAL_MEMORY(expected, mac, sizeof(mac));
+  }
+}
+
+static void test_hmac_after_forget() {
+  uint8_t key[PUB_KEY_SIZE], other[PUB_KEY_SIZE], msg[16], expected[32], mac[32];
+  memset(msg, 0x3C, sizeof(msg));
+  makeKey(key, 1);
+  makeKey(other, 2);
+  plainHMAC(expected, key, msg, sizeof(msg));
+
+  mesh::Utils::hmacSHA256(mac, sizeof(mac), key, PUB_KEY_SIZE, msg, sizeof(msg));
+  mesh::Utils::hmacSHA256(mac, sizeof(mac), other, PUB_KEY_SIZE, msg, sizeof(msg));
+  mesh::Utils::forgetKey(key, PUB_KEY_SIZE);
+  mesh::Utils::hmacSHA256(mac, sizeof(mac), key, PUB_KEY_SIZE, msg, sizeof(msg));   // prepared again
+  TEST_ASSERT_EQUAL_MEMORY(expected, mac, sizeof(mac));
+
+  mesh::Utils::forgetAllKeys();
+  mesh::Utils::hmacSHA256(mac, sizeof(mac), key, PUB_KEY_SIZE, msg, sizeof(msg));
+  TEST_ASSERT_EQUAL_MEMORY(expected, mac, sizeof(mac));
+}
+
+static void test_aes_after_forget() {
+  uint8_t key[PUB_KEY_SIZE], msg[32], expected[32], enc[32], dec[32];
+  for (int i = 0; i < sizeof(msg); i++) msg[i] = i;
+  makeKey(key, 3);
+  AES128 aes;
+  aes.setKey(key, CIPHER_KEY_SIZE);
+  aes.encryptBlock(expected, msg);
+  aes.encryptBlock(&expected[16], &msg[16]);
+
+  for (int k = 0; k < 20; k++) {   // more keys than AES_CACHE_SIZE, so some are evicted
+    uint8_t other[PUB_KEY_SIZE];
+    makeKey(other, 10 + k);
+    mesh::Utils::encrypt(other, enc, msg, sizeof(msg));
+    if (k == 0) mesh::Utils::encrypt(key, enc, msg, sizeof(msg));
+  }
+  TEST_ASSERT_EQUAL_INT(sizeof(msg), mesh::Utils::encrypt(key, enc, msg, sizeof(msg)));
+  TEST_ASSERT_EQUAL_MEMORY(expected, enc, sizeof(enc));
+
+  mesh::Utils::forgetKey(key, PUB_KEY_SIZE);
+  mesh::Utils::decrypt(key, dec, enc, sizeof(enc));   // expanded again
+  TEST_ASSERT_EQUAL_MEMORY(msg, dec, sizeof(msg));
+
+  mesh::Utils::forgetAllKeys();
+  mesh::Utils::encrypt(key, enc, msg, sizeof(msg));
+  TEST_ASSERT_EQUAL_MEMORY(expected, enc, sizeof(enc));
+}
+
+static void test_verify_matches_crypto() {
+  uint8_t seed[32], pub_key[PUB_KEY_SIZE], prv_key[64], sig[SIGNATURE_SIZE], msg[80];
+  memset(msg, 0x69, sizeof(msg));
+  ed25519_verify_cache_clear();
+  for (int k = 0; k < 40; k++) {   // more signers than ED25519_KEY_CACHE_SIZE, so some are evicted
+    makeKey(seed, k);
+    ed25519_create_keypair(pub_key, prv_key, seed);
+    msg[0] = k;
+    ed25519_sign(sig, msg, sizeof(msg), pub_key, prv_key);
+
+    for (int pass = 0; pass < 2; pass++) {   // decompressed, then cached
+      TEST_ASSERT_TRUE(ed25519_verify_cached(sig, msg, sizeof(msg), pub_key));
+      TEST_ASSERT_TRUE(Ed25519::verify(sig, pub_key, msg, sizeof(msg)));
+    }
+    sig[k % SIGNATURE_SIZE] ^= 0x10;   // forged
+    TEST_ASSERT_EQUAL(Ed25519::verify(sig, pub_key, msg, sizeof(msg)), ed25519_verify_cached(sig, msg, sizeof(msg), pub_key));
+    sig[k % SIGNATURE_SIZE] ^= 0x10;
+
+    pub_key[k % PUB_KEY_SIZE] ^= 0x01;   // wrong key, possibly not a valid point at all
+    TEST_ASSERT_EQUAL(Ed25519::verify(sig, pub_key, msg, sizeof(msg)), ed25519_verify_cached(sig, msg, sizeof(msg), pub_key));
+    pub_key[k % PUB_KEY_SIZE] ^= 0x01;
+    TEST_ASSERT_TRUE(ed25519_verify_cached(sig, msg, sizeof(msg), pub_key));   // not displaced by a failed decompression
+  }
+}
+
+// sig's S += l, little-endian
+static void addOrder(uint8_t* sig) {
+  static const uint8_t l[32] = {
+    0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+  };
+  int carry = 0;
+  for (int i = 0; i < 32; i++) {
+    int sum = sig[32 + i] + l[i] + carry;
+    sig[32 + i] = sum & 0xFF;
+    carry = sum >> 8;
+  }
+}
+
+static void test_verify_rejects_non_canonical() {
+  uint8_t seed[32], pub_key[PUB_KEY_SIZE], prv_key[64], sig[SIGNATURE_SIZE], msg[80];
+  memset(msg, 0x3C, sizeof(msg));
+  ed25519_verify_cache_clear();
+  for (int k = 0; k < 20; k++) {
+    makeKey(seed, 100 + k);
+    ed25519_create_keypair(pub_key, prv_key, seed);
+    msg[0] = k;
+    ed25519_sign(sig, msg, sizeof(msg), pub_key, prv_key);
+    TEST_ASSERT_TRUE(ed25519_verify_cached(sig, msg, sizeof(msg), pub_key));   // (now cached)
+
+    addOrder(sig);
+    TEST_ASSERT_FALSE(ed25519_verify(sig, msg, sizeof(msg), pub_key));
+    TEST_ASSERT_FALSE(ed25519_verify_cached(sig, msg, sizeof(msg), pub_key));
+  }
+}
+
+int main(int argc, char* argv[]) {
+  UNITY_BEGIN();
+  RUN_TEST(test_hmac_matches_uncached);
+  RUN_TEST(test_hmac_after_forget);
+  RUN_TEST(test_aes_after_forget);
+  RUN_TEST(test_verify_matches_crypto);
+  RUN_TEST(test_verify_rejects_non_canonical);
+  return UNITY_END();
+}
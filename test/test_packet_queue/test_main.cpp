@@ -0,0 +1,89 @@
+#include <unity.h>
+#include <helpers/StaticPoolPacketManager.h>
+
+/*
+ * PacketQueue / StaticPoolPacketManager: due counts versus totals, as used by Dispatcher::checkSend() (due at 'now')
+ * and by hasPendingWork() and the queue_len stats (everything queued), and the due-in times mesh_sim jumps ahead by.
+ */
+
+#define POOL_SIZE  8
+
+void setUp() { }
+void tearDown() { }
+
+static void test_count_before_excludes_future() {
+  mesh::Packet packets[3];
+  PacketQueue q(POOL_SIZE);
+  q.add(&packets[0], 1, 1000);
+  q.add(&packets[1], 1, 2000);
+  q.add(&packets[2], 1, 3000);
+
+  TEST_ASSERT_EQUAL_INT(0, q.countBefore(500));
+  TEST_ASSERT_EQUAL_INT(1, q.countBefore(1000));
+  TEST_ASSERT_EQUAL_INT(2, q.countBefore(2500));
+  TEST_ASSERT_EQUAL_INT(3, q.count());
+}
+
+// 0xFFFFFFFF is just a time (the last ms before millis() wraps), not 'everything'
+static void test_count_before_no_sentinel() {
+  mesh::Packet packets[2];
+  PacketQueue q(POOL_SIZE);
+  q.add(&packets[0], 0, 0xFFFFFFF0);
+  q.add(&packets[1], 0, 100);   // after the wrap
+
+  TEST_ASSERT_EQUAL_INT(1, q.countBefore(0xFFFFFFFF));
+  TEST_ASSERT_EQUAL_INT(2, q.count());
+  TEST_ASSERT_EQUAL_INT(2, q.countBefore(100));
+}
+
+static void test_get_in_priority_order() {
+  mesh::Packet packets[4];
+  PacketQueue q(POOL_SIZE);
+  q.add(&packets[0], 2, 100);
+  q.add(&packets[1], 0, 100);
+  q.add(&packets[2], 2, 100);
+  q.add(&packets[3], 0, 5000);   // most important, but not due yet
+
+  TEST_ASSERT_EQUAL_PTR(&packets[1], q.get(200));
+  TEST_ASSERT_EQUAL_PTR(&packets[0], q.get(200));   // FIFO for equal priority
+  TEST_ASSERT_EQUAL_PTR(&packets[2], q.get(200));
+  TEST_ASSERT_NULL(q.get(200));
+  TEST_ASSERT_EQUAL_INT(1, q.count());
+  TEST_ASSERT_EQUAL_PTR(&packets[3], q.get(5000));
+}
+
+static void test_outbound_total_includes_delayed() {
+  StaticPoolPacketManager mgr(POOL_SIZE);
+  mesh::Packet* a = mgr.allocNew();
+  mesh::Packet* b = mgr.allocNew();
+  mgr.queueOutbound(a, 1, 1000);
+  mgr.queueOutbound(b, 1, 60000);   // eg. a delayed flood retransmit
+
+  // pending work (and queue_len) must count the delayed packet, so the board doesn't sleep on it
+  TEST_ASSERT_EQUAL_INT(500, mgr.getOutboundDueIn(500));
+  TEST_ASSERT_EQUAL_INT(0, mgr.getOutboundCount(500));
+  TEST_ASSERT_EQUAL_INT(2, mgr.getOutboundTotal());
+  TEST_ASSERT_EQUAL_INT(0, mgr.getOutboundDueIn(1200));
+  TEST_ASSERT_EQUAL_INT(1, mgr.getOutboundCount(1000));
+  TEST_ASSERT_EQUAL_PTR(a, mgr.getNextOutbound(1000));
+  mgr.free(a);
+  TEST_ASSERT_EQUAL_INT(0, mgr.getOutboundCount(1000));
+  TEST_ASSERT_EQUAL_INT(1, mgr.getOutboundTotal());
+  TEST_ASSERT_EQUAL_INT(59000, mgr.getOutboundDueIn(1000));
+  TEST_ASSERT_EQUAL_INT(-1, mgr.getInboundDueIn(1000));
+
+  TEST_ASSERT_EQUAL_PTR(b, mgr.removeOutboundByIdx(0));
+  mgr.free(b);
+  TEST_ASSERT_EQUAL_INT(0, mgr.getOutboundTotal());
+  TEST_ASSERT_EQUAL_INT(-1, mgr.getOutboundDueIn(1000));
+  TEST_ASSERT_EQUAL_INT(POOL_SIZE, mgr.getFreeCount());
+}
+
+int main(int argc, char* argv[]) {
+  UNITY_BEGIN();
+  RUN_TEST(test_count_before_excludes_future);
+  RUN_TEST(test_count_before_no_sentinel);
+  RUN_TEST(test_get_in_priority_order);
+  RUN_TEST(test_outbound_total_includes_delayed);
+  return UNITY_END();
+}
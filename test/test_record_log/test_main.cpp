@@ -0,0 +1,204 @@
+#include <unity.h>
+#include <helpers/RecordLog.h>
+#include <helpers/host/HostFS.h>
+
+/*
+ * RecordLog: replay after a clean close, after an append cut short and after a corrupted record (which must stop
+ * replay, and block appends until compacted), compaction, and begin() recovering an interrupted compaction.
+ */
+
+#define LOG_PATH  "/rl_test"
+#define TMP_PATH  "/rl_test.tmp"
+#define REC_SIZE  20
+
+static HostFS fs(".");
+
+void setUp() {
+  fs.remove(LOG_PATH);
+  fs.remove(TMP_PATH);
+}
+void tearDown() {
+  fs.remove(LOG_PATH);
+  fs.remove(TMP_PATH);
+}
+
+static void makeRec(uint8_t* rec, int n) {
+  for (int i = 0; i < REC_SIZE; i++) rec[i] = n * 7 + i;
+}
+
+static void appendRecs(RecordLog& log, int from, int to) {
+  File file = log.openAppend();
+  TEST_ASSERT_TRUE(file);
+  for (int n = from; n < to; n++) {
+    uint8_t rec[REC_SIZE];
+    makeRec(rec, n);
+    TEST_ASSERT_EQUAL_INT(n, log.append(file, rec));
+  }
+  file.close();
+}
+
+// replays the log, checking the records are from..from+count-1, returns how many were read
+static int replay(RecordLog& log, int from) {
+  File file = log.openRead();
+  int n = 0;
+  uint8_t rec[REC_SIZE], expected[REC_SIZE];
+  while (log.read(file, rec)) {
+    makeRec(expected, from + n);
+    TEST_ASSERT_EQUAL_MEMORY(expected, rec, REC_SIZE);
+    n++;
+  }
+  file.close();
+  return n;
+}
+
+static void test_reload() {
+  RecordLog log;
+  log.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_FALSE(log.exists());
+  appendRecs(log, 0, 10);
+
+  RecordLog reloaded;
+  reloaded.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_EQUAL_UINT32(10, reloaded.getNumRecords());
+  TEST_ASSERT_EQUAL_INT(10, replay(reloaded, 0));
+  TEST_ASSERT_FALSE(reloaded.shouldCompact(10));
+
+  File file = reloaded.openRead();
+  uint8_t rec[REC_SIZE], expected[REC_SIZE];
+  TEST_ASSERT_TRUE(reloaded.readAt(file, 7, rec));
+  makeRec(expected, 7);
+  TEST_ASSERT_EQUAL_MEMORY(expected, rec, REC_SIZE);
+  TEST_ASSERT_FALSE(reloaded.readAt(file, 10, rec));
+  file.close();
+
+  appendRecs(reloaded, 10, 12);   // appends carry on from the end
+  TEST_ASSERT_EQUAL_INT(12, replay(reloaded, 0));
+}
+
+static void test_partial_append() {
+  RecordLog log;
+  log.begin(&fs, LOG_PATH, REC_SIZE);
+  appendRecs(log, 0, 5);
+
+  File file = fs.open(LOG_PATH, "a");   // a reset part way through the next append
+  uint8_t rec[REC_SIZE];
+  makeRec(rec, 5);
+  file.write(rec, REC_SIZE / 2);
+  file.close();
+
+  RecordLog reloaded;
+  reloaded.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_EQUAL_UINT32(5, reloaded.getNumRecords());
+  TEST_ASSERT_EQUAL_INT(5, replay(reloaded, 0));
+  TEST_ASSERT_TRUE(reloaded.shouldCompact(5));
+  TEST_ASSERT_FALSE(reloaded.openAppend());   // would append after the partial record
+
+  File out = reloaded.beginCompact();
+  TEST_ASSERT_TRUE(out);
+  for (int n = 0; n < 5; n++) {
+    makeRec(rec, n);
+    TEST_ASSERT_EQUAL_INT(n, reloaded.append(out, rec));
+  }
+  TEST_ASSERT_TRUE(reloaded.endCompact(out, true));
+  TEST_ASSERT_FALSE(reloaded.shouldCompact(5));
+  appendRecs(reloaded, 5, 6);
+
+  RecordLog again;
+  again.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_EQUAL_UINT32(6, again.getNumRecords());
+  TEST_ASSERT_EQUAL_INT(6, replay(again, 0));
+}
+
+static void test_bad_crc() {
+  RecordLog log;
+  log.begin(&fs, LOG_PATH, REC_SIZE);
+  appendRecs(log, 0, 8);
+
+  File file = fs.open(LOG_PATH, "r+");
+  file.seek(3 * (REC_SIZE + 2) + 4);   // a byte inside record 3
+  uint8_t b = 0xEE;
+  file.write(&b, 1);
+  file.close();
+
+  RecordLog reloaded;
+  reloaded.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_EQUAL_UINT32(8, reloaded.getNumRecords());   // (the size is still whole records)
+  TEST_ASSERT_FALSE(reloaded.shouldCompact(8));
+  TEST_ASSERT_EQUAL_INT(3, replay(reloaded, 0));   // stops at the bad record
+  TEST_ASSERT_TRUE(reloaded.shouldCompact(3));
+  TEST_ASSERT_FALSE(reloaded.openAppend());
+}
+
+static void test_compaction() {
+  RecordLog log;
+  log.begin(&fs, LOG_PATH, REC_SIZE);
+  appendRecs(log, 0, 2*4 + RECORD_LOG_SLACK + 1);
+  TEST_ASSERT_TRUE(log.shouldCompact(4));
+
+  File in = log.openRead();   // readable until endCompact()
+  File out = log.beginCompact();
+  TEST_ASSERT_FALSE(log.openAppend());
+  uint8_t rec[REC_SIZE];
+  for (int n = 0; n < 4; n++) {
+    TEST_ASSERT_TRUE(log.readAt(in, 30 + n, rec));
+    TEST_ASSERT_EQUAL_INT(n, log.append(out, rec));
+  }
+  in.close();
+  TEST_ASSERT_TRUE(log.endCompact(out, true));
+  TEST_ASSERT_EQUAL_UINT32(4, log.getNumRecords());
+  TEST_ASSERT_FALSE(log.shouldCompact(4));
+  TEST_ASSERT_FALSE(fs.exists(TMP_PATH));
+  TEST_ASSERT_EQUAL_INT(4, replay(log, 30));
+
+  out = log.beginCompact();   // a failed compaction leaves the log as it was
+  log.append(out, rec);
+  TEST_ASSERT_FALSE(log.endCompact(out, false));
+  TEST_ASSERT_FALSE(fs.exists(TMP_PATH));
+  TEST_ASSERT_EQUAL_UINT32(4, log.getNumRecords());
+  TEST_ASSERT_EQUAL_INT(4, replay(log, 30));
+}
+
+// a compaction interrupted before its rename: the old log must win if it's still there, else the new one is adopted
+static void test_interrupted_compaction() {
+  RecordLog log;
+  log.begin(&fs, LOG_PATH, REC_SIZE);
+  appendRecs(log, 0, 6);
+
+  File out = log.beginCompact();   // reset while writing the compacted log
+  uint8_t rec[REC_SIZE];
+  makeRec(rec, 100);
+  log.append(out, rec);
+  out.close();
+  TEST_ASSERT_TRUE(fs.exists(TMP_PATH));
+
+  RecordLog reloaded;
+  reloaded.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_FALSE(fs.exists(TMP_PATH));
+  TEST_ASSERT_EQUAL_UINT32(6, reloaded.getNumRecords());
+  TEST_ASSERT_EQUAL_INT(6, replay(reloaded, 0));
+
+  out = reloaded.beginCompact();   // reset between removing the old log and the rename
+  for (int n = 0; n < 3; n++) {
+    makeRec(rec, 100 + n);
+    reloaded.append(out, rec);
+  }
+  out.close();
+  fs.remove(LOG_PATH);
+
+  RecordLog adopted;
+  adopted.begin(&fs, LOG_PATH, REC_SIZE);
+  TEST_ASSERT_FALSE(fs.exists(TMP_PATH));
+  TEST_ASSERT_EQUAL_UINT32(3, adopted.getNumRecords());
+  TEST_ASSERT_EQUAL_INT(3, replay(adopted, 100));
+  appendRecs(adopted, 3, 4);
+}
+
+int main(int argc, char* argv[]) {
+  UNITY_BEGIN();
+  RUN_TEST(test_reload);
+  RUN_TEST(test_partial_append);
+  RUN_TEST(test_bad_crc);
+  RUN_TEST(test_compaction);
+  RUN_TEST(test_interrupted_compaction);
+  return UNITY_END();
+}
@@ -0,0 +1,119 @@
+#include <unity.h>
+#include <helpers/RegionMap.h>
+#include <helpers/host/HostFS.h>
+#include <stdlib.h>
+
+/*
+ * RegionMap::findMatch(): with a RegionKeyTable (keys prepared), without one (keys looked up per packet), and after
+ * a staging map (no table) is copied into the live one, as 'region load' does. Then pruneKeys() after such a copy.
+ */
+
+static TransportKeyStore key_store;
+static RegionKeyTable region_keys;
+static RegionMap live(key_store, &region_keys), staging(key_store), plain(key_store);
+
+void setUp() {
+  srand(7);
+  live.clear();
+  plain.clear();
+  const char* kinds[] = { "#", "" };
+  for (int i = 0; i < MAX_REGION_ENTRIES; i++) {
+    char name[20];
+    sprintf(name, "%sr%d", kinds[i % 2], i);
+    live.putRegion(name, 0)->flags = 0;   // allow flood
+    plain.putRegion(name, 0)->flags = 0;
+  }
+}
+void tearDown() { }
+
+// a packet with the transport code of region 'idx' of 'map', or a random one if idx < 0
+static void makePacket(mesh::Packet& pkt, RegionMap& map, int idx) {
+  pkt.header = ((rand() % 16) << PH_TYPE_SHIFT) | ROUTE_TYPE_TRANSPORT_FLOOD;
+  pkt.payload_len = 1 + rand() % 100;
+  for (int b = 0; b < pkt.payload_len; b++) pkt.payload[b] = rand();
+  if (idx < 0) {
+    pkt.transport_codes[0] = rand();
+  } else {
+    auto region = map.getByIdx(idx);
+    char tmp[40];
+    if (region->name[0] == '#') strcpy(tmp, region->name); else sprintf(tmp, "#%s", region->name);
+    TransportKey key;
+    static TransportKeyStore calc_store;
+    calc_store.getAutoKeyFor(0xFFFF, tmp, key);
+    calc_store.clear();   // not cached by id
+    pkt.transport_codes[0] = key.calcTransportCode(&pkt);
+  }
+}
+
+static void test_prepared_matches_per_packet() {
+  for (int it = 0; it < 500; it++) {
+    mesh::Packet pkt;
+    int idx = (it % 5 == 0) ? -1 : rand() % live.getCount();
+    makePacket(pkt, live, idx);
+    auto a = live.findMatch(&pkt, REGION_DENY_FLOOD);
+    auto b = plain.findMatch(&pkt, REGION_DENY_FLOOD);
+    if (idx >= 0) {
+      TEST_ASSERT_NOT_NULL(a);
+      TEST_ASSERT_EQUAL_INT(live.getByIdx(idx)->id, a->id);
+    }
+    TEST_ASSERT_EQUAL_INT(a ? a->id : -1, b ? b->id : -1);
+  }
+}
+
+static void test_copy_from_staging() {
+  mesh::Packet pkt;
+  makePacket(pkt, live, 0);
+  TEST_ASSERT_NOT_NULL(live.findMatch(&pkt, REGION_DENY_FLOOD));   // prepares live's table
+
+  staging.resetFrom(live);
+  staging.putRegion("#new1", 0)->flags = 0;
+  staging.putRegion("r5", 0, live.findByName("r5")->id)->flags = 0;
+  live = staging;
+  TEST_ASSERT_EQUAL_INT(2, live.getCount());
+
+  makePacket(pkt, live, 0);
+  auto a = live.findMatch(&pkt, REGION_DENY_FLOOD);
+  TEST_ASSERT_NOT_NULL(a);
+  TEST_ASSERT_EQUAL_STRING("#new1", a->name);
+  makePacket(pkt, live, 1);
+  a = live.findMatch(&pkt, REGION_DENY_FLOOD);
+  TEST_ASSERT_NOT_NULL(a);
+  TEST_ASSERT_EQUAL_STRING("r5", a->name);
+
+  makePacket(pkt, plain, 2);   // r2 is no longer in live
+  TEST_ASSERT_NULL(live.findMatch(&pkt, REGION_DENY_FLOOD));
+}
+
+static void test_prune_private_keys() {
+  HostFS fs(".");
+  TransportKeyStore store;
+  store.begin(&fs, "/tk_test");
+  RegionMap map(store), next(store);
+  auto a = map.putRegion("$a", 0);
+  auto b = map.putRegion("$b", 0);
+  TransportKey key;
+  memset(key.key, 0x5A, sizeof(key.key));
+  TEST_ASSERT_TRUE(store.saveKeysFor(a->id, &key, 1));
+  TEST_ASSERT_TRUE(store.saveKeysFor(b->id, &key, 1));
+  uint16_t b_id = b->id;
+
+  next.resetFrom(map);
+  next.putRegion("$a", 0, a->id);   // $b not re-loaded
+  map = next;
+  TEST_ASSERT_TRUE(map.pruneKeys());
+
+  TransportKey keys[MAX_TKS_KEYS_PER_ID];
+  TEST_ASSERT_EQUAL_INT(1, store.loadKeysFor(map.findByName("$a")->id, keys, MAX_TKS_KEYS_PER_ID));
+  TEST_ASSERT_EQUAL_INT(0, store.loadKeysFor(b_id, keys, MAX_TKS_KEYS_PER_ID));
+  TEST_ASSERT_TRUE(map.pruneKeys());   // nothing more to drop
+  TEST_ASSERT_EQUAL_INT(1, store.loadKeysFor(map.findByName("$a")->id, keys, MAX_TKS_KEYS_PER_ID));
+  store.clear();
+}
+
+int main(int argc, char* argv[]) {
+  UNITY_BEGIN();
+  RUN_TEST(test_prepared_matches_per_packet);
+  RUN_TEST(test_copy_from_staging);
+  RUN_TEST(test_prune_private_keys);
+  return UNITY_END();
+}
@@ -0,0 +1,33 @@
+#include <Arduino.h>
+#include "target.h"
+#include <time.h>
+
+HostBoard board;
+
+LoopbackRadio radio_driver;
+
+static ArduinoMillis host_millis;
+VirtualRTCClock rtc_clock(host_millis, time(NULL));   // follows millis(), so also virtual time under the simulator
+
+SensorManager sensors;
+
+bool radio_init() {
+  return true;  // nothing to initialise
+}
+
+uint32_t radio_get_rng_seed() {
+  return (uint32_t) time(NULL) ^ micros();
+}
+
+void radio_set_params(float freq, float bw, uint8_t sf, uint8_t cr) {
+  // no-op: a host radio's modulation is fixed when it is constructed
+}
+
+void radio_set_tx_power(int8_t dbm) {
+  // no-op
+}
+
+mesh::LocalIdentity radio_new_identity() {
+  StdRNG rng;
+  return mesh::LocalIdentity(&rng);  // create new random identity
+}
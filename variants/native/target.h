@@ -0,0 +1,18 @@
+#pragma once
+
+#include <helpers/ArduinoHelpers.h>
+#include <helpers/SensorManager.h>
+#include <helpers/host/HostBoard.h>
+#include <helpers/host/HostClocks.h>
+#include <helpers/host/LoopbackRadio.h>
+
+extern HostBoard board;
+extern LoopbackRadio radio_driver;
+extern VirtualRTCClock rtc_clock;
+extern SensorManager sensors;
+
+bool radio_init();
+uint32_t radio_get_rng_seed();
+void radio_set_params(float freq, float bw, uint8_t sf, uint8_t cr);
+void radio_set_tx_power(int8_t dbm);
+mesh::LocalIdentity radio_new_identity();